@@ -0,0 +1,143 @@
+#include <chrono>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "Resources/AssetPack.h"
+
+namespace
+{
+	using Clock = std::chrono::steady_clock;
+
+	void PrintUsage()
+	{
+		std::cout << "Usage:\n"
+			<< "  AssetPacker pack <assets folder> <output pack> [--lz4]\n"
+			<< "  AssetPacker generate <folder> <count>\n"
+			<< "  AssetPacker bench <assets folder> <pack>\n";
+	}
+
+	std::vector<std::string> ListAssets(const std::filesystem::path& _folder)
+	{
+		std::vector<std::string> names;
+		for (const std::filesystem::directory_entry& file : std::filesystem::recursive_directory_iterator(_folder))
+		{
+			if (file.is_regular_file())
+				names.push_back(std::filesystem::relative(file.path(), _folder).generic_string());
+		}
+		return names;
+	}
+
+	int Pack(const std::filesystem::path& _folder, const std::filesystem::path& _output, const bool _compress)
+	{
+		const Clock::time_point start = Clock::now();
+
+		if (!AssetPack::Build(_folder, _output, _compress))
+		{
+			std::cerr << "Failed to pack " << _folder << " into " << _output << "\n";
+			return 1;
+		}
+
+		const double elapsed = std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+		std::cout << "Packed " << _folder << " into " << _output << " (" << std::filesystem::file_size(_output) << " bytes) in " << elapsed << " ms\n";
+		return 0;
+	}
+
+	int Generate(const std::filesystem::path& _folder, const int _count)
+	{
+		std::mt19937 random(42);
+		std::uniform_int_distribution<int> size_distribution(256, 64 * 1024);
+		std::vector<char> content;
+
+		for (int i = 0; i < _count; i++)
+		{
+			const std::filesystem::path path = _folder / std::to_string(i % 32) / ("asset_" + std::to_string(i) + ".bin");
+			std::filesystem::create_directories(path.parent_path());
+
+			content.resize(static_cast<std::size_t>(size_distribution(random)));
+			for (char& byte : content)
+				byte = static_cast<char>(random() & 0x0F);
+
+			std::ofstream file(path, std::ios::binary | std::ios::trunc);
+			file.write(content.data(), static_cast<std::streamsize>(content.size()));
+		}
+
+		std::cout << "Generated " << _count << " assets in " << _folder << "\n";
+		return 0;
+	}
+
+	int Bench(const std::filesystem::path& _folder, const std::filesystem::path& _pack_path)
+	{
+		const std::vector<std::string> names = ListAssets(_folder);
+		std::uint64_t checksum = 0;
+
+		// Loose files: one existence check, one open and one read per asset, as AResource does
+		const Clock::time_point loose_start = Clock::now();
+		std::vector<char> buffer;
+		for (const std::string& name : names)
+		{
+			const std::filesystem::path path = _folder / name;
+			if (!std::filesystem::exists(path))
+				continue;
+
+			std::ifstream file(path, std::ios::binary | std::ios::ate);
+			buffer.resize(static_cast<std::size_t>(file.tellg()));
+			file.seekg(0);
+			file.read(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+			for (std::size_t i = 0; i < buffer.size(); i += 4096)
+				checksum += static_cast<std::uint8_t>(buffer[i]);
+		}
+		const double loose_time = std::chrono::duration<double, std::milli>(Clock::now() - loose_start).count();
+
+		// Pack: one mapping, then lookups in the table of contents
+		const Clock::time_point pack_start = Clock::now();
+		AssetPack pack;
+		if (!pack.Open(_pack_path))
+		{
+			std::cerr << "Failed to open " << _pack_path << "\n";
+			return 1;
+		}
+
+		std::vector<std::uint8_t> decompression_buffer;
+		for (const std::string& name : names)
+		{
+			const void* data = nullptr;
+			std::size_t size = 0;
+			if (!pack.Contains(name) || !pack.GetData(name, data, size, decompression_buffer))
+				continue;
+
+			const std::uint8_t* bytes = static_cast<const std::uint8_t*>(data);
+			for (std::size_t i = 0; i < size; i += 4096)
+				checksum += bytes[i];
+		}
+		const double pack_time = std::chrono::duration<double, std::milli>(Clock::now() - pack_start).count();
+
+		std::cout << names.size() << " assets\n"
+			<< "  loose files: " << loose_time << " ms\n"
+			<< "  asset pack:  " << pack_time << " ms\n"
+			<< "  speedup:     " << (pack_time > 0.0 ? loose_time / pack_time : 0.0) << "x\n"
+			<< "  (checksum " << checksum << ")\n";
+		return 0;
+	}
+}
+
+int main(const int _argc, char* _argv[])
+{
+	const std::vector<std::string> arguments(_argv + 1, _argv + _argc);
+
+	if (arguments.size() >= 3 && arguments[0] == "pack")
+		return Pack(arguments[1], arguments[2], arguments.size() >= 4 && arguments[3] == "--lz4");
+
+	if (arguments.size() >= 3 && arguments[0] == "generate")
+		return Generate(arguments[1], std::stoi(arguments[2]));
+
+	if (arguments.size() >= 3 && arguments[0] == "bench")
+		return Bench(arguments[1], arguments[2]);
+
+	PrintUsage();
+	return 1;
+}
@@ -0,0 +1,1753 @@
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <limits>
+#include <numbers>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "Animation/AnimationClip.h"
+#include "Maths/RectBatch.h"
+#include "Maths/Transform2D.h"
+#include "Maths/Vector2Batch.h"
+#include "Physics/CollisionWorld.h"
+#include "Modules/InputModule.h"
+#include "Modules/SceneModule.h"
+#include "Modules/TimeModule.h"
+#include "ModuleManager.h"
+#include "Scene.h"
+#include "WorkerPool.h"
+#include "Components/AnimatorComponent.h"
+#include "Components/ParticleEmitter.h"
+#include "Components/RectangleShapeRenderer.h"
+#include "Components/Rigidbody2D.h"
+#include "Components/SpriteRenderer.h"
+#include "Components/SquareCollider.h"
+#include "Serialization/SceneSerializer.h"
+#include "Serialization/SceneSnapshot.h"
+
+namespace
+{
+	using Clock = std::chrono::steady_clock;
+
+	void PrintUsage()
+	{
+		std::cout << "Usage:\n"
+			<< "  Bench scene-bench <object count> <scene file>\n"
+			<< "  Bench scene-export <scene file> <json file>\n"
+			<< "  Bench transition-bench <object count>\n"
+			<< "  Bench snapshot-bench <object count>\n"
+			<< "  Bench input-bench <queries per frame>\n"
+			<< "  Bench vector-bench <vector count>\n"
+			<< "  Bench transform-bench <object count>\n"
+			<< "  Bench rect-bench <rectangle count>\n"
+			<< "  Bench broadphase-bench <static count> <moving count>\n"
+			<< "  Bench query-bench <collider count> <queries per frame>\n"
+			<< "  Bench physics-bench <body count>\n"
+			<< "  Bench physics-threads <body count> <max threads>\n"
+			<< "  Bench filter-bench <enemy count> <bullet count>\n"
+			<< "  Bench particle-bench <particle count>\n"
+			<< "  Bench animation-bench <sprite count>\n";
+	}
+
+	double ElapsedMilliseconds(const Clock::time_point _start)
+	{
+		return std::chrono::duration<double, std::milli>(Clock::now() - _start).count();
+	}
+
+	void FillBenchScene(Scene* _scene, const int _count)
+	{
+		// Built like DefaultScene: one CreateGameObject and two CreateComponent calls per object
+		for (int i = 0; i < _count; i++)
+		{
+			GameObject* game_object = _scene->CreateGameObject("GameObject_" + std::to_string(i));
+			game_object->SetPosition(Maths::Vector2f(static_cast<float>(i % 1000) * 32.0f, static_cast<float>(i / 1000) * 32.0f));
+
+			SquareCollider* square_collider = game_object->CreateComponent<SquareCollider>();
+			square_collider->SetWidth(20.f);
+			square_collider->SetHeight(20.f);
+
+			RectangleShapeRenderer* shape_renderer = game_object->CreateComponent<RectangleShapeRenderer>();
+			shape_renderer->SetColor(sf::Color(static_cast<sf::Uint8>(i), 128, 255));
+			shape_renderer->SetSize(Maths::Vector2f(32.f, 32.f));
+		}
+	}
+
+	Scene* BuildBenchScene(const int _count)
+	{
+		Scene* scene = new Scene("BenchScene");
+		FillBenchScene(scene, _count);
+		return scene;
+	}
+
+	/**
+	 * \class TransitionScene
+	 * \brief The bench scene as a scene type, for SceneModule::SetScene() and SetSceneAsync().
+	 */
+	class TransitionScene final : public Scene
+	{
+	public:
+		static inline int objectCount = 0;
+
+		TransitionScene() : Scene("TransitionScene")
+		{
+			FillBenchScene(this, objectCount);
+		}
+	};
+
+	int TransitionBench(const int _count)
+	{
+		constexpr int transitions = 5;
+
+		TransitionScene::objectCount = _count;
+
+		// No window: the frames are the updates of the main thread, rendering would add the same to both
+		ModuleManager module_manager;
+		module_manager.CreateModule<TimeModule>();
+		SceneModule* scene_module = module_manager.CreateModule<SceneModule>();
+		module_manager.Awake();
+		module_manager.Start();
+		scene_module->SetScene<TransitionScene>();
+
+		struct Transition
+		{
+			double worstFrame = 0.0;
+			double totalFrames = 0.0;
+		};
+
+		// Each transition replaces the scene and lasts until the replaced one is deleted
+		const auto measure = [&](const std::function<void()>& _transition)
+		{
+			Transition result;
+			for (int transition = 0; transition < transitions; transition++)
+			{
+				for (int frame = 0; frame == 0 || scene_module->IsLoading() || scene_module->GetRemovedSceneCount() > 0; frame++)
+				{
+					const Clock::time_point frame_start = Clock::now();
+					if (frame == 0)
+						_transition();
+					module_manager.Update();
+					result.worstFrame = std::max(result.worstFrame, ElapsedMilliseconds(frame_start));
+					++result.totalFrames;
+				}
+			}
+			result.totalFrames /= transitions;
+			return result;
+		};
+
+		// The same number of frames without transition, the cost of updating the scene itself
+		double steady_frame = 0.0;
+		for (int frame = 0; frame < 100; frame++)
+		{
+			const Clock::time_point frame_start = Clock::now();
+			module_manager.Update();
+			steady_frame = std::max(steady_frame, ElapsedMilliseconds(frame_start));
+		}
+
+		const Transition synchronous = measure([&]() { scene_module->SetScene<TransitionScene>(); });
+		const Transition asynchronous = measure([&]() { scene_module->SetSceneAsync<TransitionScene>(); });
+
+		std::cout << _count << " game objects per scene, " << transitions << " transitions, worst main thread frame\n"
+			<< "  no transition: " << steady_frame << " ms\n"
+			<< "  SetScene:      " << synchronous.worstFrame << " ms\n"
+			<< "  SetSceneAsync: " << asynchronous.worstFrame << " ms (" << asynchronous.totalFrames << " frames per transition)\n"
+			<< "  " << std::thread::hardware_concurrency() << " hardware threads, with one the loading thread shares the core of the main thread\n";
+
+		module_manager.Finalize();
+		return 0;
+	}
+
+	int SceneBench(const int _count, const std::filesystem::path& _scene_path)
+	{
+		const Clock::time_point build_start = Clock::now();
+		Scene* built_scene = BuildBenchScene(_count);
+		const double build_time = ElapsedMilliseconds(build_start);
+
+		const Clock::time_point save_start = Clock::now();
+		if (!SceneSerializer::SaveToFile(*built_scene, _scene_path))
+		{
+			std::cerr << "Failed to write " << _scene_path << "\n";
+			delete built_scene;
+			return 1;
+		}
+		const double save_time = ElapsedMilliseconds(save_start);
+		delete built_scene;
+
+		const Clock::time_point load_start = Clock::now();
+		const Scene* loaded_scene = SceneSerializer::LoadFromFile(_scene_path);
+		const double load_time = ElapsedMilliseconds(load_start);
+
+		if (!loaded_scene)
+		{
+			std::cerr << "Failed to load " << _scene_path << "\n";
+			return 1;
+		}
+
+		std::cout << loaded_scene->GetGameObjects().size() << " game objects, " << std::filesystem::file_size(_scene_path) << " bytes\n"
+			<< "  built in code: " << build_time << " ms\n"
+			<< "  saved:         " << save_time << " ms\n"
+			<< "  loaded:        " << load_time << " ms\n";
+
+		delete loaded_scene;
+		return 0;
+	}
+
+	int SceneExport(const std::filesystem::path& _scene_path, const std::filesystem::path& _json_path)
+	{
+		const Scene* scene = SceneSerializer::LoadFromFile(_scene_path);
+		if (!scene)
+		{
+			std::cerr << "Failed to load " << _scene_path << "\n";
+			return 1;
+		}
+
+		const bool exported = SceneSerializer::ExportJsonToFile(*scene, _json_path);
+		delete scene;
+
+		if (!exported)
+		{
+			std::cerr << "Failed to write " << _json_path << "\n";
+			return 1;
+		}
+
+		std::cout << "Exported " << _scene_path << " to " << _json_path << "\n";
+		return 0;
+	}
+
+	int SnapshotBench(const int _count)
+	{
+		constexpr int iterations = 100;
+
+		Scene* scene = BuildBenchScene(_count);
+		SceneSnapshot snapshot;
+
+		// The first capture sizes the buffer, the following ones reuse it like a capture every frame
+		snapshot.Capture(*scene);
+
+		const Clock::time_point capture_start = Clock::now();
+		for (int i = 0; i < iterations; i++)
+			snapshot.Capture(*scene);
+		const double capture_time = ElapsedMilliseconds(capture_start) / iterations;
+
+		for (GameObject* game_object : scene->GetGameObjects())
+			game_object->SetPosition(Maths::Vector2f::Zero);
+
+		const Clock::time_point restore_start = Clock::now();
+		bool restored = true;
+		for (int i = 0; i < iterations; i++)
+			restored = snapshot.Restore(*scene) && restored;
+		const double restore_time = ElapsedMilliseconds(restore_start) / iterations;
+
+		delete scene;
+
+		if (!restored)
+		{
+			std::cerr << "Failed to restore the snapshot\n";
+			return 1;
+		}
+
+		std::cout << _count << " game objects, " << snapshot.GetData().size() << " bytes per snapshot\n"
+			<< "  capture: " << capture_time << " ms\n"
+			<< "  restore: " << restore_time << " ms\n";
+		return 0;
+	}
+
+	int InputBench(const int _queries)
+	{
+		constexpr int frames = 100;
+
+		// Queries spread over every key and button like many components polling their own bindings
+		std::size_t held = 0;
+
+		const Clock::time_point device_start = Clock::now();
+		for (int frame = 0; frame < frames; frame++)
+		{
+			for (int i = 0; i < _queries; i++)
+			{
+				held += sf::Keyboard::isKeyPressed(static_cast<sf::Keyboard::Key>(i % sf::Keyboard::KeyCount));
+				held += sf::Mouse::isButtonPressed(static_cast<sf::Mouse::Button>(i % sf::Mouse::ButtonCount));
+			}
+		}
+		const double device_time = ElapsedMilliseconds(device_start) / frames;
+
+		InputModule input_module;
+
+		const Clock::time_point snapshot_start = Clock::now();
+		for (int frame = 0; frame < frames; frame++)
+		{
+			input_module.Update();
+
+			for (int i = 0; i < _queries; i++)
+			{
+				held += InputModule::GetKey(static_cast<sf::Keyboard::Key>(i % sf::Keyboard::KeyCount));
+				held += InputModule::GetMouseButton(static_cast<sf::Mouse::Button>(i % sf::Mouse::ButtonCount));
+			}
+		}
+		const double snapshot_time = ElapsedMilliseconds(snapshot_start) / frames;
+
+		std::cout << _queries << " key and button queries per frame\n"
+			<< "  devices:  " << device_time << " ms per frame\n"
+			<< "  snapshot: " << snapshot_time << " ms per frame\n"
+			<< "  (held " << held << ")\n";
+		return 0;
+	}
+
+	int VectorBench(const int _count)
+	{
+		using namespace Maths;
+
+		constexpr int iterations = 50;
+		constexpr float scale = 0.016f;
+		constexpr float alpha = 0.3f;
+		constexpr float angle = 0.7f;
+		const Transform2D transform = Transform2D::FromPositionRotationScale(Vector2f(12.0f, -3.0f), std::cos(angle), std::sin(angle), Vector2f(2.0f, 0.5f));
+
+		const std::size_t count = static_cast<std::size_t>(_count);
+
+		std::mt19937 random(42);
+		std::uniform_real_distribution<float> distribution(-100.0f, 100.0f);
+
+		std::vector<Vector2f> lhs(count);
+		std::vector<Vector2f> rhs(count);
+		Vector2Array lhs_batch(count);
+		Vector2Array rhs_batch(count);
+		for (std::size_t i = 0; i < count; i++)
+		{
+			// Some zero vectors for the special case of Normalize
+			lhs[i] = i % 64 == 0 ? Vector2f::Zero : Vector2f(distribution(random), distribution(random));
+			rhs[i] = Vector2f(distribution(random), distribution(random));
+			lhs_batch.Set(i, lhs[i]);
+			rhs_batch.Set(i, rhs[i]);
+		}
+
+		struct Kernel
+		{
+			const char* name;
+
+			/// Vector2f operations on an array of structures, the expected result.
+			std::function<void(Vector2Array&)> reference;
+			std::function<void(Vector2Array&)> batch;
+		};
+
+		const Kernel kernels[] = {
+			{"add", [&](Vector2Array& _out) { for (std::size_t i = 0; i < count; i++) _out.Set(i, lhs[i] + rhs[i]); },
+				[&](Vector2Array& _out) { Vector2Batch::Add(lhs_batch, rhs_batch, _out); }},
+			{"add-scaled", [&](Vector2Array& _out) { for (std::size_t i = 0; i < count; i++) _out.Set(i, lhs[i] + rhs[i] * scale); },
+				[&](Vector2Array& _out) { Vector2Batch::AddScaled(lhs_batch, rhs_batch, scale, _out); }},
+			{"translate", [&](Vector2Array& _out) { for (std::size_t i = 0; i < count; i++) _out.Set(i, lhs[i] + rhs[0]); },
+				[&](Vector2Array& _out) { Vector2Batch::Translate(lhs_batch, rhs[0], _out); }},
+			{"scale", [&](Vector2Array& _out) { for (std::size_t i = 0; i < count; i++) _out.Set(i, lhs[i] * scale); },
+				[&](Vector2Array& _out) { Vector2Batch::Scale(lhs_batch, scale, _out); }},
+			{"lerp", [&](Vector2Array& _out) { for (std::size_t i = 0; i < count; i++) _out.Set(i, Vector2f::Lerp(lhs[i], rhs[i], alpha)); },
+				[&](Vector2Array& _out) { Vector2Batch::Lerp(lhs_batch, rhs_batch, alpha, _out); }},
+			{"normalize", [&](Vector2Array& _out) { for (std::size_t i = 0; i < count; i++) _out.Set(i, lhs[i].NormalizeSafe()); },
+				[&](Vector2Array& _out) { Vector2Batch::Normalize(lhs_batch, _out); }},
+			{"rotate", [&](Vector2Array& _out) { for (std::size_t i = 0; i < count; i++) _out.Set(i, lhs[i].Rotate(angle)); },
+				[&](Vector2Array& _out) { Vector2Batch::Rotate(lhs_batch, angle, _out); }},
+			{"length", [&](Vector2Array& _out) { for (std::size_t i = 0; i < count; i++) _out.Set(i, Vector2f(lhs[i].Magnitude(), 0.0f)); },
+				[&](Vector2Array& _out) { Vector2Batch::Length(lhs_batch, _out.GetSpan().x); }},
+			{"distance", [&](Vector2Array& _out) { for (std::size_t i = 0; i < count; i++) _out.Set(i, Vector2f(lhs[i].Distance(rhs[i]), 0.0f)); },
+				[&](Vector2Array& _out) { Vector2Batch::Distance(lhs_batch, rhs_batch, _out.GetSpan().x); }},
+			{"transform", [&](Vector2Array& _out) { for (std::size_t i = 0; i < count; i++) _out.Set(i, transform.TransformPoint(lhs[i])); },
+				[&](Vector2Array& _out) { transform.TransformPoints(lhs_batch, _out); }}
+		};
+
+		const Vector2Batch::SimdLevel supported = Vector2Batch::GetSupportedSimdLevel();
+
+		std::cout << count << " vectors, ms per batch (Vector2f, then the batch kernels of each level)\n"
+			<< std::setw(12) << "kernel" << std::setw(10) << "Vector2f";
+		for (int level = 0; level <= static_cast<int>(supported); level++)
+			std::cout << std::setw(10) << Vector2Batch::GetSimdLevelName(static_cast<Vector2Batch::SimdLevel>(level));
+		std::cout << "\n" << std::fixed << std::setprecision(4);
+
+		Vector2Array expected(count);
+		Vector2Array result(count);
+		bool exact = true;
+
+		for (const Kernel& kernel : kernels)
+		{
+			const Clock::time_point reference_start = Clock::now();
+			for (int i = 0; i < iterations; i++)
+				kernel.reference(expected);
+			std::cout << std::setw(12) << kernel.name << std::setw(10) << ElapsedMilliseconds(reference_start) / iterations;
+
+			for (int level = 0; level <= static_cast<int>(supported); level++)
+			{
+				Vector2Batch::SetSimdLevel(static_cast<Vector2Batch::SimdLevel>(level));
+
+				result = Vector2Array(count);
+				const Clock::time_point batch_start = Clock::now();
+				for (int i = 0; i < iterations; i++)
+					kernel.batch(result);
+				std::cout << std::setw(10) << ElapsedMilliseconds(batch_start) / iterations;
+
+				// Compared bit for bit, the batches must not change the simulation
+				const ConstVector2Span expected_span = expected;
+				const ConstVector2Span result_span = result;
+				if (std::memcmp(expected_span.x, result_span.x, count * sizeof(float)) != 0 || std::memcmp(expected_span.y, result_span.y, count * sizeof(float)) != 0)
+				{
+					std::cout << " (differs)";
+					exact = false;
+				}
+			}
+			std::cout << "\n";
+		}
+
+		Vector2Batch::SetSimdLevel(supported);
+
+		if (!exact)
+		{
+			std::cerr << "Batch results differ from Vector2f\n";
+			return 1;
+		}
+		return 0;
+	}
+
+	int TransformBench(const int _count)
+	{
+		using namespace Maths;
+
+		constexpr int frames = 50;
+		constexpr float degrees_to_radians = std::numbers::pi_v<float> / 180.0f;
+
+		// A quad per object, placed in the object then in a parent like a camera
+		const Vector2f corners[] = {Vector2f(0.0f, 0.0f), Vector2f(32.0f, 0.0f), Vector2f(32.0f, 32.0f), Vector2f(0.0f, 32.0f)};
+		const Vector2f parent_position(640.0f, 360.0f);
+		const float parent_rotation = 15.0f;
+		const Vector2f parent_scale(0.5f, 0.5f);
+
+		std::vector<GameObject> game_objects(static_cast<std::size_t>(_count));
+		for (std::size_t i = 0; i < game_objects.size(); i++)
+		{
+			game_objects[i].SetPosition(Vector2f(static_cast<float>(i % 1000) * 32.0f, static_cast<float>(i / 1000) * 32.0f));
+			game_objects[i].SetRotation(static_cast<float>(i % 360));
+			game_objects[i].SetScale(Vector2f(1.0f + static_cast<float>(i % 3), 1.0f));
+		}
+
+		// Objects move every frame and keep their rotation, the usual case
+		const Vector2f velocity(0.5f, 0.25f);
+
+		std::vector<Vector2f> trig_points(game_objects.size() * 4);
+		const Clock::time_point trig_start = Clock::now();
+		for (int frame = 0; frame < frames; frame++)
+		{
+			for (std::size_t i = 0; i < game_objects.size(); i++)
+			{
+				GameObject& game_object = game_objects[i];
+				game_object.SetPosition(game_object.GetPosition() + velocity);
+
+				for (std::size_t corner = 0; corner < 4; corner++)
+				{
+					const Vector2f world = game_object.GetPosition() + (corners[corner] * game_object.GetScale()).Rotate(game_object.GetRotation() * degrees_to_radians);
+					trig_points[i * 4 + corner] = (world * parent_scale).Rotate(parent_rotation * degrees_to_radians) + parent_position;
+				}
+			}
+		}
+		const double trig_time = ElapsedMilliseconds(trig_start) / frames;
+
+		for (std::size_t i = 0; i < game_objects.size(); i++)
+			game_objects[i].SetPosition(game_objects[i].GetPosition() - velocity * static_cast<float>(frames));
+
+		std::vector<Vector2f> transform_points(game_objects.size() * 4);
+		const Clock::time_point transform_start = Clock::now();
+		for (int frame = 0; frame < frames; frame++)
+		{
+			const float parent_radians = parent_rotation * degrees_to_radians;
+			const Transform2D parent = Transform2D::FromPositionRotationScale(parent_position, std::cos(parent_radians), std::sin(parent_radians), parent_scale);
+
+			for (std::size_t i = 0; i < game_objects.size(); i++)
+			{
+				GameObject& game_object = game_objects[i];
+				game_object.SetPosition(game_object.GetPosition() + velocity);
+
+				const Transform2D world = parent * game_object.GetTransform();
+				for (std::size_t corner = 0; corner < 4; corner++)
+					transform_points[i * 4 + corner] = world.TransformPoint(corners[corner]);
+			}
+		}
+		const double transform_time = ElapsedMilliseconds(transform_start) / frames;
+
+		float max_error = 0.0f;
+		for (std::size_t i = 0; i < trig_points.size(); i++)
+			max_error = std::max(max_error, trig_points[i].Distance(transform_points[i]));
+
+		// Every point through the parent at once, as a camera would place particles or vertices
+		Vector2Array local_points(transform_points.size());
+		for (std::size_t i = 0; i < transform_points.size(); i++)
+			local_points.Set(i, transform_points[i]);
+		Vector2Array parent_points(transform_points.size());
+		const Transform2D parent = Transform2D::Rotation(parent_rotation * degrees_to_radians);
+
+		const Clock::time_point point_start = Clock::now();
+		for (int frame = 0; frame < frames; frame++)
+		{
+			for (std::size_t i = 0; i < transform_points.size(); i++)
+				parent_points.Set(i, parent.TransformPoint(local_points.Get(i)));
+		}
+		const double point_time = ElapsedMilliseconds(point_start) / frames;
+
+		const Clock::time_point batch_start = Clock::now();
+		for (int frame = 0; frame < frames; frame++)
+			parent.TransformPoints(local_points, parent_points);
+		const double batch_time = ElapsedMilliseconds(batch_start) / frames;
+
+		std::cout << _count << " game objects, 4 points each, ms per frame\n"
+			<< "  per-object trigonometry: " << trig_time << " ms\n"
+			<< "  cached Transform2D:      " << transform_time << " ms (largest difference " << max_error << ")\n"
+			<< "  " << transform_points.size() << " points through one transform\n"
+			<< "  TransformPoint:          " << point_time << " ms\n"
+			<< "  TransformPoints (" << Vector2Batch::GetSimdLevelName(Vector2Batch::GetSimdLevel()) << "):  " << batch_time << " ms\n";
+		return 0;
+	}
+
+	int RectBench(const int _count)
+	{
+		using namespace Maths;
+
+		constexpr int queries = 200;
+
+		// Whole coordinates, so that many rectangles share edges with each other and with the queries
+		std::mt19937 random(42);
+		std::uniform_int_distribution<int> position_distribution(0, 4000);
+		std::uniform_int_distribution<int> size_distribution(0, 40);
+		const auto random_rect = [&](const int _max_size)
+		{
+			const Vector2f position(static_cast<float>(position_distribution(random)), static_cast<float>(position_distribution(random)));
+			const Vector2f size(static_cast<float>(size_distribution(random) % (_max_size + 1)), static_cast<float>(size_distribution(random) % (_max_size + 1)));
+			return Rectf::FromPositionSize(position, size);
+		};
+
+		std::vector<Rectf> rects(static_cast<std::size_t>(_count));
+		RectArray rect_array;
+		for (Rectf& rect : rects)
+		{
+			rect = random_rect(40);
+			rect_array.Add(rect);
+		}
+
+		struct Query
+		{
+			const char* name;
+			std::vector<Rectf> rects;
+			std::vector<Vector2f> points;
+		};
+
+		Query culling{"view", {}, {}};
+		Query broadphase{"object", {}, {}};
+		Query picking{"point", {}, {}};
+		for (int i = 0; i < queries; i++)
+		{
+			culling.rects.push_back(Rectf::FromPositionSize(random_rect(0).min, Vector2f(640.0f, 360.0f)));
+			broadphase.rects.push_back(random_rect(40));
+			picking.points.push_back(random_rect(0).min);
+		}
+
+		std::vector<std::uint32_t> expected;
+		std::vector<std::uint32_t> result(rects.size());
+		const Vector2Batch::SimdLevel supported = Vector2Batch::GetSupportedSimdLevel();
+		bool exact = true;
+
+		std::cout << rects.size() << " rectangles, ms per query (Rectf loop, then the batch kernels of each level)\n"
+			<< std::setw(8) << "query" << std::setw(10) << "matches" << std::setw(10) << "Rectf";
+		for (int level = 0; level <= static_cast<int>(supported); level++)
+			std::cout << std::setw(10) << Vector2Batch::GetSimdLevelName(static_cast<Vector2Batch::SimdLevel>(level));
+		std::cout << "\n" << std::fixed << std::setprecision(4);
+
+		for (const Query* query : {&culling, &broadphase, &picking})
+		{
+			// The loop the colliders open-coded, its indices are the expected ones
+			std::vector<std::vector<std::uint32_t>> expected_indices(queries);
+			const Clock::time_point reference_start = Clock::now();
+			for (int i = 0; i < queries; i++)
+			{
+				expected.clear();
+				for (std::size_t j = 0; j < rects.size(); j++)
+				{
+					if (query->points.empty() ? rects[j].Overlaps(query->rects[i]) : rects[j].Contains(query->points[i]))
+						expected.push_back(static_cast<std::uint32_t>(j));
+				}
+				expected_indices[i] = expected;
+			}
+			const double reference_time = ElapsedMilliseconds(reference_start) / queries;
+
+			std::size_t matches = 0;
+			for (const std::vector<std::uint32_t>& indices : expected_indices)
+				matches += indices.size();
+			std::cout << std::setw(8) << query->name << std::setw(10) << matches / queries << std::setw(10) << reference_time;
+
+			for (int level = 0; level <= static_cast<int>(supported); level++)
+			{
+				Vector2Batch::SetSimdLevel(static_cast<Vector2Batch::SimdLevel>(level));
+
+				bool same = true;
+				const Clock::time_point batch_start = Clock::now();
+				for (int i = 0; i < queries; i++)
+				{
+					const std::size_t found = query->points.empty() ? RectBatch::Overlapping(query->rects[i], rect_array, result.data()) : RectBatch::Containing(query->points[i], rect_array, result.data());
+					same = same && found == expected_indices[i].size() && std::equal(expected_indices[i].begin(), expected_indices[i].end(), result.begin());
+				}
+				std::cout << std::setw(10) << ElapsedMilliseconds(batch_start) / queries;
+
+				if (!same)
+				{
+					std::cout << " (differs)";
+					exact = false;
+				}
+			}
+			std::cout << "\n";
+		}
+
+		Vector2Batch::SetSimdLevel(supported);
+
+		if (!exact)
+		{
+			std::cerr << "Batch queries differ from Rectf\n";
+			return 1;
+		}
+		return 0;
+	}
+
+	Scene* BuildBroadphaseScene(const std::vector<Maths::Vector2f>& _positions, const std::vector<Maths::Vector2f>& _sizes, const int _static_count, const CollisionWorld::Broadphase _broadphase)
+	{
+		Scene* scene = new Scene("BroadphaseScene");
+		scene->GetCollisionWorld().SetBroadphase(_broadphase);
+		scene->ReserveGameObjects(_positions.size());
+
+		for (std::size_t i = 0; i < _positions.size(); i++)
+		{
+			GameObject* game_object = scene->CreateGameObject("Collider_" + std::to_string(i));
+			game_object->SetPosition(_positions[i]);
+
+			SquareCollider* square_collider = game_object->CreateComponent<SquareCollider>();
+			square_collider->SetStatic(static_cast<int>(i) < _static_count);
+			square_collider->SetWidth(_sizes[i].x);
+			square_collider->SetHeight(_sizes[i].y);
+		}
+		return scene;
+	}
+
+	std::vector<std::uint64_t> GetSortedPairKeys(const CollisionWorld& _world)
+	{
+		std::vector<std::uint64_t> keys;
+		for (const CollisionPair& pair : _world.GetPairs())
+			keys.push_back(pair.GetKey());
+		std::sort(keys.begin(), keys.end());
+		return keys;
+	}
+
+	int BroadphaseBench(const int _static_count, const int _moving_count)
+	{
+		using namespace Maths;
+
+		constexpr int frames = 120;
+
+		const int count = _static_count + _moving_count;
+		const float world_size = std::sqrt(static_cast<float>(count)) * 48.0f;
+		bool same = true;
+
+		std::cout << _static_count << " static and " << _moving_count << " moving colliders, " << frames << " frames, ms per frame\n"
+			<< std::setw(10) << "layout" << std::setw(10) << "pairs" << std::setw(12) << "brute" << std::setw(12) << "sweep" << std::setw(10) << "speedup"
+			<< std::setw(12) << "swaps" << std::setw(12) << "insert" << "\n" << std::fixed << std::setprecision(3);
+
+		for (const bool clustered : {false, true})
+		{
+			std::mt19937 random(42);
+			std::uniform_real_distribution<float> spread_distribution(0.0f, world_size);
+			std::uniform_real_distribution<float> size_distribution(8.0f, 40.0f);
+			std::uniform_real_distribution<float> speed_distribution(-3.0f, 3.0f);
+
+			// Clusters like the rooms of a level, empty space around them
+			std::vector<Vector2f> centers(16);
+			for (Vector2f& center : centers)
+				center = Vector2f(spread_distribution(random), spread_distribution(random));
+			std::normal_distribution<float> cluster_distribution(0.0f, world_size / 40.0f);
+			std::uniform_int_distribution<std::size_t> center_distribution(0, centers.size() - 1);
+
+			std::vector<Vector2f> positions(static_cast<std::size_t>(count));
+			std::vector<Vector2f> sizes(positions.size());
+			std::vector<Vector2f> velocities(positions.size());
+			for (std::size_t i = 0; i < positions.size(); i++)
+			{
+				positions[i] = clustered ? centers[center_distribution(random)] + Vector2f(cluster_distribution(random), cluster_distribution(random)) : Vector2f(spread_distribution(random), spread_distribution(random));
+				sizes[i] = Vector2f(size_distribution(random), size_distribution(random));
+				velocities[i] = Vector2f(speed_distribution(random), speed_distribution(random));
+			}
+
+			Scene* brute_scene = BuildBroadphaseScene(positions, sizes, _static_count, CollisionWorld::Broadphase::BruteForce);
+			Scene* sweep_scene = BuildBroadphaseScene(positions, sizes, _static_count, CollisionWorld::Broadphase::SweepAndPrune);
+			CollisionWorld& brute_world = brute_scene->GetCollisionWorld();
+			CollisionWorld& sweep_world = sweep_scene->GetCollisionWorld();
+
+			// The first update inserts every collider
+			const Clock::time_point insert_start = Clock::now();
+			sweep_world.Update();
+			const double insert_time = ElapsedMilliseconds(insert_start);
+			brute_world.Update();
+			same = same && GetSortedPairKeys(brute_world) == GetSortedPairKeys(sweep_world);
+
+			double brute_time = 0.0;
+			double sweep_time = 0.0;
+			std::size_t pairs = 0;
+			const std::uint64_t insert_swaps = sweep_world.GetSweepAndPrune().GetSwapCount();
+
+			for (int frame = 0; frame < frames; frame++)
+			{
+				for (std::size_t i = static_cast<std::size_t>(_static_count); i < positions.size(); i++)
+				{
+					positions[i] += velocities[i];
+					if (positions[i].x < 0.0f || positions[i].x > world_size)
+						velocities[i].x = -velocities[i].x;
+					if (positions[i].y < 0.0f || positions[i].y > world_size)
+						velocities[i].y = -velocities[i].y;
+
+					brute_scene->GetGameObjects()[i]->SetPosition(positions[i]);
+					sweep_scene->GetGameObjects()[i]->SetPosition(positions[i]);
+
+					// Some colliders replaced now and then, their ids are reused
+					if (frame % 30 == 29 && i % 50 == 0)
+					{
+						for (Scene* scene : {brute_scene, sweep_scene})
+						{
+							GameObject* game_object = scene->GetGameObjects()[i];
+							SquareCollider* square_collider = game_object->GetComponent<SquareCollider>();
+							game_object->RemoveComponent(square_collider);
+							delete square_collider;
+
+							square_collider = game_object->CreateComponent<SquareCollider>();
+							square_collider->SetWidth(sizes[i].x);
+							square_collider->SetHeight(sizes[i].y);
+						}
+					}
+				}
+
+				const Clock::time_point brute_start = Clock::now();
+				brute_world.Update();
+				brute_time += ElapsedMilliseconds(brute_start);
+
+				const Clock::time_point sweep_start = Clock::now();
+				sweep_world.Update();
+				sweep_time += ElapsedMilliseconds(sweep_start);
+
+				pairs += sweep_world.GetPairs().size();
+				same = same && GetSortedPairKeys(brute_world) == GetSortedPairKeys(sweep_world);
+			}
+
+			std::cout << std::setw(10) << (clustered ? "clustered" : "spread") << std::setw(10) << pairs / frames
+				<< std::setw(12) << brute_time / frames << std::setw(12) << sweep_time / frames
+				<< std::setw(9) << (sweep_time > 0.0 ? brute_time / sweep_time : 0.0) << "x"
+				<< std::setw(12) << (sweep_world.GetSweepAndPrune().GetSwapCount() - insert_swaps) / frames << std::setw(12) << insert_time << "\n";
+
+			delete brute_scene;
+			delete sweep_scene;
+		}
+
+		if (!same)
+		{
+			std::cerr << "Sweep and prune pairs differ from brute force\n";
+			return 1;
+		}
+		return 0;
+	}
+
+	int QueryBench(const int _count, const int _queries)
+	{
+		using namespace Maths;
+
+		constexpr int frames = 30;
+
+		// Brute force answers are only computed for the first queries of a frame, they take long
+		constexpr int checked_queries = 50;
+
+		const float world_size = std::sqrt(static_cast<float>(_count)) * 48.0f;
+		const int moving_count = _count / 20;
+
+		std::mt19937 random(7);
+		std::uniform_real_distribution<float> position_distribution(0.0f, world_size);
+		std::uniform_real_distribution<float> size_distribution(8.0f, 40.0f);
+		std::uniform_real_distribution<float> speed_distribution(-3.0f, 3.0f);
+		std::uniform_real_distribution<float> angle_distribution(0.0f, 2.0f * std::numbers::pi_v<float>);
+
+		std::vector<Vector2f> positions(static_cast<std::size_t>(_count));
+		std::vector<Vector2f> sizes(positions.size());
+		for (std::size_t i = 0; i < positions.size(); i++)
+		{
+			positions[i] = Vector2f(position_distribution(random), position_distribution(random));
+			sizes[i] = Vector2f(size_distribution(random), size_distribution(random));
+		}
+
+		Scene* scene = BuildBroadphaseScene(positions, sizes, _count - moving_count, CollisionWorld::Broadphase::SweepAndPrune);
+		CollisionWorld& world = scene->GetCollisionWorld();
+
+		std::vector<SquareCollider*> colliders;
+		for (GameObject* game_object : scene->GetGameObjects())
+			colliders.push_back(game_object->GetComponent<SquareCollider>());
+
+		std::vector<Vector2f> velocities(static_cast<std::size_t>(moving_count));
+		for (Vector2f& velocity : velocities)
+			velocity = Vector2f(speed_distribution(random), speed_distribution(random));
+
+		enum QueryType { RectQuery, PointQuery, CircleQuery, RayQuery, QueryTypeCount };
+		const char* names[QueryTypeCount] = {"rect", "point", "circle", "raycast"};
+		double tree_times[QueryTypeCount] = {};
+		double brute_times[QueryTypeCount] = {};
+		std::size_t found[QueryTypeCount] = {};
+
+		std::vector<SquareCollider*> results;
+		std::vector<SquareCollider*> expected;
+		results.reserve(positions.size());
+		expected.reserve(positions.size());
+
+		struct Query
+		{
+			Vector2f point;
+			Vector2f end;
+		};
+		std::vector<Query> queries(static_cast<std::size_t>(_queries));
+		bool same = true;
+
+		for (int frame = 0; frame < frames; frame++)
+		{
+			for (std::size_t i = 0; i < velocities.size(); i++)
+			{
+				const std::size_t index = positions.size() - velocities.size() + i;
+				positions[index] += velocities[i];
+				scene->GetGameObjects()[index]->SetPosition(positions[index]);
+			}
+			world.Update();
+
+			for (Query& query : queries)
+			{
+				query.point = Vector2f(position_distribution(random), position_distribution(random));
+				const float angle = angle_distribution(random);
+				query.end = query.point + Vector2f(std::cos(angle), std::sin(angle)) * 400.0f;
+			}
+
+			for (int type = 0; type < QueryTypeCount; type++)
+			{
+				const auto run = [&](const Query& _query, std::vector<SquareCollider*>& _results)
+				{
+					CollisionWorld::RaycastHit hit;
+					switch (type)
+					{
+					case RectQuery:
+						return world.QueryRect(Rectf::FromPositionSize(_query.point, Vector2f(64.0f, 64.0f)), _results);
+					case PointQuery:
+						return world.QueryPoint(_query.point, _results);
+					case CircleQuery:
+						return world.QueryCircle(_query.point, 100.0f, _results);
+					default:
+						return world.Raycast(_query.point, _query.end, hit) ? static_cast<std::size_t>(1) : static_cast<std::size_t>(0);
+					}
+				};
+
+				const Clock::time_point tree_start = Clock::now();
+				for (const Query& query : queries)
+					found[type] += run(query, results);
+				tree_times[type] += ElapsedMilliseconds(tree_start);
+
+				// The same answers from every collider, the results of the tree compared as sorted sets
+				const Clock::time_point brute_start = Clock::now();
+				for (int i = 0; i < std::min(checked_queries, _queries); i++)
+				{
+					const Query& query = queries[static_cast<std::size_t>(i)];
+					const Rectf query_rect = Rectf::FromPositionSize(query.point, Vector2f(64.0f, 64.0f));
+					float closest = 1.0f;
+					bool ray_hit = false;
+
+					expected.clear();
+					for (SquareCollider* collider : colliders)
+					{
+						const Rectf bounds = collider->GetBounds();
+
+						if (type == RayQuery)
+						{
+							// Slabs, as CollisionWorld::Raycast
+							const Vector2f delta = query.end - query.point;
+							float enter = 0.0f;
+							float exit = closest;
+							bool inside = true;
+							for (int axis = 0; axis < 2 && inside; axis++)
+							{
+								const float start = axis == 0 ? query.point.x : query.point.y;
+								const float direction = axis == 0 ? delta.x : delta.y;
+								const float min = axis == 0 ? bounds.min.x : bounds.min.y;
+								const float max = axis == 0 ? bounds.max.x : bounds.max.y;
+								if (direction == 0.0f)
+								{
+									inside = start >= min && start <= max;
+									continue;
+								}
+								enter = std::max(enter, ((direction > 0.0f ? min : max) - start) / direction);
+								exit = std::min(exit, ((direction > 0.0f ? max : min) - start) / direction);
+								inside = enter <= exit;
+							}
+							if (inside)
+							{
+								closest = enter;
+								ray_hit = true;
+							}
+						}
+						else if (type == RectQuery ? bounds.Overlaps(query_rect) : type == PointQuery ? bounds.Contains(query.point) : bounds.DistanceSquared(query.point) <= 100.0f * 100.0f)
+						{
+							expected.push_back(collider);
+						}
+					}
+
+					if (type == RayQuery)
+					{
+						CollisionWorld::RaycastHit hit;
+						const bool tree_hit = world.Raycast(query.point, query.end, hit);
+						same = same && tree_hit == ray_hit && (!ray_hit || hit.fraction == closest);
+					}
+					else
+					{
+						run(query, results);
+						std::sort(results.begin(), results.end());
+						std::sort(expected.begin(), expected.end());
+						same = same && results == expected;
+					}
+				}
+				brute_times[type] += ElapsedMilliseconds(brute_start) / std::min(checked_queries, _queries) * _queries;
+			}
+		}
+
+		const DynamicTree& tree = world.GetTree();
+		const bool valid = tree.Validate();
+		std::cout << _count << " colliders (" << moving_count << " moving), " << _queries << " queries of each kind per frame, " << frames << " frames\n"
+			<< "tree height " << tree.GetHeight() << ", area ratio " << std::setprecision(2) << std::fixed << tree.GetAreaRatio() << ", " << (valid ? "valid" : "INVALID") << "\n"
+			<< std::setw(10) << "query" << std::setw(10) << "found" << std::setw(14) << "tree ms" << std::setw(14) << "brute ms" << "\n" << std::setprecision(3);
+		for (int type = 0; type < QueryTypeCount; type++)
+		{
+			std::cout << std::setw(10) << names[type] << std::setw(10) << static_cast<double>(found[type]) / (static_cast<double>(frames) * _queries)
+				<< std::setw(14) << tree_times[type] / frames << std::setw(14) << brute_times[type] / frames << "\n";
+		}
+		std::cout << "(ms per frame of queries, brute force measured on " << checked_queries << " queries per frame and scaled)\n";
+
+		delete scene;
+
+		if (!same || !valid)
+		{
+			std::cerr << "Tree queries differ from brute force\n";
+			return 1;
+		}
+		return 0;
+	}
+	GameObject* CreateBox(Scene* _scene, const Maths::Vector2f& _position, const Maths::Vector2f& _size, const bool _has_body)
+	{
+		GameObject* game_object = _scene->CreateGameObject("Box_" + std::to_string(_scene->GetGameObjects().size()));
+		game_object->SetPosition(_position);
+
+		SquareCollider* square_collider = game_object->CreateComponent<SquareCollider>();
+		square_collider->SetStatic(!_has_body);
+		square_collider->SetWidth(_size.x);
+		square_collider->SetHeight(_size.y);
+
+		if (_has_body)
+			game_object->CreateComponent<Rigidbody2D>();
+		return game_object;
+	}
+
+	/// Deepest overlap of two colliders in the world, along their axis of least overlap.
+	float GetMaxPenetration(CollisionWorld& _world)
+	{
+		_world.Update();
+
+		float max_depth = 0.0f;
+		for (const CollisionPair& pair : _world.GetPairs())
+		{
+			const Maths::Rectf& bounds_a = _world.GetBounds(pair.a);
+			const Maths::Rectf& bounds_b = _world.GetBounds(pair.b);
+			const float overlap_x = std::min(bounds_a.max.x, bounds_b.max.x) - std::max(bounds_a.min.x, bounds_b.min.x);
+			const float overlap_y = std::min(bounds_a.max.y, bounds_b.max.y) - std::max(bounds_a.min.y, bounds_b.min.y);
+			max_depth = std::max(max_depth, std::min(overlap_x, overlap_y));
+		}
+		return max_depth;
+	}
+
+	constexpr float PhysicsStep = 1.0f / 60.0f;
+	constexpr int StackHeight = 20;
+	constexpr float StackBoxSize = 16.0f;
+
+	/// Stacks of boxes a little apart and a little off, dropped on the ground between two walls, the first three game objects.
+	Scene* BuildStacksScene(const int _count)
+	{
+		using namespace Maths;
+
+		const int stack_count = std::max(1, _count / StackHeight);
+		const float width = static_cast<float>(stack_count) * StackBoxSize * 1.5f;
+
+		Scene* scene = new Scene("PhysicsScene");
+		scene->ReserveGameObjects(static_cast<std::size_t>(_count) + 3);
+		CreateBox(scene, Vector2f(-32.0f, 0.0f), Vector2f(width + 64.0f, 32.0f), false);
+		CreateBox(scene, Vector2f(-32.0f, -2000.0f), Vector2f(32.0f, 2000.0f), false);
+		CreateBox(scene, Vector2f(width, -2000.0f), Vector2f(32.0f, 2000.0f), false);
+
+		std::mt19937 random(3);
+		std::uniform_real_distribution<float> offset_distribution(-2.0f, 2.0f);
+		for (int i = 0; i < _count; i++)
+		{
+			const int column = i % stack_count;
+			const int row = i / stack_count;
+			const Vector2f position(static_cast<float>(column) * StackBoxSize * 1.5f + StackBoxSize * 0.25f + offset_distribution(random), -static_cast<float>(row + 1) * (StackBoxSize + 2.0f));
+			CreateBox(scene, position, Vector2f(StackBoxSize, StackBoxSize), true);
+		}
+		return scene;
+	}
+
+	int PhysicsBench(const int _count)
+	{
+		using namespace Maths;
+
+		constexpr int max_steps = 60 * 20;
+
+		const int stack_count = std::max(1, _count / StackHeight);
+		Scene* scene = BuildStacksScene(_count);
+
+		std::vector<float> start_x;
+		for (int i = 0; i < _count; i++)
+			start_x.push_back(scene->GetGameObjects()[static_cast<std::size_t>(i) + 3]->GetPosition().x);
+
+		PhysicsWorld& world = scene->GetPhysicsWorld();
+		CollisionWorld& collision_world = scene->GetCollisionWorld();
+
+		std::cout << _count << " boxes in " << stack_count << " stacks, steps of " << std::setprecision(2) << std::fixed << PhysicsStep * 1000.0f << " ms\n"
+			<< std::setw(8) << "time" << std::setw(10) << "awake" << std::setw(10) << "contacts" << std::setw(10) << "islands" << std::setw(12) << "ms/step" << "\n" << std::setprecision(3);
+
+		double awake_time = 0.0;
+		int awake_steps = 0;
+		double asleep_time = 0.0;
+		int asleep_steps = 0;
+		double period_time = 0.0;
+		int steps = 0;
+
+		for (; steps < max_steps; steps++)
+		{
+			const bool all_asleep = world.GetAwakeBodyCount() == 0;
+
+			const Clock::time_point start = Clock::now();
+			world.Step(PhysicsStep);
+			const double time = ElapsedMilliseconds(start);
+			period_time += time;
+
+			(all_asleep ? asleep_time : awake_time) += time;
+			++(all_asleep ? asleep_steps : awake_steps);
+
+			if (steps % 60 == 59)
+			{
+				std::cout << std::setw(7) << (steps + 1) / 60 << "s" << std::setw(10) << world.GetAwakeBodyCount() << std::setw(10) << world.GetContactCount()
+					<< std::setw(10) << world.GetIslandCount() << std::setw(12) << period_time / 60.0 << "\n";
+				period_time = 0.0;
+			}
+
+			// Two more seconds once everything sleeps, to measure what sleeping costs
+			if (all_asleep && asleep_steps >= 120)
+				break;
+		}
+
+		float max_drift = 0.0f;
+		for (int i = 0; i < _count; i++)
+			max_drift = std::max(max_drift, std::abs(scene->GetGameObjects()[static_cast<std::size_t>(i) + 3]->GetPosition().x - start_x[static_cast<std::size_t>(i)]));
+
+		const float max_penetration = GetMaxPenetration(collision_world);
+		std::cout << "awake " << (awake_steps > 0 ? awake_time / awake_steps : 0.0) << " ms/step over " << awake_steps << " steps, asleep "
+			<< (asleep_steps > 0 ? asleep_time / asleep_steps : 0.0) << " ms/step over " << asleep_steps << " steps\n"
+			<< "max penetration " << max_penetration << " px, max horizontal drift " << max_drift << " px\n";
+
+		// One more box dropped on the first stack wakes it alone, until they sleep again
+		CreateBox(scene, Vector2f(StackBoxSize * 0.25f, -static_cast<float>(_count / stack_count + 4) * (StackBoxSize + 2.0f)), Vector2f(StackBoxSize, StackBoxSize), true);
+		std::size_t max_awake = 0;
+		int wake_steps = 0;
+		for (; wake_steps < max_steps && world.GetAwakeBodyCount() > 0; wake_steps++)
+		{
+			world.Step(PhysicsStep);
+			max_awake = std::max(max_awake, world.GetAwakeBodyCount());
+		}
+		std::cout << "box dropped on a stack: " << max_awake << " bodies woken, asleep again after " << wake_steps << " steps\n";
+
+		delete scene;
+
+		// A fast small box shot at a thin wall, it passes through unless swept
+		bool tunnelled[2] = {};
+		for (const bool continuous : {false, true})
+		{
+			Scene* bullet_scene = new Scene("BulletScene");
+			bullet_scene->GetPhysicsWorld().SetGravity(Vector2f::Zero);
+			CreateBox(bullet_scene, Vector2f(200.0f, -100.0f), Vector2f(2.0f, 200.0f), false);
+
+			GameObject* bullet = CreateBox(bullet_scene, Vector2f(0.0f, 0.0f), Vector2f(4.0f, 4.0f), true);
+			Rigidbody2D* rigidbody = bullet->GetComponent<Rigidbody2D>();
+			rigidbody->SetContinuous(continuous);
+			rigidbody->SetVelocity(Vector2f(6000.0f, 0.0f));
+
+			for (int i = 0; i < 30; i++)
+				bullet_scene->GetPhysicsWorld().Step(PhysicsStep);
+
+			tunnelled[continuous] = bullet->GetPosition().x > 202.0f;
+			std::cout << "bullet at 6000 px/s, " << (continuous ? "continuous" : "discrete  ") << ": x = " << bullet->GetPosition().x
+				<< (tunnelled[continuous] ? ", passed through the wall\n" : ", stopped by the wall\n");
+			delete bullet_scene;
+		}
+
+		if (tunnelled[true] || max_penetration > 4.0f)
+		{
+			std::cerr << "Bodies pass through colliders\n";
+			return 1;
+		}
+		return 0;
+	}
+
+	int PhysicsThreadsBench(const int _count, const int _max_threads)
+	{
+		constexpr int settle_steps = 120;
+		constexpr int measured_steps = 240;
+
+		std::cout << _count << " boxes kept awake, ms per step over " << measured_steps << " steps after " << settle_steps << " to settle, "
+			<< std::thread::hardware_concurrency() << " hardware threads\n"
+			<< std::setw(8) << "threads" << std::setw(14) << "broadphase" << std::setw(12) << "solver" << std::setw(10) << "speedup" << std::setw(12) << "total" << std::setw(10) << "speedup"
+			<< std::setw(14) << "same result" << "\n" << std::setprecision(3) << std::fixed;
+
+		std::vector<Maths::Vector2f> reference;
+		double single_solver_time = 0.0;
+		double single_total_time = 0.0;
+		bool same = true;
+
+		for (int thread_count = 1; thread_count <= _max_threads; thread_count++)
+		{
+			Scene* scene = BuildStacksScene(_count);
+			for (GameObject* game_object : scene->GetGameObjects())
+			{
+				if (Rigidbody2D* rigidbody = game_object->GetComponent<Rigidbody2D>())
+					rigidbody->SetSleepAllowed(false);
+			}
+
+			WorkerPool workers(static_cast<std::size_t>(thread_count));
+			PhysicsWorld& world = scene->GetPhysicsWorld();
+			for (int step = 0; step < settle_steps; step++)
+				world.Step(PhysicsStep, &workers);
+
+			// The collision world updated first, the step then finds it up to date and the rest is what the threads share
+			double broadphase_time = 0.0;
+			double solver_time = 0.0;
+			for (int step = 0; step < measured_steps; step++)
+			{
+				const Clock::time_point broadphase_start = Clock::now();
+				scene->GetCollisionWorld().Update();
+				const Clock::time_point solver_start = Clock::now();
+				world.Step(PhysicsStep, &workers);
+
+				broadphase_time += std::chrono::duration<double, std::milli>(solver_start - broadphase_start).count();
+				solver_time += ElapsedMilliseconds(solver_start);
+			}
+			broadphase_time /= measured_steps;
+			solver_time /= measured_steps;
+
+			// Compared bit for bit, the threads must not change the order of any computation
+			std::vector<Maths::Vector2f> positions;
+			for (const GameObject* game_object : scene->GetGameObjects())
+				positions.push_back(game_object->GetPosition());
+
+			if (thread_count == 1)
+			{
+				reference = positions;
+				single_solver_time = solver_time;
+				single_total_time = broadphase_time + solver_time;
+			}
+			const bool same_positions = positions == reference;
+			same = same && same_positions;
+
+			std::cout << std::setw(8) << thread_count << std::setw(14) << broadphase_time << std::setw(12) << solver_time << std::setw(9) << single_solver_time / solver_time << "x"
+				<< std::setw(12) << broadphase_time + solver_time << std::setw(9) << single_total_time / (broadphase_time + solver_time) << "x"
+				<< std::setw(14) << (same_positions ? "yes" : "NO") << "\n";
+			delete scene;
+		}
+
+		// Threads past the cores take turns, their speedup says nothing of the parallel stages
+		if (static_cast<unsigned int>(_max_threads) > std::thread::hardware_concurrency())
+			std::cout << "Only " << std::thread::hardware_concurrency() << " hardware threads, the speedup of more threads is not measured\n";
+
+		if (!same)
+		{
+			std::cerr << "Bodies move differently with more threads\n";
+			return 1;
+		}
+		return 0;
+	}
+
+	/**
+	 * \class CollisionCounter
+	 * \brief Counts the collision callbacks of its game object, for the filter benchmark.
+	 */
+	class CollisionCounter final : public Component
+	{
+	public:
+		std::size_t* count = nullptr;
+
+		void OnCollision(SquareCollider& _collider, SquareCollider& _other) override { ++*count; }
+	};
+
+	constexpr std::uint32_t EnemyLayer = 1;
+	constexpr std::uint32_t BulletLayer = 2;
+
+	/**
+	 * \brief Creates an enemy or a bullet.
+	 * \param _scene The scene.
+	 * \param _position The position of the game object.
+	 * \param _is_bullet Whether it is a bullet, smaller than an enemy.
+	 * \param _filtered Whether it goes on its layer, a trigger for a bullet, or stays on the default layer.
+	 * \param _callbacks Incremented by every collision callback.
+	 * \return The game object.
+	 */
+	GameObject* CreateFilterObject(Scene* _scene, const Maths::Vector2f& _position, const bool _is_bullet, const bool _filtered, std::size_t& _callbacks)
+	{
+		GameObject* game_object = _scene->CreateGameObject(_is_bullet ? "Bullet" : "Enemy");
+		game_object->SetPosition(_position);
+
+		// The layer is set once attached, as a game spawning a prefab does
+		SquareCollider* square_collider = game_object->CreateComponent<SquareCollider>();
+		square_collider->SetWidth(_is_bullet ? 6.0f : 24.0f);
+		square_collider->SetHeight(_is_bullet ? 6.0f : 24.0f);
+		if (_filtered)
+		{
+			square_collider->SetLayer(_is_bullet ? BulletLayer : EnemyLayer);
+			square_collider->SetTrigger(_is_bullet);
+		}
+
+		game_object->CreateComponent<CollisionCounter>()->count = &_callbacks;
+		return game_object;
+	}
+
+	/**
+	 * \brief Builds enemies spread over the world and bullets fired in bursts from a few guns.
+	 * \param _positions The positions of the enemies, then of the bullets.
+	 * \param _enemy_count The number of enemies first in the positions.
+	 * \param _filtered Whether the bullets are triggers on their own layer, or everything is on the default layer.
+	 * \param _broadphase The broadphase of the collision world.
+	 * \param _callbacks Incremented by every collision callback.
+	 * \return The scene, to delete.
+	 */
+	Scene* BuildFilterScene(const std::vector<Maths::Vector2f>& _positions, const std::size_t _enemy_count, const bool _filtered, const CollisionWorld::Broadphase _broadphase, std::size_t& _callbacks)
+	{
+		Scene* scene = new Scene("FilterScene");
+		scene->GetCollisionWorld().SetBroadphase(_broadphase);
+		scene->ReserveGameObjects(_positions.size());
+
+		for (std::size_t i = 0; i < _positions.size(); i++)
+			CreateFilterObject(scene, _positions[i], i >= _enemy_count, _filtered, _callbacks);
+		return scene;
+	}
+
+	int FilterBench(const int _enemy_count, const int _bullet_count)
+	{
+		using namespace Maths;
+
+		constexpr int frames = 120;
+		constexpr int gun_count = 16;
+		constexpr float bullet_speed = 4.0f;
+		constexpr int bullet_life = 90;
+
+		const std::size_t enemy_count = static_cast<std::size_t>(_enemy_count);
+		const std::size_t count = enemy_count + static_cast<std::size_t>(_bullet_count);
+		const float world_size = std::sqrt(static_cast<float>(_enemy_count)) * 64.0f + 512.0f;
+
+		std::mt19937 random(42);
+		std::uniform_real_distribution<float> spread_distribution(0.0f, world_size);
+		std::uniform_real_distribution<float> angle_distribution(0.0f, 2.0f * std::numbers::pi_v<float>);
+		std::uniform_int_distribution<int> age_distribution(0, bullet_life - 1);
+
+		std::vector<Vector2f> guns(gun_count);
+		for (Vector2f& gun : guns)
+			gun = Vector2f(spread_distribution(random), spread_distribution(random));
+
+		// Enemies wander, bullets leave their gun in every direction and are fired again at the end of their life
+		std::vector<Vector2f> start(count);
+		std::vector<Vector2f> velocities(count);
+		std::vector<int> ages(count, 0);
+		for (std::size_t i = 0; i < count; i++)
+		{
+			const float angle = angle_distribution(random);
+			const Vector2f direction(std::cos(angle), std::sin(angle));
+			if (i < enemy_count)
+			{
+				start[i] = Vector2f(spread_distribution(random), spread_distribution(random));
+				velocities[i] = direction;
+			}
+			else
+			{
+				start[i] = guns[i % guns.size()];
+				velocities[i] = direction * bullet_speed;
+				ages[i] = age_distribution(random);
+			}
+		}
+
+		const auto position_at = [&](const std::size_t _index, const int _frame)
+		{
+			if (_index < enemy_count)
+				return start[_index] + velocities[_index] * static_cast<float>(_frame);
+			return start[_index] + velocities[_index] * static_cast<float>((ages[_index] + _frame) % bullet_life);
+		};
+
+		const auto is_bullet = [&](const ColliderId _id) { return _id >= enemy_count; };
+
+		std::cout << _enemy_count << " enemies and " << _bullet_count << " bullets from " << gun_count << " guns, " << frames << " frames, per frame\n"
+			<< std::setw(10) << "layers" << std::setw(10) << "pairs" << std::setw(12) << "update ms" << std::setw(14) << "dispatch ms" << std::setw(12) << "callbacks" << "\n"
+			<< std::fixed << std::setprecision(3);
+
+		// Pairs left once the bullets stop colliding with each other, counted from the unfiltered pairs
+		std::vector<std::size_t> expected_pairs(frames);
+		double times[2] = {};
+		bool same = true;
+
+		for (const bool filtered : {false, true})
+		{
+			CollisionMatrix::Reset();
+			if (filtered)
+				CollisionMatrix::SetLayersCollide(BulletLayer, BulletLayer, false);
+
+			std::vector<Vector2f> positions(count);
+			for (std::size_t i = 0; i < count; i++)
+				positions[i] = position_at(i, 0);
+
+			std::size_t callbacks = 0;
+			std::size_t brute_callbacks = 0;
+			Scene* scene = BuildFilterScene(positions, enemy_count, filtered, CollisionWorld::Broadphase::SweepAndPrune, callbacks);
+			Scene* brute_scene = filtered ? BuildFilterScene(positions, enemy_count, filtered, CollisionWorld::Broadphase::BruteForce, brute_callbacks) : nullptr;
+			CollisionWorld& world = scene->GetCollisionWorld();
+			world.Update();
+
+			double update_time = 0.0;
+			double dispatch_time = 0.0;
+			std::size_t pairs = 0;
+
+			for (int frame = 0; frame < frames; frame++)
+			{
+				for (std::size_t i = 0; i < count; i++)
+				{
+					scene->GetGameObjects()[i]->SetPosition(position_at(i, frame + 1));
+					if (brute_scene)
+						brute_scene->GetGameObjects()[i]->SetPosition(position_at(i, frame + 1));
+				}
+
+				const Clock::time_point update_start = Clock::now();
+				world.Update();
+				const Clock::time_point dispatch_start = Clock::now();
+				world.DispatchCollisions();
+
+				update_time += std::chrono::duration<double, std::milli>(dispatch_start - update_start).count();
+				dispatch_time += ElapsedMilliseconds(dispatch_start);
+				pairs += world.GetPairs().size();
+
+				if (!filtered)
+				{
+					for (const CollisionPair& pair : world.GetPairs())
+					{
+						if (!is_bullet(pair.a) || !is_bullet(pair.b))
+							++expected_pairs[frame];
+					}
+				}
+				else
+				{
+					brute_scene->GetCollisionWorld().Update();
+					same = same && world.GetPairs().size() == expected_pairs[frame] && GetSortedPairKeys(world) == GetSortedPairKeys(brute_scene->GetCollisionWorld());
+				}
+			}
+
+			times[filtered ? 1 : 0] = update_time + dispatch_time;
+			std::cout << std::setw(10) << (filtered ? "filtered" : "all") << std::setw(10) << pairs / frames << std::setw(12) << update_time / frames
+				<< std::setw(14) << dispatch_time / frames << std::setw(12) << callbacks / frames << "\n";
+
+			delete scene;
+			delete brute_scene;
+		}
+
+		std::cout << "speedup " << std::setprecision(2) << (times[1] > 0.0 ? times[0] / times[1] : 0.0) << "x\n" << std::setprecision(3);
+
+		// Bullets replaced by new ones every frame, each setting its layer and trigger once attached,
+		// and an enemy becoming a trigger and back: only their own pairs are found again
+		const std::size_t bullet_count = count - enemy_count;
+		const std::size_t spawned_per_frame = std::max<std::size_t>(bullet_count / bullet_life, 1);
+		std::size_t spawn_callbacks = 0;
+		double spawn_time = 0.0;
+		std::size_t spawn_pairs = 0;
+		bool spawn_same = true;
+
+		if (bullet_count > 0 && enemy_count > 0)
+		{
+			std::vector<Vector2f> positions(count);
+			for (std::size_t i = 0; i < count; i++)
+				positions[i] = position_at(i, 0);
+
+			// Sweep and prune, then brute force as the reference
+			Scene* scenes[2] = {
+				BuildFilterScene(positions, enemy_count, true, CollisionWorld::Broadphase::SweepAndPrune, spawn_callbacks),
+				BuildFilterScene(positions, enemy_count, true, CollisionWorld::Broadphase::BruteForce, spawn_callbacks)};
+			std::vector<GameObject*> bullets[2];
+			for (int k = 0; k < 2; k++)
+			{
+				bullets[k].assign(scenes[k]->GetGameObjects().begin() + static_cast<std::ptrdiff_t>(enemy_count), scenes[k]->GetGameObjects().end());
+				scenes[k]->GetCollisionWorld().Update();
+			}
+
+			std::vector<Vector2f> bullet_velocities(velocities.begin() + static_cast<std::ptrdiff_t>(enemy_count), velocities.end());
+			std::size_t oldest = 0;
+
+			for (int frame = 0; frame < frames; frame++)
+			{
+				std::vector<Vector2f> spawn_positions(spawned_per_frame);
+				std::vector<Vector2f> spawn_velocities(spawned_per_frame);
+				for (std::size_t i = 0; i < spawned_per_frame; i++)
+				{
+					const float angle = angle_distribution(random);
+					spawn_positions[i] = guns[(oldest + i) % guns.size()];
+					spawn_velocities[i] = Vector2f(std::cos(angle), std::sin(angle)) * bullet_speed;
+				}
+
+				for (int k = 0; k < 2; k++)
+				{
+					Scene* scene = scenes[k];
+					const std::vector<GameObject*>& game_objects = scene->GetGameObjects();
+					for (std::size_t i = 0; i < enemy_count; i++)
+						game_objects[i]->SetPosition(position_at(i, frame + 1));
+					for (std::size_t i = 0; i < bullet_count; i++)
+						bullets[k][i]->SetPosition(bullets[k][i]->GetPosition() + bullet_velocities[i]);
+
+					const Clock::time_point spawn_start = Clock::now();
+					for (std::size_t i = 0; i < spawned_per_frame; i++)
+					{
+						const std::size_t slot = (oldest + i) % bullet_count;
+						scene->DestroyGameObject(bullets[k][slot]);
+						bullets[k][slot] = CreateFilterObject(scene, spawn_positions[i], true, true, spawn_callbacks);
+					}
+
+					SquareCollider* retagged = game_objects[static_cast<std::size_t>(frame / 2) % enemy_count]->GetComponent<SquareCollider>();
+					retagged->SetTrigger(frame % 2 == 0);
+
+					scene->GetCollisionWorld().Update();
+					if (k == 0)
+					{
+						spawn_time += ElapsedMilliseconds(spawn_start);
+						spawn_pairs += scene->GetCollisionWorld().GetPairs().size();
+					}
+				}
+
+				for (std::size_t i = 0; i < spawned_per_frame; i++)
+					bullet_velocities[(oldest + i) % bullet_count] = spawn_velocities[i];
+				oldest = (oldest + spawned_per_frame) % bullet_count;
+
+				spawn_same = spawn_same && GetSortedPairKeys(scenes[0]->GetCollisionWorld()) == GetSortedPairKeys(scenes[1]->GetCollisionWorld());
+			}
+
+			delete scenes[0];
+			delete scenes[1];
+
+			std::cout << std::setw(10) << "spawning" << std::setw(10) << spawn_pairs / frames << std::setw(12) << spawn_time / frames
+				<< "   (" << spawned_per_frame << " bullets spawned and 1 enemy retagged per frame, update and spawns)\n";
+		}
+		CollisionMatrix::Reset();
+
+		if (!same)
+		{
+			std::cerr << "Filtered pairs differ from the unfiltered pairs without bullet pairs\n";
+			return 1;
+		}
+		if (!spawn_same)
+		{
+			std::cerr << "Pairs of the spawned colliders differ from brute force\n";
+			return 1;
+		}
+		return 0;
+	}
+
+	int ParticleBench(const int _count)
+	{
+		using namespace Maths;
+
+		constexpr float delta_time = 1.0f / 60.0f;
+		constexpr int warm_frames = 240;
+		constexpr int frames = 300;
+		constexpr float min_lifetime = 1.0f;
+		constexpr float max_lifetime = 3.0f;
+		const Vector2f gravity(0.0f, 200.0f);
+
+		constexpr double frame_budget = 1000.0 / 60.0;
+
+		const std::size_t count = static_cast<std::size_t>(_count);
+		const Vector2Batch::SimdLevel supported = Vector2Batch::GetSupportedSimdLevel();
+		double best_time = std::numeric_limits<double>::max();
+
+		std::cout << "Emitter of up to " << count << " particles living " << min_lifetime << " to " << max_lifetime << " s, "
+			<< frames << " frames after " << warm_frames << " to fill, ms per frame\n"
+			<< std::setw(10) << "kernels" << std::setw(10) << "live" << std::setw(10) << "update" << std::setw(12) << "vertices" << std::setw(10) << "total"
+			<< std::setw(12) << "ns/particle" << std::setw(12) << "draw calls" << "\n" << std::fixed << std::setprecision(3);
+
+		for (int level = 0; level <= static_cast<int>(supported); level++)
+		{
+			Vector2Batch::SetSimdLevel(static_cast<Vector2Batch::SimdLevel>(level));
+
+			Scene* scene = new Scene("ParticleScene");
+			GameObject* game_object = scene->CreateGameObject("Emitter");
+			ParticleEmitter* emitter = game_object->CreateComponent<ParticleEmitter>();
+			emitter->SetSize(Vector2f(256.0f, 256.0f));
+			emitter->SetMaxParticles(static_cast<std::uint32_t>(count));
+			emitter->SetLifetime(min_lifetime, max_lifetime);
+			emitter->SetSpeed(50.0f, 150.0f);
+			emitter->SetDirection(-90.0f, 180.0f);
+			emitter->SetGravity(gravity);
+
+			// Curves of several keys, as an effect would have, they are sampled once into tables
+			const ParticleEmitter::SizeKey size_keys[] = {{0.0f, 1.0f}, {0.1f, 6.0f}, {0.6f, 4.0f}, {1.0f, 0.0f}};
+			const ParticleEmitter::ColorKey color_keys[] = {{0.0f, sf::Color(255, 255, 0)}, {0.3f, sf::Color(255, 128, 0)}, {0.7f, sf::Color(255, 0, 0)}, {1.0f, sf::Color(64, 64, 64, 0)}};
+			emitter->SetSizeOverLife(size_keys, std::size(size_keys));
+			emitter->SetColorOverLife(color_keys, std::size(color_keys));
+
+			// Slightly below the capacity at the mean lifetime, the emitter is never full
+			emitter->SetEmissionRate(static_cast<float>(count) * 0.95f * 2.0f / (min_lifetime + max_lifetime));
+
+			for (int frame = 0; frame < warm_frames; frame++)
+				emitter->Update(delta_time);
+
+			double update_time = 0.0;
+			double vertex_time = 0.0;
+			std::size_t live = 0;
+			for (int frame = 0; frame < frames; frame++)
+			{
+				const Clock::time_point update_start = Clock::now();
+				emitter->Update(delta_time);
+				const Clock::time_point vertex_start = Clock::now();
+				const sf::VertexArray& vertices = emitter->GetVertices();
+
+				update_time += std::chrono::duration<double, std::milli>(vertex_start - update_start).count();
+				vertex_time += ElapsedMilliseconds(vertex_start);
+				live += emitter->GetParticleCount();
+
+				if (vertices.getVertexCount() != emitter->GetParticleCount() * ParticleEmitter::VerticesPerParticle)
+				{
+					std::cerr << "The vertices do not match the live particles\n";
+					delete scene;
+					return 1;
+				}
+			}
+			update_time /= frames;
+			vertex_time /= frames;
+			live /= frames;
+
+			std::cout << std::setw(10) << Vector2Batch::GetSimdLevelName(static_cast<Vector2Batch::SimdLevel>(level)) << std::setw(10) << live
+				<< std::setw(10) << update_time << std::setw(12) << vertex_time << std::setw(10) << update_time + vertex_time
+				<< std::setw(12) << (update_time + vertex_time) * 1e6 / static_cast<double>(std::max<std::size_t>(live, 1)) << std::setw(12) << 1 << "\n";
+			best_time = std::min(best_time, update_time + vertex_time);
+			delete scene;
+		}
+		Vector2Batch::SetSimdLevel(supported);
+
+		// The same motion with a game object and a renderer per particle, capped, a scene of them takes long to build
+		const std::size_t object_count = std::min<std::size_t>(count, 100000);
+		Scene* scene = new Scene("ParticleObjectsScene");
+		scene->ReserveGameObjects(object_count);
+		std::vector<Vector2f> velocities(object_count);
+		std::mt19937 random(42);
+		std::uniform_real_distribution<float> speed_distribution(-100.0f, 100.0f);
+		for (std::size_t i = 0; i < object_count; i++)
+		{
+			GameObject* game_object = scene->CreateGameObject("Particle");
+			game_object->CreateComponent<RectangleShapeRenderer>()->SetSize(Vector2f(4.0f, 4.0f));
+			velocities[i] = Vector2f(speed_distribution(random), speed_distribution(random));
+		}
+
+		const Clock::time_point objects_start = Clock::now();
+		for (int frame = 0; frame < frames; frame++)
+		{
+			const std::vector<GameObject*>& game_objects = scene->GetGameObjects();
+			for (std::size_t i = 0; i < object_count; i++)
+			{
+				velocities[i] += gravity * delta_time;
+				game_objects[i]->SetPosition(game_objects[i]->GetPosition() + velocities[i] * delta_time);
+			}
+		}
+		const double objects_time = ElapsedMilliseconds(objects_start) / frames;
+
+		std::cout << std::setw(10) << "objects" << std::setw(10) << object_count << std::setw(10) << objects_time << std::setw(12) << "-" << std::setw(10) << objects_time
+			<< std::setw(12) << objects_time * 1e6 / static_cast<double>(std::max<std::size_t>(object_count, 1)) << std::setw(12) << object_count << "\n";
+		delete scene;
+
+		// Updating and building the vertices only, drawing them takes its part of the frame on top
+		std::cout << "Frame budget of " << frame_budget << " ms " << (best_time < frame_budget ? "met" : "not met") << " by the emitter before drawing, "
+			<< frame_budget - best_time << " ms left for the rest of the frame\n";
+		return 0;
+	}
+
+	/**
+	 * \class VirtualAnimator
+	 * \brief Advances its own frame in Update(), the same steps as AnimationSystem, for the animation benchmark.
+	 */
+	class VirtualAnimator final : public Component
+	{
+	public:
+		const AnimationClip* clip = nullptr;
+		SpriteRenderer* renderer = nullptr;
+		std::uint32_t frame = 0;
+		float timer = 0.0f;
+		float speed = 1.0f;
+
+		void Update(const float _delta_time) override
+		{
+			timer += _delta_time * speed;
+			if (timer < clip->frameDuration)
+				return;
+
+			const std::uint32_t steps = static_cast<std::uint32_t>(timer / clip->frameDuration);
+			timer -= static_cast<float>(steps) * clip->frameDuration;
+			frame = (frame + steps) % static_cast<std::uint32_t>(clip->frames.size());
+			renderer->SetSprite(clip->frames[frame]);
+		}
+	};
+
+	int AnimationBench(const int _count)
+	{
+		constexpr float delta_time = 1.0f / 60.0f;
+		constexpr int frames = 600;
+
+		// Clips of a walk, a run, an idle and an attack, frames without texture
+		std::vector<sf::Sprite> sprites(4 + 6 + 8 + 12);
+		std::vector<AnimationClip> clips(4);
+		const std::size_t frame_counts[] = {4, 6, 8, 12};
+		const float frame_durations[] = {0.15f, 0.1f, 0.12f, 0.08f};
+		std::size_t first_sprite = 0;
+		for (std::size_t i = 0; i < clips.size(); i++)
+		{
+			for (std::size_t frame = 0; frame < frame_counts[i]; frame++)
+				clips[i].frames.push_back(&sprites[first_sprite + frame]);
+			clips[i].frameDuration = frame_durations[i];
+			first_sprite += frame_counts[i];
+		}
+
+		std::mt19937 random(42);
+		std::uniform_real_distribution<float> speed_distribution(0.5f, 1.5f);
+		std::vector<float> speeds(static_cast<std::size_t>(_count));
+		for (float& speed : speeds)
+			speed = speed_distribution(random);
+
+		Scene* system_scene = new Scene("AnimationScene");
+		Scene* virtual_scene = new Scene("VirtualAnimationScene");
+		system_scene->ReserveGameObjects(speeds.size());
+		virtual_scene->ReserveGameObjects(speeds.size());
+
+		for (std::size_t i = 0; i < speeds.size(); i++)
+		{
+			const AnimationClip* clip = &clips[i % clips.size()];
+
+			GameObject* game_object = system_scene->CreateGameObject("Animated");
+			game_object->CreateComponent<SpriteRenderer>();
+			AnimatorComponent* animator = game_object->CreateComponent<AnimatorComponent>();
+			animator->SetSpeed(speeds[i]);
+			animator->Play(clip);
+
+			game_object = virtual_scene->CreateGameObject("Animated");
+			VirtualAnimator* virtual_animator = game_object->CreateComponent<VirtualAnimator>();
+			virtual_animator->renderer = game_object->CreateComponent<SpriteRenderer>();
+			virtual_animator->renderer->SetSprite(clip->frames[0]);
+			virtual_animator->clip = clip;
+			virtual_animator->speed = speeds[i];
+		}
+
+		AnimationSystem& system = system_scene->GetAnimationSystem();
+		double system_time = 0.0;
+		double virtual_time = 0.0;
+
+		for (int frame = 0; frame < frames; frame++)
+		{
+			const Clock::time_point system_start = Clock::now();
+			system.Update(delta_time);
+			const Clock::time_point virtual_start = Clock::now();
+			virtual_scene->Update(delta_time);
+
+			system_time += std::chrono::duration<double, std::milli>(virtual_start - system_start).count();
+			virtual_time += ElapsedMilliseconds(virtual_start);
+		}
+
+		// Both must show the same frame on every sprite
+		bool same = true;
+		for (std::size_t i = 0; i < speeds.size(); i++)
+		{
+			GameObject* system_object = system_scene->GetGameObjects()[i];
+			GameObject* virtual_object = virtual_scene->GetGameObjects()[i];
+			same = same && system_object->GetComponent<SpriteRenderer>()->GetSprite() == virtual_object->GetComponent<SpriteRenderer>()->GetSprite()
+				&& system_object->GetComponent<AnimatorComponent>()->GetFrame() == virtual_object->GetComponent<VirtualAnimator>()->frame;
+		}
+
+		std::cout << _count << " animated sprites, " << clips.size() << " clips, " << frames << " frames, ms per frame\n"
+			<< std::setw(22) << "animation system" << std::setw(22) << "virtual Update()" << std::setw(10) << "speedup" << std::setw(14) << "same frames" << "\n"
+			<< std::fixed << std::setprecision(3)
+			<< std::setw(22) << system_time / frames << std::setw(22) << virtual_time / frames
+			<< std::setw(9) << (system_time > 0.0 ? virtual_time / system_time : 0.0) << "x" << std::setw(14) << (same ? "yes" : "NO") << "\n";
+
+		delete system_scene;
+		delete virtual_scene;
+
+		if (!same)
+		{
+			std::cerr << "The animation system shows other frames than the virtual updates\n";
+			return 1;
+		}
+		return 0;
+	}
+}
+
+int main(const int _argc, char* _argv[])
+{
+	const std::vector<std::string> arguments(_argv + 1, _argv + _argc);
+
+	if (arguments.size() >= 3 && arguments[0] == "scene-bench")
+		return SceneBench(std::stoi(arguments[1]), arguments[2]);
+
+	if (arguments.size() >= 3 && arguments[0] == "scene-export")
+		return SceneExport(arguments[1], arguments[2]);
+
+	if (arguments.size() >= 2 && arguments[0] == "transition-bench")
+		return TransitionBench(std::stoi(arguments[1]));
+
+	if (arguments.size() >= 2 && arguments[0] == "snapshot-bench")
+		return SnapshotBench(std::stoi(arguments[1]));
+
+	if (arguments.size() >= 2 && arguments[0] == "input-bench")
+		return InputBench(std::stoi(arguments[1]));
+
+	if (arguments.size() >= 2 && arguments[0] == "vector-bench")
+		return VectorBench(std::stoi(arguments[1]));
+
+	if (arguments.size() >= 2 && arguments[0] == "transform-bench")
+		return TransformBench(std::stoi(arguments[1]));
+
+	if (arguments.size() >= 2 && arguments[0] == "rect-bench")
+		return RectBench(std::stoi(arguments[1]));
+
+	if (arguments.size() >= 3 && arguments[0] == "broadphase-bench")
+		return BroadphaseBench(std::stoi(arguments[1]), std::stoi(arguments[2]));
+
+	if (arguments.size() >= 3 && arguments[0] == "query-bench")
+		return QueryBench(std::stoi(arguments[1]), std::stoi(arguments[2]));
+
+	if (arguments.size() >= 2 && arguments[0] == "physics-bench")
+		return PhysicsBench(std::stoi(arguments[1]));
+
+	if (arguments.size() >= 3 && arguments[0] == "physics-threads")
+		return PhysicsThreadsBench(std::stoi(arguments[1]), std::stoi(arguments[2]));
+
+	if (arguments.size() >= 3 && arguments[0] == "filter-bench")
+		return FilterBench(std::stoi(arguments[1]), std::stoi(arguments[2]));
+
+	if (arguments.size() >= 2 && arguments[0] == "particle-bench")
+		return ParticleBench(std::stoi(arguments[1]));
+
+	if (arguments.size() >= 2 && arguments[0] == "animation-bench")
+		return AnimationBench(std::stoi(arguments[1]));
+
+	PrintUsage();
+	return 1;
+}
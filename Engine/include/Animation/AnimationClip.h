@@ -0,0 +1,22 @@
+#pragma once
+
+#include <vector>
+
+#include <SFML/Graphics/Sprite.hpp>
+
+/**
+ * \struct AnimationClip
+ * \brief Frames of an animation, sprites of a texture shown one after the other.
+ *
+ * The sprites belong to their texture, so frames follow it when it is packed into an atlas.
+ */
+struct AnimationClip
+{
+	std::vector<sf::Sprite*> frames;
+
+	/// Seconds each frame is shown, at a speed of 1.
+	float frameDuration = 0.1f;
+
+	/// Starts over after the last frame, otherwise stays on it.
+	bool loop = true;
+};
@@ -0,0 +1,93 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+struct AnimationClip;
+class SpriteRenderer;
+
+using AnimationId = std::uint32_t;
+constexpr AnimationId InvalidAnimation = 0xFFFFFFFF;
+
+/**
+ * \class AnimationSystem
+ * \brief The animators of a scene, all advanced by one loop over a packed array.
+ *
+ * Animators register themselves when attached to a game object of the scene. A frame
+ * change sets the sprite of the linked SpriteRenderer, nothing is written on the other
+ * frames. Removing an animator moves the last one to its place, the array stays packed.
+ */
+class AnimationSystem
+{
+public:
+	/**
+	 * \brief Adds an animator, playing nothing until Play().
+	 * \return The id of the animator in the system.
+	 */
+	AnimationId Add();
+
+	void Remove(AnimationId _id);
+
+	/**
+	 * \brief Plays a clip from its first frame.
+	 * \param _id The id of the animator.
+	 * \param _clip The clip, which must outlive the animation, nullptr to stop.
+	 */
+	void Play(AnimationId _id, const AnimationClip* _clip);
+
+	/**
+	 * \brief Sets the renderer whose sprite is the current frame, the current frame is written at once.
+	 * \param _id The id of the animator.
+	 * \param _renderer The renderer, nullptr once removed.
+	 */
+	void SetRenderer(AnimationId _id, SpriteRenderer* _renderer);
+
+	/// Playback speed, 1 for the frame duration of the clip, 0 to pause.
+	float GetSpeed(const AnimationId _id) const { return animations[indices[_id]].speed; }
+	void SetSpeed(const AnimationId _id, const float _speed) { animations[indices[_id]].speed = _speed; }
+
+	const AnimationClip* GetClip(const AnimationId _id) const { return animations[indices[_id]].clip; }
+	std::uint32_t GetFrame(const AnimationId _id) const { return animations[indices[_id]].frame; }
+
+	/**
+	 * \brief Checks a clip which does not loop reached its last frame.
+	 */
+	bool IsFinished(AnimationId _id) const;
+
+	/**
+	 * \brief Advances every animator.
+	 * \param _delta_time Seconds since the last update.
+	 */
+	void Update(float _delta_time);
+
+	std::size_t GetAnimationCount() const { return animations.size(); }
+
+private:
+	/**
+	 * \struct Animation
+	 * \brief The state of an animator, what the update loop reads.
+	 */
+	struct Animation
+	{
+		const AnimationClip* clip = nullptr;
+		SpriteRenderer* renderer = nullptr;
+
+		std::uint32_t frame = 0;
+
+		/// Time spent on the current frame.
+		float timer = 0.0f;
+
+		float speed = 1.0f;
+		AnimationId id = InvalidAnimation;
+	};
+
+	void ApplyFrame(const Animation& _animation) const;
+
+	/// Animators in no particular order, packed.
+	std::vector<Animation> animations;
+
+	/// Index in animations of every id.
+	std::vector<std::uint32_t> indices;
+
+	std::vector<AnimationId> freeIds;
+};
@@ -4,10 +4,14 @@
 
 #include "GameObject.h"
 
+class Archive;
 class GameObject;
+class SquareCollider;
 
 class Component
 {
+	friend class ComponentRegistry;
+
 public:
 	Component() = default;
 	explicit Component(GameObject* _owner);
@@ -31,9 +35,41 @@ public:
 	virtual void Destroy() {}
 	virtual void Finalize() {}
 
+	/**
+	 * \brief Called once the component is added to its owner, and its owner to a scene if it has one.
+	 */
+	virtual void OnAttach() {}
+
+	/**
+	 * \brief Called when the component is removed from its owner or its owner is deleted.
+	 */
+	virtual void OnDetach() {}
+
+	/**
+	 * \brief Called every frame a collider of the owner overlaps another collider its layer collides with, triggers included.
+	 * \param _collider The collider of the owner.
+	 * \param _other The collider it overlaps.
+	 */
+	virtual void OnCollision(SquareCollider& _collider, SquareCollider& _other) {}
+
+	/**
+	 * \brief Describes the state of the component to an archive, which writes, reads or exports it.
+	 * Overrides call the Serialize() of their base class first.
+	 * \param _archive The archive visiting the fields.
+	 */
+	virtual void Serialize(Archive& _archive) {}
+
 	GameObject* GetOwner() const { return owner; }
 	void SetOwner(GameObject* _owner) { owner = _owner; }
 
+	/**
+	 * \brief Checks if the component lives in a pool allocated by a scene load, it must not be deleted then.
+	 * \return True if the component is pooled.
+	 */
+	bool IsPooled() const { return pooled; }
+
 private:
 	GameObject* owner = nullptr;
+
+	bool pooled = false;
 };
@@ -10,7 +10,15 @@ public:
 	void SetSize(const Maths::Vector2f& _size) { size = _size; }
 
 	void Render(sf::RenderWindow* _window) override;
+	void Serialize(Archive& _archive) override;
 
 protected:
+	/**
+	 * \brief Draws to the window and counts the draw call.
+	 * \param _window The window.
+	 * \param _drawable What to draw.
+	 */
+	static void Draw(sf::RenderWindow* _window, const sf::Drawable& _drawable);
+
 	Maths::Vector2f size;
 };
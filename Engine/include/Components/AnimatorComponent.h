@@ -0,0 +1,66 @@
+#pragma once
+
+#include <cstdint>
+
+#include "Component.h"
+#include "Animation/AnimationSystem.h"
+
+struct AnimationClip;
+class SpriteRenderer;
+
+/**
+ * \class AnimatorComponent
+ * \brief Plays an AnimationClip on the SpriteRenderer of its game object.
+ *
+ * The animator has no Update(): the AnimationSystem of the scene advances every animator
+ * in one loop. Clips belong to their AnimatedTileSet and are not serialized, play them
+ * again after loading a scene.
+ */
+class AnimatorComponent : public Component
+{
+public:
+	AnimatorComponent() = default;
+	~AnimatorComponent() override = default;
+
+	/**
+	 * \brief Plays a clip from its first frame.
+	 * \param _clip The clip, nullptr to stop.
+	 */
+	void Play(const AnimationClip* _clip);
+
+	const AnimationClip* GetClip() const { return clip; }
+
+	/**
+	 * \brief Gets the index of the frame shown in the clip.
+	 */
+	std::uint32_t GetFrame() const;
+
+	/**
+	 * \brief Checks a clip which does not loop reached its last frame.
+	 */
+	bool IsFinished() const;
+
+	/// Playback speed, 1 for the frame duration of the clip, 0 to pause.
+	float GetSpeed() const { return speed; }
+	void SetSpeed(float _speed);
+
+	/**
+	 * \brief Links the renderer of the game object, called by SpriteRenderer when attached or detached.
+	 * \param _renderer The renderer, nullptr once removed.
+	 */
+	void SetRenderer(SpriteRenderer* _renderer);
+
+	void OnAttach() override;
+	void OnDetach() override;
+
+	void Serialize(Archive& _archive) override;
+
+private:
+	/// Clip and speed while not in a scene, kept in sync with the animation system otherwise.
+	const AnimationClip* clip = nullptr;
+	float speed = 1.0f;
+
+	/// System of the scene of the owner, nullptr while not attached to a scene.
+	AnimationSystem* system = nullptr;
+	AnimationId animationId = InvalidAnimation;
+};
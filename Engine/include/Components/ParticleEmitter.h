@@ -0,0 +1,216 @@
+#pragma once
+
+#include <cstdint>
+#include <random>
+#include <vector>
+
+#include <SFML/Graphics/Color.hpp>
+#include <SFML/Graphics/VertexArray.hpp>
+
+#include "ARendererComponent.h"
+#include "Maths/Vector2Batch.h"
+
+/**
+ * \class ParticleEmitter
+ * \brief Emits untextured square particles from the area of its size, drawn in one draw call.
+ *
+ * Particles are not game objects: their positions, velocities and ages live in arrays of
+ * floats updated by the Vector2Batch kernels, a dead particle is replaced by the last one.
+ * Particles are in scene space, they stay where they are when the emitter moves. Their size
+ * and color follow curves of up to MaxCurveKeys keys over their life, linear between keys.
+ */
+class ParticleEmitter : public ARendererComponent
+{
+public:
+	/// Keys of a size or color curve at most.
+	static constexpr std::size_t MaxCurveKeys = 8;
+
+	/// Corners of the quad of a particle in the vertex array.
+	static constexpr std::size_t VerticesPerParticle = 4;
+
+	/**
+	 * \struct SizeKey
+	 * \brief The width of the particles at a point of their life.
+	 */
+	struct SizeKey
+	{
+		/// Fraction of the life, 0 at birth and 1 at death.
+		float time = 0.0f;
+		float size = 0.0f;
+	};
+
+	/**
+	 * \struct ColorKey
+	 * \brief The color of the particles at a point of their life.
+	 */
+	struct ColorKey
+	{
+		/// Fraction of the life, 0 at birth and 1 at death.
+		float time = 0.0f;
+		sf::Color color;
+	};
+
+	ParticleEmitter();
+	~ParticleEmitter() override = default;
+
+	/// Particles emitted per second while emitting.
+	float GetEmissionRate() const { return emissionRate; }
+	void SetEmissionRate(const float _emission_rate) { emissionRate = _emission_rate; }
+
+	bool IsEmitting() const { return emitting; }
+	void SetEmitting(const bool _emitting) { emitting = _emitting; }
+
+	std::uint32_t GetMaxParticles() const { return maxParticles; }
+
+	/**
+	 * \brief Sets how many particles may be alive at once, the arrays are allocated for them here.
+	 * \param _max_particles The capacity, particles past it are dropped.
+	 */
+	void SetMaxParticles(std::uint32_t _max_particles);
+
+	/**
+	 * \brief Sets the lifetime of the particles, picked for each one between the two values.
+	 * \param _min The shortest lifetime in seconds, above 0.
+	 * \param _max The longest lifetime in seconds.
+	 */
+	void SetLifetime(float _min, float _max);
+
+	/**
+	 * \brief Sets the initial speed of the particles, picked for each one between the two values.
+	 * \param _min The lowest speed in pixels per second.
+	 * \param _max The highest speed in pixels per second.
+	 */
+	void SetSpeed(float _min, float _max);
+
+	/**
+	 * \brief Sets the direction the particles are emitted in, added to the rotation of the owner.
+	 * \param _direction The angle in degrees, 0 to the right.
+	 * \param _spread The angle in degrees the direction varies by, on each side.
+	 */
+	void SetDirection(float _direction, float _spread);
+
+	/// Acceleration of every particle, in pixels per second squared.
+	Maths::Vector2f GetGravity() const { return gravity; }
+	void SetGravity(const Maths::Vector2f& _gravity) { gravity = _gravity; }
+
+	/**
+	 * \brief Sets the size of the particles at their birth and at their death, linear in between.
+	 * \param _start The width of a new particle.
+	 * \param _end The width of a particle about to die.
+	 */
+	void SetSizeOverLife(float _start, float _end);
+
+	/**
+	 * \brief Sets the size of the particles over their life, linear between keys.
+	 * \param _keys The keys, sorted here by time. Before the first and after the last one the size is the one of that key.
+	 * \param _count The number of keys, from 1 to MaxCurveKeys, the ones past it are dropped.
+	 */
+	void SetSizeOverLife(const SizeKey* _keys, std::size_t _count);
+
+	const SizeKey* GetSizeKeys() const { return sizeKeys; }
+	std::size_t GetSizeKeyCount() const { return sizeKeyCount; }
+
+	/**
+	 * \brief Sets the color of the particles at their birth and at their death, linear in between.
+	 * \param _start The color of a new particle.
+	 * \param _end The color of a particle about to die, transparent to fade out.
+	 */
+	void SetColorOverLife(const sf::Color& _start, const sf::Color& _end);
+
+	/**
+	 * \brief Sets the color of the particles over their life, linear between keys.
+	 * \param _keys The keys, sorted here by time. Before the first and after the last one the color is the one of that key.
+	 * \param _count The number of keys, from 1 to MaxCurveKeys, the ones past it are dropped.
+	 */
+	void SetColorOverLife(const ColorKey* _keys, std::size_t _count);
+
+	const ColorKey* GetColorKeys() const { return colorKeys; }
+	std::size_t GetColorKeyCount() const { return colorKeyCount; }
+
+	/**
+	 * \brief Emits particles at once, on top of the emission rate.
+	 * \param _count The number of particles, fewer if the emitter is full.
+	 */
+	void Emit(std::uint32_t _count);
+
+	/**
+	 * \brief Kills every particle.
+	 */
+	void Clear();
+
+	std::size_t GetParticleCount() const { return count; }
+
+	/**
+	 * \brief Gets the quads of the live particles, rebuilt after an update.
+	 * \return VerticesPerParticle vertices per particle.
+	 */
+	const sf::VertexArray& GetVertices();
+
+	void Update(float _delta_time) override;
+	void Render(sf::RenderWindow* _window) override;
+	void Serialize(Archive& _archive) override;
+
+private:
+	/// Entries of the size and color curves, looked up by the age of a particle.
+	static constexpr std::size_t CurveSteps = 64;
+
+	void Spawn(std::uint32_t _count);
+
+	/**
+	 * \brief Keeps between 1 and MaxCurveKeys keys and sorts them by time, after they were set or loaded.
+	 */
+	void SortKeys();
+
+	/**
+	 * \brief Samples the size and color curves into their tables.
+	 */
+	void BuildCurves();
+
+	/**
+	 * \brief Moves the last particle to an index.
+	 * \param _index The index of a dead particle.
+	 */
+	void RemoveParticle(std::size_t _index);
+
+	float emissionRate = 50.0f;
+	bool emitting = true;
+	std::uint32_t maxParticles = 1000;
+
+	float minLifetime = 1.0f;
+	float maxLifetime = 2.0f;
+	float minSpeed = 50.0f;
+	float maxSpeed = 100.0f;
+	float direction = -90.0f;
+	float spread = 30.0f;
+	Maths::Vector2f gravity;
+
+	SizeKey sizeKeys[MaxCurveKeys] = {{0.0f, 4.0f}, {1.0f, 1.0f}};
+	std::uint32_t sizeKeyCount = 2;
+	ColorKey colorKeys[MaxCurveKeys] = {{0.0f, sf::Color::White}, {1.0f, sf::Color(255, 255, 255, 0)}};
+	std::uint32_t colorKeyCount = 2;
+
+	/// Particles left to emit, the fraction of a particle not emitted by the last update.
+	float emissionDebt = 0.0f;
+
+	std::size_t count = 0;
+	Maths::Vector2Array positions;
+	Maths::Vector2Array velocities;
+
+	/// Fraction of its lifetime a particle lived, it dies at 1.
+	std::vector<float> ages;
+
+	/// Fraction of its lifetime a particle lives per second.
+	std::vector<float> ageRates;
+
+	/// Indices of the particles dying during an update, found by the batch that ages them.
+	std::vector<std::uint32_t> deadIndices;
+
+	float halfSizes[CurveSteps] = {};
+	sf::Color colors[CurveSteps];
+	bool curvesDirty = true;
+
+	sf::VertexArray vertices;
+	bool verticesDirty = true;
+
+	std::minstd_rand random;
+};
@@ -7,16 +7,17 @@
 class RectangleShapeRenderer : public ARendererComponent
 {
 public:
-	RectangleShapeRenderer();
-	~RectangleShapeRenderer() override;
+	RectangleShapeRenderer() = default;
+	~RectangleShapeRenderer() override = default;
 
 	void SetColor(const sf::Color& _color) { color = _color; }
 
 	void Render(sf::RenderWindow* _window) override;
 	void OnDebug() override;
+	void Serialize(Archive& _archive) override;
 
 private:
 	sf::Color color = sf::Color::White;
 
-	sf::RectangleShape* shape = nullptr;
+	sf::RectangleShape shape;
 };
@@ -0,0 +1,119 @@
+#pragma once
+
+#include <cstdint>
+
+#include "Component.h"
+#include "Maths/Vector2.h"
+#include "Physics/PhysicsWorld.h"
+
+class SquareCollider;
+
+/**
+ * \class Rigidbody2D
+ * \brief Moves its game object with the physics of the scene, pushed out of the other colliders.
+ *
+ * Needs a SquareCollider on the same game object. Bodies do not rotate, their collider
+ * stays axis-aligned. Colliders without a body are static and never move.
+ */
+class Rigidbody2D : public Component
+{
+public:
+	/**
+	 * \enum BodyType
+	 * \brief How the body reacts to the others.
+	 */
+	enum class BodyType : std::uint8_t
+	{
+		/// Moved by gravity, forces and contacts.
+		Dynamic,
+
+		/// Moved by its velocity only, pushes dynamic bodies like a static collider would.
+		Kinematic
+	};
+
+	Rigidbody2D() = default;
+	~Rigidbody2D() override = default;
+
+	BodyType GetBodyType() const { return bodyType; }
+	void SetBodyType(const BodyType _body_type) { bodyType = _body_type; WakeUp(); }
+
+	float GetMass() const { return mass; }
+	float GetInverseMass() const { return bodyType == BodyType::Dynamic && mass > 0.0f ? 1.0f / mass : 0.0f; }
+	void SetMass(const float _mass) { mass = _mass; }
+
+	float GetGravityScale() const { return gravityScale; }
+	void SetGravityScale(const float _gravity_scale) { gravityScale = _gravity_scale; }
+
+	/// Fraction of the velocity lost per second.
+	float GetLinearDamping() const { return linearDamping; }
+	void SetLinearDamping(const float _linear_damping) { linearDamping = _linear_damping; }
+
+	float GetFriction() const { return friction; }
+	void SetFriction(const float _friction) { friction = _friction; }
+
+	/// Bounciness, 0 stops on impact and 1 bounces back at the same speed.
+	float GetRestitution() const { return restitution; }
+	void SetRestitution(const float _restitution) { restitution = _restitution; }
+
+	bool IsContinuous() const { return continuous; }
+
+	/**
+	 * \brief Sweeps the body along its move every step, so it cannot pass through a thin collider.
+	 * Costs a tree query per step when the body moves more than half its size, for bullets and fast players.
+	 * \param _continuous Whether the body is swept.
+	 */
+	void SetContinuous(const bool _continuous) { continuous = _continuous; }
+
+	bool IsSleepAllowed() const { return allowSleep; }
+	void SetSleepAllowed(bool _allow_sleep);
+
+	Maths::Vector2f GetVelocity() const;
+	void SetVelocity(const Maths::Vector2f& _velocity);
+
+	/**
+	 * \brief Changes the velocity at once, scaled by the inverse mass.
+	 * \param _impulse The impulse.
+	 */
+	void ApplyImpulse(const Maths::Vector2f& _impulse);
+
+	/**
+	 * \brief Accelerates the body during the next step, scaled by the inverse mass.
+	 * \param _force The force.
+	 */
+	void ApplyForce(const Maths::Vector2f& _force);
+
+	/**
+	 * \brief Wakes the body and its island, needed after moving a sleeping body by hand.
+	 */
+	void WakeUp();
+	bool IsAwake() const;
+
+	/**
+	 * \brief Links the collider of the game object, called by SquareCollider when attached or detached.
+	 * \param _collider The collider, nullptr once removed.
+	 */
+	void SetCollider(SquareCollider* _collider);
+
+	void OnAttach() override;
+	void OnDetach() override;
+
+	void Serialize(Archive& _archive) override;
+
+private:
+	BodyType bodyType = BodyType::Dynamic;
+
+	float mass = 1.0f;
+	float gravityScale = 1.0f;
+	float linearDamping = 0.0f;
+	float friction = 0.4f;
+	float restitution = 0.0f;
+
+	bool continuous = false;
+	bool allowSleep = true;
+
+	/// Velocity while not in a scene, the physics world holds it otherwise.
+	Maths::Vector2f velocity;
+
+	PhysicsWorld* world = nullptr;
+	BodyId bodyId = InvalidBody;
+};
@@ -9,10 +9,15 @@ public:
 	SpriteRenderer();
 	~SpriteRenderer() override;
 
+	/// The sprite belongs to its Texture and is not serialized, set it again after loading a scene.
 	void SetSprite(sf::Sprite* _sprite) { sprite = _sprite; }
+	sf::Sprite* GetSprite() const { return sprite; }
 
 	void Render(sf::RenderWindow* _window) override;
 
+	void OnAttach() override;
+	void OnDetach() override;
+
 private:
 	sf::Sprite* sprite = nullptr;
 };
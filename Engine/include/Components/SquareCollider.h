@@ -1,6 +1,11 @@
 #pragma once
 
 #include "Component.h"
+#include "Maths/Rect.h"
+#include "Physics/CollisionFilter.h"
+#include "Physics/CollisionPair.h"
+
+class CollisionWorld;
 
 class SquareCollider : public Component
 {
@@ -14,8 +19,74 @@ public:
 	float GetWidth() const { return width; }
 	float GetHeight() const { return height; }
 
-	void SetWidth(const float _width) { width = _width; }
-	void SetHeight(const float _height) { height = _height; }
+	void SetWidth(const float _width) { width = _width; Refresh(); }
+	void SetHeight(const float _height) { height = _height; Refresh(); }
+
+	bool IsStatic() const { return isStatic; }
+
+	/**
+	 * \brief Marks the collider as static, its bounds are then only read again after Refresh().
+	 * Most colliders of a level never move, the collision world skips them every frame.
+	 * \param _is_static Whether the collider is static.
+	 */
+	void SetStatic(bool _is_static);
+
+	/**
+	 * \brief Tells the collision world to read the bounds again, after a static collider moved.
+	 */
+	void Refresh();
+
+	std::uint32_t GetLayer() const { return layer; }
+
+	/**
+	 * \brief Moves the collider to a layer, the CollisionMatrix tells which layers it collides with.
+	 * \param _layer The layer, from 0 to CollisionLayerCount - 1.
+	 */
+	void SetLayer(std::uint32_t _layer);
+
+	std::uint32_t GetMask() const { return mask; }
+
+	/**
+	 * \brief Restricts the layers the collider collides with, on top of the CollisionMatrix.
+	 * \param _mask One bit per layer.
+	 */
+	void SetMask(std::uint32_t _mask);
+
+	bool IsTrigger() const { return isTrigger; }
+
+	/**
+	 * \brief Makes the collider a trigger: its collisions are reported, but bodies go through it.
+	 * Two triggers never collide.
+	 * \param _is_trigger Whether the collider is a trigger.
+	 */
+	void SetTrigger(bool _is_trigger);
+
+	/**
+	 * \brief Gets the rectangle covered by the collider, from the position of its owner.
+	 * \return The bounds in scene space.
+	 */
+	Maths::Rectf GetBounds() const;
+
+	/// Id in the collision world of the scene, InvalidCollider while not attached to a scene.
+	ColliderId GetColliderId() const { return colliderId; }
+
+	void OnAttach() override;
+	void OnDetach() override;
+
+	void Serialize(Archive& _archive) override;
 
 	static bool IsColliding(const SquareCollider& _collider_a, const SquareCollider& _collider_b);
+
+private:
+	void RefreshFilter();
+
+	bool isStatic = false;
+
+	std::uint32_t layer = 0;
+	std::uint32_t mask = AllLayers;
+	bool isTrigger = false;
+
+	/// World of the scene of the owner, nullptr while not attached to a scene.
+	CollisionWorld* world = nullptr;
+	ColliderId colliderId = InvalidCollider;
 };
@@ -1,22 +1,59 @@
 #pragma once
 
+#include <array>
+#include <cstdint>
+
 #include "ModuleManager.h"
 
 class Engine
 {
 public:
+	/**
+	 * \enum FramePhase
+	 * \brief Parts of a frame timed by Run().
+	 */
+	enum class FramePhase : std::uint8_t
+	{
+		Update,
+
+		/// From PreRender() to PostRender().
+		Render,
+
+		/// Present(), including the wait for the vertical sync.
+		Present,
+
+		Count
+	};
+
 	static Engine* GetInstance();
 
 	void Init() const;
-	void Run() const;
+	void Run();
 	void Quit() { shouldQuit = true; }
 
+	/**
+	 * \brief Runs without window nor rendering, frames only update. Must be set before Init().
+	 * \param _headless True to run headless.
+	 */
+	void SetHeadless(const bool _headless) { headless = _headless; }
+	bool IsHeadless() const { return headless; }
+
 	ModuleManager* GetModuleManager() const { return moduleManager; }
 
+	/**
+	 * \brief Gets the duration of a phase during the last completed frame.
+	 * \param _phase The phase.
+	 * \return The duration in seconds.
+	 */
+	float GetPhaseTime(const FramePhase _phase) const { return phaseTimes[static_cast<std::size_t>(_phase)]; }
+
 private:
 	static Engine* instance;
 
 	ModuleManager* moduleManager = new ModuleManager;
 
 	bool shouldQuit = false;
+	bool headless = false;
+
+	std::array<float, static_cast<std::size_t>(FramePhase::Count)> phaseTimes = {};
 };
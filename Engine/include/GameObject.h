@@ -3,9 +3,12 @@
 #include <vector>
 
 #include "Component.h"
+#include "Maths/Transform2D.h"
 #include "Maths/Vector2.h"
 
 class Component;
+class Scene;
+class SquareCollider;
 
 class GameObject
 {
@@ -13,15 +16,33 @@ public:
 	GameObject() = default;
 	~GameObject();
 
-	std::string GetName() const { return name; }
+	const std::string& GetName() const { return name; }
 	Maths::Vector2<float> GetPosition() const { return position; }
 	float GetRotation() const { return rotation; }
 	Maths::Vector2<float> GetScale() const { return scale; }
 
-	void SetName(const std::string& _name) { name = _name; }
-	void SetPosition(const Maths::Vector2<float>& _position) { position = _position; }
-	void SetRotation(const float _rotation) { rotation = _rotation; }
-	void SetScale(const Maths::Vector2<float>& _scale) { scale = _scale; }
+	/**
+	 * \brief Gets the scene that created the game object.
+	 * \return The scene, or nullptr for a game object created on its own.
+	 */
+	Scene* GetScene() const { return scene; }
+	void SetScene(Scene* _scene) { scene = _scene; }
+
+	/**
+	 * \brief Renames the game object, the scene is told so that the caches of its names are rebuilt.
+	 * \param _name The new name.
+	 */
+	void SetName(const std::string& _name);
+	void SetPosition(const Maths::Vector2<float>& _position) { position = _position; transformDirty = true; }
+	void SetRotation(const float _rotation) { rotation = _rotation; transformDirty = true; }
+	void SetScale(const Maths::Vector2<float>& _scale) { scale = _scale; transformDirty = true; }
+
+	/**
+	 * \brief Gets the transform from the object space to the scene space, rotation in degrees as SFML.
+	 * Rebuilt after the position, rotation or scale changed, the sine and cosine only when the rotation did.
+	 * \return The transform, valid until the next change.
+	 */
+	const Maths::Transform2D& GetTransform() const;
 
 	template<typename T>
 	T* CreateComponent();
@@ -52,13 +73,29 @@ public:
 	void Destroy() const;
 	void Finalize() const;
 
+	/**
+	 * \brief Forwards an overlap found by the collision world to every component.
+	 * \param _collider The collider of this game object.
+	 * \param _other The collider it overlaps.
+	 */
+	void OnCollision(SquareCollider& _collider, SquareCollider& _other) const;
+
 private:
 	std::string name = "GameObject";
+	Scene* scene = nullptr;
 
 	Maths::Vector2<float> position = Maths::Vector2f::Zero;
 	float rotation = 0.0f;
 	Maths::Vector2<float> scale = Maths::Vector2f::One;
 
+	mutable Maths::Transform2D transform;
+	mutable bool transformDirty = true;
+
+	/// Rotation of the cached cosine and sine, moving objects seldom rotate.
+	mutable float transformRotation = 0.0f;
+	mutable float rotationCos = 1.0f;
+	mutable float rotationSin = 0.0f;
+
 	std::vector<Component*> components;
 };
 
@@ -68,6 +105,7 @@ T* GameObject::CreateComponent()
 	T* component = new T();
 	component->SetOwner(this);
 	components.push_back(component);
+	component->OnAttach();
 	return component;
 }
 
@@ -0,0 +1,199 @@
+#pragma once
+
+#include <bitset>
+#include <cstdint>
+#include <filesystem>
+#include <string>
+#include <vector>
+
+#include <SFML/Window/Keyboard.hpp>
+#include <SFML/Window/Mouse.hpp>
+
+#include "Input/Joystick.h"
+#include "Maths/Vector2.h"
+
+/// Index of an action in its ActionMap, looked up once instead of comparing names every frame.
+using ActionId = std::uint16_t;
+
+/**
+ * \class ActionMap
+ * \brief Named input actions and the keys, buttons and joystick axes bound to them.
+ *
+ * Gameplay code reads actions instead of devices, so bindings can change without
+ * touching it. The bindings are compiled into one flat table the first time they
+ * are evaluated after a change, evaluating the actions once per frame is a single
+ * pass over that table.
+ *
+ * Bindings files have one action per line, empty lines and lines starting with # are ignored:
+ * \code
+ * <name> <button|axis|axis2d> <source>:<input>[:<target>]...
+ * Move axis2d Key:D:x Key:Q:-x Key:S:y Key:Z:-y JoystickAxis:X:x JoystickAxis:Y:y
+ * Jump button Key:Space JoystickButton:0
+ * \endcode
+ * Sources are Key, MouseButton, JoystickAxis and JoystickButton, inputs use the SFML
+ * enumerator names (or the button number for JoystickButton). The target is the axis
+ * receiving the input, x by default, prefixed by - to invert it.
+ * Joystick bindings read the first connected joystick.
+ */
+class ActionMap
+{
+public:
+	static constexpr ActionId InvalidAction = 0xFFFF;
+
+	/// Value from which a button or an axis counts as pressed.
+	static constexpr float PressThreshold = 0.5f;
+
+	enum class ActionType : std::uint8_t
+	{
+		Button,
+		Axis,
+		Axis2D
+	};
+
+	enum class BindingSource : std::uint8_t
+	{
+		Key,
+		MouseButton,
+		JoystickAxis,
+		JoystickButton
+	};
+
+	/**
+	 * \struct Binding
+	 * \brief An input driving an action.
+	 */
+	struct Binding
+	{
+		BindingSource source = BindingSource::Key;
+
+		/// sf::Keyboard::Key, sf::Mouse::Button, sf::Joystick::Axis or joystick button number.
+		int code = 0;
+
+		/// Axis receiving the input: 0 for x, 1 for y.
+		std::uint8_t component = 0;
+
+		/// Multiplies the input, -1 inverts it.
+		float scale = 1.0f;
+	};
+
+	/**
+	 * \brief Adds an action, or gets it if one has this name.
+	 * \param _name The name of the action.
+	 * \param _type The type of the action, ignored if it already exists.
+	 * \return The id of the action.
+	 */
+	ActionId AddAction(const std::string& _name, ActionType _type);
+
+	/**
+	 * \brief Finds an action by its name, to be done once and the id kept.
+	 * \param _name The name of the action.
+	 * \return The id of the action, InvalidAction if there is none with this name.
+	 */
+	ActionId FindAction(const std::string& _name) const;
+
+	std::size_t GetActionCount() const { return actions.size(); }
+	const std::string& GetActionName(const ActionId _action) const { return actions[_action].name; }
+	ActionType GetActionType(const ActionId _action) const { return actions[_action].type; }
+	const std::vector<Binding>& GetBindings(const ActionId _action) const { return actions[_action].bindings; }
+
+	/**
+	 * \brief Binds an input to an action, effective from the next evaluation.
+	 * \param _action The action.
+	 * \param _binding The input.
+	 */
+	void AddBinding(ActionId _action, const Binding& _binding);
+
+	/**
+	 * \brief Removes every input bound to an action, to rebind it.
+	 * \param _action The action.
+	 */
+	void ClearBindings(ActionId _action);
+
+	/**
+	 * \brief Reads actions from a bindings file, replacing the bindings of the actions it lists.
+	 * Invalid bindings are skipped, the actions not listed keep theirs.
+	 * \param _path The path of the file.
+	 * \return False if the file could not be read.
+	 */
+	bool LoadFromFile(const std::filesystem::path& _path);
+
+	/**
+	 * \brief Writes every action and its bindings, to keep bindings changed at runtime.
+	 * \param _path The path of the file.
+	 * \return True if the file was written.
+	 */
+	bool SaveToFile(const std::filesystem::path& _path) const;
+
+	/**
+	 * \brief Computes the value of every action from the input of the frame.
+	 * \param _keys The keys held.
+	 * \param _mouse_buttons The mouse buttons held.
+	 * \param _joystick The joystick driving the joystick bindings.
+	 */
+	void Evaluate(const std::bitset<sf::Keyboard::Key::KeyCount>& _keys, const std::bitset<sf::Mouse::Button::ButtonCount>& _mouse_buttons, const JoystickState& _joystick);
+
+	bool IsPressed(const ActionId _action) const { return _action < states.size() && (states[_action] & Pressed); }
+	bool WasPressedThisFrame(const ActionId _action) const { return _action < states.size() && states[_action] == Pressed; }
+	bool WasReleasedThisFrame(const ActionId _action) const { return _action < states.size() && states[_action] == PreviouslyPressed; }
+
+	float GetValue(const ActionId _action) const { return _action < values.size() ? values[_action].x : 0.0f; }
+	Maths::Vector2f GetValue2D(const ActionId _action) const { return _action < values.size() ? values[_action] : Maths::Vector2f::Zero; }
+
+	/**
+	 * \brief Formats a binding as written in bindings files.
+	 * \param _binding The binding.
+	 * \return The text of the binding.
+	 */
+	static std::string FormatBinding(const Binding& _binding);
+
+	/**
+	 * \brief Parses a binding written as in bindings files.
+	 * \param _text The text of the binding.
+	 * \param _binding The binding to assign.
+	 * \return False if the text is not a valid binding.
+	 */
+	static bool ParseBinding(const std::string& _text, Binding& _binding);
+
+private:
+	enum StateFlags : std::uint8_t
+	{
+		Pressed = 1 << 0,
+		PreviouslyPressed = 1 << 1
+	};
+
+	struct Action
+	{
+		std::string name;
+		ActionType type = ActionType::Button;
+		std::vector<Binding> bindings;
+	};
+
+	/**
+	 * \struct CompiledBinding
+	 * \brief A binding flattened with the action it drives.
+	 */
+	struct CompiledBinding
+	{
+		ActionId action = 0;
+		BindingSource source = BindingSource::Key;
+		std::uint8_t component = 0;
+		int code = 0;
+		float scale = 1.0f;
+	};
+
+	/**
+	 * \brief Rebuilds the flat table and resizes the values, after bindings or actions changed.
+	 */
+	void Compile();
+
+	std::vector<Action> actions;
+
+	std::vector<CompiledBinding> compiledBindings;
+	bool dirty = true;
+
+	/// Value of every action, y is only used by Axis2D actions.
+	std::vector<Maths::Vector2f> values;
+
+	/// StateFlags of every action.
+	std::vector<std::uint8_t> states;
+};
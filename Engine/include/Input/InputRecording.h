@@ -0,0 +1,145 @@
+#pragma once
+
+#include <bitset>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <vector>
+
+#include <SFML/Window/Event.hpp>
+#include <SFML/Window/Keyboard.hpp>
+#include <SFML/Window/Mouse.hpp>
+
+#include "Input/Joystick.h"
+#include "Maths/Vector2.h"
+
+/**
+ * \struct InputFrame
+ * \brief Everything the simulation reads from the outside during one frame.
+ */
+struct InputFrame
+{
+	/// Time elapsed since the previous frame, in seconds.
+	float deltaTime = 0.0f;
+
+	Maths::Vector2i mousePosition = Maths::Vector2i::Zero;
+
+	/// Keys held during the frame.
+	std::bitset<sf::Keyboard::Key::KeyCount> keys;
+
+	/// Mouse buttons held during the frame.
+	std::bitset<sf::Mouse::Button::ButtonCount> mouseButtons;
+
+	/// Joysticks polled during the frame.
+	JoystickStates joysticks;
+
+	/// Window events of the frame, without mouse moves already given by mousePosition.
+	std::vector<sf::Event> events;
+};
+
+/**
+ * \class InputRecording
+ * \brief Compact binary stream of InputFrame, written while playing and read back to replay.
+ *
+ * Each frame only stores what changed since the previous one: an idle frame is
+ * its delta time and a flags byte. The header stores the number of keys, buttons
+ * and the size of sf::Event, recordings are only replayed by a build using the
+ * same SFML version.
+ */
+class InputRecording
+{
+public:
+	/// "INRC" read as a little-endian integer.
+	static constexpr std::uint32_t Magic = 0x43524E49;
+
+	/// Version of the format, bumped on any layout change.
+	static constexpr std::uint32_t Version = 2;
+
+	/**
+	 * \struct Header
+	 * \brief Header at the beginning of a recording.
+	 */
+	struct Header
+	{
+		std::uint32_t magic = Magic;
+		std::uint32_t version = Version;
+		std::uint16_t keyCount = sf::Keyboard::Key::KeyCount;
+		std::uint16_t buttonCount = sf::Mouse::Button::ButtonCount;
+		std::uint32_t eventSize = sizeof(sf::Event);
+	};
+
+	/**
+	 * \brief Creates the file and writes the header, closing any previous recording.
+	 * \param _path The path of the file.
+	 * \return True if the file was created.
+	 */
+	bool OpenForWriting(const std::filesystem::path& _path);
+
+	/**
+	 * \brief Reads a whole recording to replay it from its first frame.
+	 * \param _path The path of the file.
+	 * \return True if the file was read and has a valid header.
+	 */
+	bool OpenForReading(const std::filesystem::path& _path);
+
+	/**
+	 * \brief Closes the file being written or releases the recording being read.
+	 */
+	void Close();
+
+	/**
+	 * \brief Appends a frame to the file.
+	 * \param _frame The frame to write.
+	 */
+	void WriteFrame(const InputFrame& _frame);
+
+	/**
+	 * \brief Reads the next frame.
+	 * \param _frame The frame to assign, events are replaced.
+	 * \return False at the end of the recording or if it is truncated.
+	 */
+	bool ReadFrame(InputFrame& _frame);
+
+	bool IsWriting() const { return file.is_open(); }
+	bool IsReading() const { return !data.empty(); }
+
+	/**
+	 * \brief Checks if every frame of the recording being read was read.
+	 * \return True after the last frame.
+	 */
+	bool IsAtEnd() const { return position == data.size(); }
+
+	/**
+	 * \brief Gets the number of frames written or read so far.
+	 * \return The number of frames.
+	 */
+	std::uint32_t GetFrameCount() const { return frameCount; }
+
+private:
+	enum FrameFlags : std::uint8_t
+	{
+		MouseMoved = 1 << 0,
+		ButtonsChanged = 1 << 1,
+		HasEvents = 1 << 2,
+		JoysticksChanged = 1 << 3
+	};
+
+	/**
+	 * \brief Reads bytes from the recording.
+	 * \param _data The destination of the bytes.
+	 * \param _size The number of bytes.
+	 * \return False if the recording is too short.
+	 */
+	bool Read(void* _data, std::size_t _size);
+
+	std::ofstream file;
+
+	/// Content of the recording being read.
+	std::vector<std::uint8_t> data;
+	std::size_t position = 0;
+
+	/// State of the previous frame, frames are stored as changes from it.
+	InputFrame previous;
+
+	std::uint32_t frameCount = 0;
+};
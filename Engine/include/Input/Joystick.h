@@ -0,0 +1,88 @@
+#pragma once
+
+#include <array>
+#include <bitset>
+
+#include <SFML/Window/Joystick.hpp>
+
+/**
+ * \struct JoystickState
+ * \brief State of one joystick during a frame.
+ */
+struct JoystickState
+{
+	bool connected = false;
+
+	std::bitset<sf::Joystick::ButtonCount> buttons;
+
+	/// Positions in [-1, 1] with the dead zone removed, 0 for the axes the device does not have.
+	std::array<float, sf::Joystick::AxisCount> axes = {};
+
+	bool operator==(const JoystickState& _other) const = default;
+};
+
+/// State of every joystick slot.
+using JoystickStates = std::array<JoystickState, sf::Joystick::Count>;
+
+/**
+ * \class JoystickSource
+ * \brief Where InputModule reads the joysticks from once per frame, replaced to simulate devices.
+ */
+class JoystickSource
+{
+public:
+	/**
+	 * \brief Destructor.
+	 */
+	virtual ~JoystickSource() = default;
+
+	/**
+	 * \brief Reads the state of every joystick slot.
+	 * \param _states The states to assign, disconnected slots are reset.
+	 */
+	virtual void Poll(JoystickStates& _states) = 0;
+};
+
+/**
+ * \class SfmlJoystickSource
+ * \brief Reads the joysticks through sf::Joystick, whose state SFML refreshes while window events are polled.
+ */
+class SfmlJoystickSource final : public JoystickSource
+{
+public:
+	/// Axis positions smaller than this, in [0, 1], are read as 0 so worn sticks do not drift.
+	static constexpr float DeadZone = 0.15f;
+
+	/**
+	 * \brief Constructor.
+	 * \param _update_devices Whether Poll() refreshes the devices itself, needed when no window polls events.
+	 */
+	explicit SfmlJoystickSource(const bool _update_devices = false) : updateDevices(_update_devices) {}
+
+	void Poll(JoystickStates& _states) override;
+
+	void SetUpdateDevices(const bool _update_devices) { updateDevices = _update_devices; }
+
+private:
+	bool updateDevices = false;
+};
+
+/**
+ * \class SimulatedJoystickSource
+ * \brief Joysticks driven by code, for tests and bots.
+ */
+class SimulatedJoystickSource final : public JoystickSource
+{
+public:
+	void Poll(JoystickStates& _states) override { _states = states; }
+
+	/**
+	 * \brief Gets the state returned by the next polls.
+	 * \param _joystick The joystick slot.
+	 * \return The state to modify.
+	 */
+	JoystickState& GetState(const unsigned int _joystick) { return states[_joystick]; }
+
+private:
+	JoystickStates states;
+};
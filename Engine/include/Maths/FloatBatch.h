@@ -0,0 +1,27 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace Maths
+{
+	/**
+	 * \brief Operations on arrays of floats, with the SIMD kernels selected by Vector2Batch.
+	 *
+	 * Results are bit for bit those of the same operations on each float, as the Vector2Batch ones.
+	 */
+	namespace FloatBatch
+	{
+		/**
+		 * \brief Adds scaled rates to values and finds the values reaching a limit, as the ages of particles over their life
+		 * \param _values Values increased in place by _rates[i] * _scale
+		 * \param _rates Rates of the values
+		 * \param _scale Scale of the rates, the time step
+		 * \param _limit Values at or above it once increased are found
+		 * \param _out_indices Indices of the values reaching the limit in increasing order, holds at least _count entries
+		 * \param _count Number of values
+		 * \return Number of values reaching the limit
+		 */
+		std::size_t AddScaledReaching(float* _values, const float* _rates, float _scale, float _limit, std::uint32_t* _out_indices, std::size_t _count);
+	}
+}
@@ -0,0 +1,135 @@
+#pragma once
+
+#include "Maths/Vector2.h"
+
+namespace Maths
+{
+	/**
+	 * \class Rect
+	 * \brief Axis-aligned rectangle stored as its min and max corners, for collisions, culling and picking.
+	 *
+	 * Edges do not overlap: rectangles sharing an edge do not intersect, like SquareCollider.
+	 */
+	template<typename T>
+	class Rect
+	{
+	public:
+		Vector2<T> min;
+		Vector2<T> max;
+
+		/**
+		 * \brief Default constructor, an empty rectangle at the origin
+		 */
+		constexpr Rect() = default;
+
+		/**
+		 * \brief Constructor from the corners
+		 * \param _min Corner with the smallest coordinates
+		 * \param _max Corner with the largest coordinates
+		 */
+		constexpr Rect(const Vector2<T>& _min, const Vector2<T>& _max) : min(_min), max(_max) {}
+
+		/**
+		 * \brief Create a rectangle from its position and size, as GameObjects and colliders are placed
+		 * \param _position Corner with the smallest coordinates
+		 * \param _size Size
+		 * \return The rectangle
+		 */
+		static constexpr Rect FromPositionSize(const Vector2<T>& _position, const Vector2<T>& _size);
+
+		constexpr Vector2<T> GetSize() const;
+		constexpr Vector2<T> GetCenter() const;
+		constexpr T GetWidth() const;
+		constexpr T GetHeight() const;
+
+		/**
+		 * \brief Calculate the perimeter, the cost of a box in bounding volume trees
+		 * \return Twice the sum of the width and height
+		 */
+		constexpr T GetPerimeter() const;
+
+		/**
+		 * \brief Check that the rectangle has an area
+		 * \return True if max is not past min on any axis, false for the result of a failed Intersection
+		 */
+		constexpr bool IsEmpty() const;
+
+		/**
+		 * \brief Check if a point is inside, min included and max excluded
+		 * \param _point Point to test
+		 * \return True if the point is inside
+		 */
+		constexpr bool Contains(const Vector2<T>& _point) const;
+
+		/**
+		 * \brief Check if another rectangle is entirely inside
+		 * \param _rect Rectangle to test
+		 * \return True if _rect is inside, edges included
+		 */
+		constexpr bool Contains(const Rect& _rect) const;
+
+		/**
+		 * \brief Check if two rectangles overlap
+		 * \param _rect Rectangle to test
+		 * \return True if the rectangles share an area
+		 */
+		constexpr bool Overlaps(const Rect& _rect) const;
+
+		/**
+		 * \brief Calculate the squared distance from a point to the closest point of the rectangle
+		 * \param _point Point to measure from
+		 * \return Squared distance, zero if the point is inside or on an edge
+		 */
+		constexpr T DistanceSquared(const Vector2<T>& _point) const;
+
+		/**
+		 * \brief Calculate the smallest rectangle containing both
+		 * \param _rect Other rectangle
+		 * \return Union of the rectangles
+		 */
+		constexpr Rect Union(const Rect& _rect) const;
+
+		/**
+		 * \brief Calculate the area shared by both rectangles
+		 * \param _rect Other rectangle
+		 * \return Intersection of the rectangles, empty if they do not overlap
+		 */
+		constexpr Rect Intersection(const Rect& _rect) const;
+
+		/**
+		 * \brief Grow the rectangle on every side
+		 * \param _margin Distance added on each side, negative to shrink
+		 * \return Expanded rectangle
+		 */
+		constexpr Rect Expand(const T& _margin) const;
+
+		/**
+		 * \brief Grow the rectangle to contain a point
+		 * \param _point Point to include
+		 * \return Expanded rectangle
+		 */
+		constexpr Rect Expand(const Vector2<T>& _point) const;
+
+		/**
+		 * \brief Move the rectangle
+		 * \param _offset Translation
+		 * \return Translated rectangle
+		 */
+		constexpr Rect Translate(const Vector2<T>& _offset) const;
+
+		friend constexpr bool operator==(const Rect& _lhs, const Rect& _rhs)
+		{
+			return _lhs.min == _rhs.min && _lhs.max == _rhs.max;
+		}
+
+		friend constexpr bool operator!=(const Rect& _lhs, const Rect& _rhs)
+		{
+			return !(_lhs == _rhs);
+		}
+	};
+
+	using Recti = Rect<int>;
+	using Rectf = Rect<float>;
+}
+
+#include "Maths/Rect.inl"
@@ -0,0 +1,102 @@
+#pragma once
+
+namespace Maths
+{
+	template<typename T>
+	constexpr Rect<T> Rect<T>::FromPositionSize(const Vector2<T>& _position, const Vector2<T>& _size)
+	{
+		return Rect(_position, _position + _size);
+	}
+
+	template<typename T>
+	constexpr Vector2<T> Rect<T>::GetSize() const
+	{
+		return max - min;
+	}
+
+	template<typename T>
+	constexpr Vector2<T> Rect<T>::GetCenter() const
+	{
+		return (min + max) / static_cast<T>(2);
+	}
+
+	template<typename T>
+	constexpr T Rect<T>::GetWidth() const
+	{
+		return max.x - min.x;
+	}
+
+	template<typename T>
+	constexpr T Rect<T>::GetHeight() const
+	{
+		return max.y - min.y;
+	}
+
+	template<typename T>
+	constexpr T Rect<T>::GetPerimeter() const
+	{
+		return static_cast<T>(2) * (max.x - min.x + max.y - min.y);
+	}
+
+	template<typename T>
+	constexpr bool Rect<T>::IsEmpty() const
+	{
+		return !(min.x < max.x && min.y < max.y);
+	}
+
+	template<typename T>
+	constexpr bool Rect<T>::Contains(const Vector2<T>& _point) const
+	{
+		return _point.x >= min.x && _point.x < max.x && _point.y >= min.y && _point.y < max.y;
+	}
+
+	template<typename T>
+	constexpr bool Rect<T>::Contains(const Rect& _rect) const
+	{
+		return _rect.min.x >= min.x && _rect.max.x <= max.x && _rect.min.y >= min.y && _rect.max.y <= max.y;
+	}
+
+	template<typename T>
+	constexpr bool Rect<T>::Overlaps(const Rect& _rect) const
+	{
+		return min.x < _rect.max.x && max.x > _rect.min.x && min.y < _rect.max.y && max.y > _rect.min.y;
+	}
+
+	template<typename T>
+	constexpr T Rect<T>::DistanceSquared(const Vector2<T>& _point) const
+	{
+		const T delta_x = _point.x < min.x ? min.x - _point.x : (_point.x > max.x ? _point.x - max.x : static_cast<T>(0));
+		const T delta_y = _point.y < min.y ? min.y - _point.y : (_point.y > max.y ? _point.y - max.y : static_cast<T>(0));
+		return delta_x * delta_x + delta_y * delta_y;
+	}
+
+	template<typename T>
+	constexpr Rect<T> Rect<T>::Union(const Rect& _rect) const
+	{
+		return Rect(Vector2<T>::Min(min, _rect.min), Vector2<T>::Max(max, _rect.max));
+	}
+
+	template<typename T>
+	constexpr Rect<T> Rect<T>::Intersection(const Rect& _rect) const
+	{
+		return Rect(Vector2<T>::Max(min, _rect.min), Vector2<T>::Min(max, _rect.max));
+	}
+
+	template<typename T>
+	constexpr Rect<T> Rect<T>::Expand(const T& _margin) const
+	{
+		return Rect(Vector2<T>(min.x - _margin, min.y - _margin), Vector2<T>(max.x + _margin, max.y + _margin));
+	}
+
+	template<typename T>
+	constexpr Rect<T> Rect<T>::Expand(const Vector2<T>& _point) const
+	{
+		return Rect(Vector2<T>::Min(min, _point), Vector2<T>::Max(max, _point));
+	}
+
+	template<typename T>
+	constexpr Rect<T> Rect<T>::Translate(const Vector2<T>& _offset) const
+	{
+		return Rect(min + _offset, max + _offset);
+	}
+}
@@ -0,0 +1,80 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "Maths/Rect.h"
+
+namespace Maths
+{
+	/**
+	 * \struct ConstRectSpan
+	 * \brief Rectangles stored as separate arrays of min x, min y, max x and max y.
+	 */
+	struct ConstRectSpan
+	{
+		const float* minX = nullptr;
+		const float* minY = nullptr;
+		const float* maxX = nullptr;
+		const float* maxY = nullptr;
+		std::size_t size = 0;
+	};
+
+	/**
+	 * \class RectArray
+	 * \brief Array of Rectf stored as structure of arrays, the layout the batch queries work on.
+	 */
+	class RectArray
+	{
+	public:
+		RectArray() = default;
+		explicit RectArray(const std::size_t _size) : minX(_size), minY(_size), maxX(_size), maxY(_size) {}
+
+		std::size_t Size() const { return minX.size(); }
+
+		void Resize(std::size_t _size);
+		void Clear();
+
+		void Add(const Rectf& _rect);
+		void Set(std::size_t _index, const Rectf& _rect);
+
+		Rectf Get(const std::size_t _index) const { return Rectf(Vector2f(minX[_index], minY[_index]), Vector2f(maxX[_index], maxY[_index])); }
+
+		ConstRectSpan GetSpan() const { return {minX.data(), minY.data(), maxX.data(), maxY.data(), minX.size()}; }
+		operator ConstRectSpan() const { return GetSpan(); }
+
+	private:
+		std::vector<float> minX;
+		std::vector<float> minY;
+		std::vector<float> maxX;
+		std::vector<float> maxY;
+	};
+
+	/**
+	 * \brief Queries of many rectangles at once, with the SIMD kernels selected by Vector2Batch.
+	 *
+	 * The indices of the matching rectangles are written in increasing order without gaps,
+	 * the output must hold one index per rectangle of the span.
+	 */
+	namespace RectBatch
+	{
+		/**
+		 * \brief Find the rectangles overlapping one, as Rectf::Overlaps
+		 * \param _query Rectangle to test, for culling the view or the bounds of a moving object
+		 * \param _rects Rectangles tested
+		 * \param _out_indices Indices of the overlapping rectangles, holds at least _rects.size entries
+		 * \return Number of overlapping rectangles
+		 */
+		std::size_t Overlapping(const Rectf& _query, ConstRectSpan _rects, std::uint32_t* _out_indices);
+
+		/**
+		 * \brief Find the rectangles containing a point, as Rectf::Contains, for picking
+		 * \param _point Point to test
+		 * \param _rects Rectangles tested
+		 * \param _out_indices Indices of the rectangles containing the point, holds at least _rects.size entries
+		 * \return Number of rectangles containing the point
+		 */
+		std::size_t Containing(const Vector2f& _point, ConstRectSpan _rects, std::uint32_t* _out_indices);
+	}
+}
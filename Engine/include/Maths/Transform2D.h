@@ -0,0 +1,159 @@
+#pragma once
+
+#include <SFML/Graphics/Transform.hpp>
+
+#include "Maths/Vector2.h"
+#include "Maths/Vector2Batch.h"
+
+namespace Maths
+{
+	/**
+	 * \class Transform2D
+	 * \brief 2D affine transform, a 3x2 matrix mapping (x, y) to (a * x + c * y + tx, b * x + d * y + ty).
+	 *
+	 * Composing transforms and transforming points only multiply and add, the trigonometry is
+	 * done once when the transform is built instead of for every point.
+	 */
+	class Transform2D
+	{
+	public:
+		float a = 1.0f;
+		float b = 0.0f;
+		float c = 0.0f;
+		float d = 1.0f;
+		float tx = 0.0f;
+		float ty = 0.0f;
+
+		/**
+		 * \brief Default constructor, the identity
+		 */
+		constexpr Transform2D() = default;
+
+		/**
+		 * \brief Constructor from the coefficients
+		 * \param _a Scales x into x
+		 * \param _b Scales x into y
+		 * \param _c Scales y into x
+		 * \param _d Scales y into y
+		 * \param _tx Translation along x
+		 * \param _ty Translation along y
+		 */
+		constexpr Transform2D(const float _a, const float _b, const float _c, const float _d, const float _tx, const float _ty) : a(_a), b(_b), c(_c), d(_d), tx(_tx), ty(_ty) {}
+
+		static constexpr Transform2D Translation(const Vector2f& _translation) { return Transform2D(1.0f, 0.0f, 0.0f, 1.0f, _translation.x, _translation.y); }
+
+		static constexpr Transform2D Scaling(const Vector2f& _scale) { return Transform2D(_scale.x, 0.0f, 0.0f, _scale.y, 0.0f, 0.0f); }
+
+		/**
+		 * \brief Rotation by an angle whose cosine and sine are already known
+		 * \param _cos Cosine of the angle
+		 * \param _sin Sine of the angle
+		 * \return The rotation, in the direction of Vector2::Rotate
+		 */
+		static constexpr Transform2D Rotation(const float _cos, const float _sin) { return Transform2D(_cos, _sin, -_sin, _cos, 0.0f, 0.0f); }
+
+		/**
+		 * \brief Rotation by an angle
+		 * \param _angle Angle in radians
+		 * \return The rotation, in the direction of Vector2::Rotate
+		 */
+		static Transform2D Rotation(float _angle);
+
+		/**
+		 * \brief Scales, then rotates, then translates, as a GameObject is placed
+		 * \param _position Translation
+		 * \param _cos Cosine of the rotation
+		 * \param _sin Sine of the rotation
+		 * \param _scale Scale
+		 * \return The transform
+		 */
+		static constexpr Transform2D FromPositionRotationScale(const Vector2f& _position, const float _cos, const float _sin, const Vector2f& _scale)
+		{
+			return Transform2D(_cos * _scale.x, _sin * _scale.x, -_sin * _scale.y, _cos * _scale.y, _position.x, _position.y);
+		}
+
+		/**
+		 * \brief Composition, _rhs is applied first
+		 * \param _rhs Transform applied before this one
+		 * \return Transform applying _rhs then this
+		 */
+		constexpr Transform2D operator*(const Transform2D& _rhs) const
+		{
+			return Transform2D(
+				a * _rhs.a + c * _rhs.b,
+				b * _rhs.a + d * _rhs.b,
+				a * _rhs.c + c * _rhs.d,
+				b * _rhs.c + d * _rhs.d,
+				a * _rhs.tx + c * _rhs.ty + tx,
+				b * _rhs.tx + d * _rhs.ty + ty);
+		}
+
+		constexpr Transform2D& operator*=(const Transform2D& _rhs)
+		{
+			*this = *this * _rhs;
+			return *this;
+		}
+
+		constexpr float Determinant() const { return a * d - b * c; }
+
+		/**
+		 * \brief Calculate the inverse transform
+		 * \return The inverse, the identity if the transform cannot be inverted (a null scale)
+		 */
+		constexpr Transform2D GetInverse() const
+		{
+			const float determinant = Determinant();
+			if (determinant == 0.0f)
+				return Transform2D();
+
+			const float inverse = 1.0f / determinant;
+			return Transform2D(d * inverse, -b * inverse, -c * inverse, a * inverse, (c * ty - d * tx) * inverse, (b * tx - a * ty) * inverse);
+		}
+
+		/**
+		 * \brief Transform a point, translation included
+		 * \param _point Point to transform
+		 * \return Transformed point, the same bits as TransformPoints
+		 */
+		constexpr Vector2f TransformPoint(const Vector2f& _point) const
+		{
+			return Vector2f(a * _point.x + c * _point.y + tx, b * _point.x + d * _point.y + ty);
+		}
+
+		/**
+		 * \brief Transform a direction, without the translation
+		 * \param _vector Vector to transform
+		 * \return Transformed vector
+		 */
+		constexpr Vector2f TransformVector(const Vector2f& _vector) const
+		{
+			return Vector2f(a * _vector.x + c * _vector.y, b * _vector.x + d * _vector.y);
+		}
+
+		/**
+		 * \brief Transform many points with the SIMD kernels of Vector2Batch
+		 * \param _points Points to transform
+		 * \param _out Transformed points, may be _points
+		 */
+		void TransformPoints(ConstVector2Span _points, Vector2Span _out) const;
+
+		/**
+		 * \brief Explicit conversion to sf::Transform, to draw with it
+		 */
+		explicit operator sf::Transform() const { return sf::Transform(a, c, tx, b, d, ty, 0.0f, 0.0f, 1.0f); }
+
+		static const Transform2D Identity;
+
+		friend constexpr bool operator==(const Transform2D& _lhs, const Transform2D& _rhs)
+		{
+			return _lhs.a == _rhs.a && _lhs.b == _rhs.b && _lhs.c == _rhs.c && _lhs.d == _rhs.d && _lhs.tx == _rhs.tx && _lhs.ty == _rhs.ty;
+		}
+
+		friend constexpr bool operator!=(const Transform2D& _lhs, const Transform2D& _rhs)
+		{
+			return !(_lhs == _rhs);
+		}
+	};
+
+	inline constexpr Transform2D Transform2D::Identity = Transform2D();
+}
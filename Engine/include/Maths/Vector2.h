@@ -14,14 +14,14 @@ namespace Maths
 		/**  
 		 * \brief Default constructor, set 0 to both components  
 		 */
-		Vector2();
+		constexpr Vector2();
 
 		/**  
 		 * \brief Constructor with explicit values for both components  
 		 * \param _x X component  
 		 * \param _y Y component  
 		 */
-		Vector2(T _x, T _y);
+		constexpr Vector2(T _x, T _y);
 
 		/**  
 		 * \brief Default destructor  
@@ -88,98 +88,98 @@ namespace Maths
 		 * \param _rhs Right-hand side vector  
 		 * \return Result of addition  
 		 */
-		Vector2 operator+(const Vector2& _rhs) const;
+		constexpr Vector2 operator+(const Vector2& _rhs) const;
 
 		/**  
 		 * \brief Subtraction operator  
 		 * \param _rhs Right-hand side vector  
 		 * \return Result of subtraction  
 		 */
-		Vector2 operator-(const Vector2& _rhs) const;
+		constexpr Vector2 operator-(const Vector2& _rhs) const;
 
 		/**  
 		 * \brief Multiplication operator  
 		 * \param _rhs Right-hand side vector  
 		 * \return Result of multiplication  
 		 */
-		Vector2 operator*(const Vector2& _rhs) const;
+		constexpr Vector2 operator*(const Vector2& _rhs) const;
 
 		/**  
 		 * \brief Division operator  
 		 * \param _rhs Right-hand side vector  
 		 * \return Result of division  
 		 */
-		Vector2 operator/(const Vector2& _rhs) const;
+		constexpr Vector2 operator/(const Vector2& _rhs) const;
 
 		/**  
 		 * \brief Multiplication operator with scalar  
 		 * \param _rhs Scalar value  
 		 * \return Result of multiplication  
 		 */
-		Vector2 operator*(const T& _rhs) const;
+		constexpr Vector2 operator*(const T& _rhs) const;
 
 		/**  
 		 * \brief Division operator with scalar  
 		 * \param _rhs Scalar value  
 		 * \return Result of division  
 		 */
-		Vector2 operator/(const T& _rhs) const;
+		constexpr Vector2 operator/(const T& _rhs) const;
 
 		/**  
 		 * \brief Addition assignment operator  
 		 * \param _rhs Right-hand side vector  
 		 * \return Reference to this  
 		 */
-		Vector2& operator+=(const Vector2& _rhs);
+		constexpr Vector2& operator+=(const Vector2& _rhs);
 
 		/**  
 		 * \brief Subtraction assignment operator  
 		 * \param _rhs Right-hand side vector  
 		 * \return Reference to this  
 		 */
-		Vector2& operator-=(const Vector2& _rhs);
+		constexpr Vector2& operator-=(const Vector2& _rhs);
 
 		/**  
 		 * \brief Multiplication assignment operator  
 		 * \param _rhs Right-hand side vector  
 		 * \return Reference to this  
 		 */
-		Vector2& operator*=(const Vector2& _rhs);
+		constexpr Vector2& operator*=(const Vector2& _rhs);
 
 		/**  
 		 * \brief Division assignment operator  
 		 * \param _rhs Right-hand side vector  
 		 * \return Reference to this  
 		 */
-		Vector2& operator/=(const Vector2& _rhs);
+		constexpr Vector2& operator/=(const Vector2& _rhs);
 
 		/**  
 		 * \brief Multiplication assignment operator with scalar  
 		 * \param _rhs Scalar value  
 		 * \return Reference to this  
 		 */
-		Vector2& operator*=(const T& _rhs);
+		constexpr Vector2& operator*=(const T& _rhs);
 
 		/**  
 		 * \brief Division assignment operator with scalar  
 		 * \param _rhs Scalar value  
 		 * \return Reference to this  
 		 */
-		Vector2& operator/=(const T& _rhs);
+		constexpr Vector2& operator/=(const T& _rhs);
 
 		/**  
 		 * \brief Calculate the dot product  
 		 * \param _rhs Right-hand side vector  
 		 * \return Dot product  
 		 */
-		float Dot(const Vector2& _rhs) const;
+		constexpr float Dot(const Vector2& _rhs) const;
 
 		/**  
 		 * \brief Calculate the cross product  
 		 * \param _rhs Right-hand side vector  
 		 * \return Cross product  
 		 */
-		float Cross(const Vector2& _rhs) const;
+		constexpr float Cross(const Vector2& _rhs) const;
 
 		/**  
 		 * \brief Calculate the magnitude  
@@ -191,14 +191,21 @@ namespace Maths
 		 * \brief Calculate the squared magnitude  
 		 * \return Squared magnitude  
 		 */
-		float MagnitudeSquared() const;
+		constexpr float MagnitudeSquared() const;
 
 		/**  
-		 * \brief Normalize the vector  
+		 * \brief Normalize the vector, throws std::logic_error if its magnitude is 0  
 		 * \return Normalized vector  
 		 */
 		Vector2 Normalize() const;
 
+		/**  
+		 * \brief Normalize the vector without throwing, for vectors that may be null  
+		 * \param _fallback Vector returned if the magnitude is 0  
+		 * \return Normalized vector, or _fallback  
+		 */
+		Vector2 NormalizeSafe(const Vector2& _fallback = Zero) const;
+
 		/**  
 		 * \brief Calculate the distance to another vector  
 		 * \param _rhs Right-hand side vector  
@@ -211,7 +218,7 @@ namespace Maths
 		 * \param _rhs Right-hand side vector  
 		 * \return Squared distance  
 		 */
-		float DistanceSquared(const Vector2& _rhs) const;
+		constexpr float DistanceSquared(const Vector2& _rhs) const;
 
 		/**  
 		 * \brief Calculate the angle between two vectors  
@@ -227,6 +234,14 @@ namespace Maths
 		 */
 		Vector2 Rotate(const T& _angle) const;
 
+		/**  
+		 * \brief Rotate the vector by an angle whose cosine and sine are already known  
+		 * \param _cos Cosine of the angle  
+		 * \param _sin Sine of the angle  
+		 * \return Rotated vector  
+		 */
+		constexpr Vector2 Rotate(const T& _cos, const T& _sin) const;
+
 		/**  
 		 * \brief Linearly interpolate between two vectors  
 		 * \param _lhs Left-hand side vector  
@@ -234,7 +249,7 @@ namespace Maths
 		 * \param _alpha Interpolation factor  
 		 * \return Interpolated vector  
 		 */
-		static Vector2 Lerp(const Vector2& _lhs, const Vector2& _rhs, const T& _alpha);
+		static constexpr Vector2 Lerp(const Vector2& _lhs, const Vector2& _rhs, const T& _alpha);
 
 		/**  
 		 * \brief Get the component-wise maximum of two vectors  
@@ -242,7 +257,7 @@ namespace Maths
 		 * \param _rhs Right-hand side vector  
 		 * \return Component-wise maximum vector  
 		 */
-		static Vector2 Max(const Vector2& _lhs, const Vector2& _rhs);
+		static constexpr Vector2 Max(const Vector2& _lhs, const Vector2& _rhs);
 
 		/**  
 		 * \brief Get the component-wise minimum of two vectors  
@@ -250,44 +265,44 @@ namespace Maths
 		 * \param _rhs Right-hand side vector  
 		 * \return Component-wise minimum vector  
 		 */
-		static Vector2 Min(const Vector2& _lhs, const Vector2& _rhs);
+		static constexpr Vector2 Min(const Vector2& _lhs, const Vector2& _rhs);
 
 		/**  
 		 * \brief Get the X component  
 		 * \return X component  
 		 */
-		T GetX() const;
+		constexpr T GetX() const;
 
 		/**  
 		 * \brief Get the Y component  
 		 * \return Y component  
 		 */
-		T GetY() const;
+		constexpr T GetY() const;
 
 		/**  
 		 * \brief Set the X component  
 		 * \param _new_x New X component  
 		 */
-		void SetX(const T& _new_x);
+		constexpr void SetX(const T& _new_x);
 
 		/**  
 		 * \brief Set the Y component  
 		 * \param _new_y New Y component  
 		 */
-		void SetY(const T& _new_y);
+		constexpr void SetY(const T& _new_y);
 
 		/**  
 		 * \brief Set both X and Y components  
 		 * \param _new_x New X component  
 		 * \param _new_y New Y component  
 		 */
-		void Set(const T& _new_x, const T& _new_y);
+		constexpr void Set(const T& _new_x, const T& _new_y);
 
 		/**  
 		 * \brief Set both X and Y components from another vector  
 		 * \param _rhs Vector to copy components from  
 		 */
-		void Set(const Vector2& _rhs);
+		constexpr void Set(const Vector2& _rhs);
 
 		static const Vector2 Zero;
 		static const Vector2 One;
@@ -304,7 +319,7 @@ namespace Maths
 		 * \param _rhs Right-hand side vector  
 		 * \return True if vectors are equal, false otherwise  
 		 */
-		friend bool operator==(const Vector2& _lhs, const Vector2& _rhs)
+		friend constexpr bool operator==(const Vector2& _lhs, const Vector2& _rhs)
 		{
 			return _lhs.x == _rhs.x && _lhs.y == _rhs.y;
 		}
@@ -315,7 +330,7 @@ namespace Maths
 		 * \param _rhs Right-hand side vector  
 		 * \return True if vectors are not equal, false otherwise  
 		 */
-		friend bool operator!=(const Vector2& _lhs, const Vector2& _rhs)
+		friend constexpr bool operator!=(const Vector2& _lhs, const Vector2& _rhs)
 		{
 			return !(_lhs == _rhs);
 		}
@@ -327,9 +342,10 @@ namespace Maths
 	using Vector2d = Vector2<double>;
 }
 
+#include "Maths/Vector2.inl"
+
+// After the definitions, so the constants are instantiated as constexpr
 template class Maths::Vector2<int>;
 template class Maths::Vector2<unsigned int>;
 template class Maths::Vector2<float>;
 template class Maths::Vector2<double>;
-
-#include "Maths/Vector2.inl"
@@ -9,49 +9,49 @@
 namespace Maths
 {
 template<typename T>
-Vector2<T>::Vector2() : x(0), y(0) {}
+constexpr Vector2<T>::Vector2() : x(0), y(0) {}
 
 template<typename T>
-Vector2<T>::Vector2(T _x, T _y) : x(_x), y(_y) {}
+constexpr Vector2<T>::Vector2(T _x, T _y) : x(_x), y(_y) {}
 
 template<typename T>
-Vector2<T> Vector2<T>::operator+(const Vector2& _rhs) const
+constexpr Vector2<T> Vector2<T>::operator+(const Vector2& _rhs) const
 {
     return Vector2(x + _rhs.x, y + _rhs.y);
 }
 
 template<typename T>
-Vector2<T> Vector2<T>::operator-(const Vector2& _rhs) const
+constexpr Vector2<T> Vector2<T>::operator-(const Vector2& _rhs) const
 {
     return Vector2(x - _rhs.x, y - _rhs.y);
 }
 
 template<typename T>
-Vector2<T> Vector2<T>::operator*(const Vector2& _rhs) const
+constexpr Vector2<T> Vector2<T>::operator*(const Vector2& _rhs) const
 {
     return Vector2(x * _rhs.x, y * _rhs.y);
 }
 
 template<typename T>
-Vector2<T> Vector2<T>::operator/(const Vector2& _rhs) const
+constexpr Vector2<T> Vector2<T>::operator/(const Vector2& _rhs) const
 {
     return Vector2(x / _rhs.x, y / _rhs.y);
 }
 
 template<typename T>
-Vector2<T> Vector2<T>::operator*(const T& _rhs) const
+constexpr Vector2<T> Vector2<T>::operator*(const T& _rhs) const
 {
     return Vector2(x * _rhs, y * _rhs);
 }
 
 template<typename T>
-Vector2<T> Vector2<T>::operator/(const T& _rhs) const
+constexpr Vector2<T> Vector2<T>::operator/(const T& _rhs) const
 {
     return Vector2(x / _rhs, y / _rhs);
 }
 
 template<typename T>
-Vector2<T>& Vector2<T>::operator+=(const Vector2& _rhs)
+constexpr Vector2<T>& Vector2<T>::operator+=(const Vector2& _rhs)
 {
     x += _rhs.x;
     y += _rhs.y;
@@ -59,7 +59,7 @@ Vector2<T>& Vector2<T>::operator+=(const Vector2& _rhs)
 }
 
 template<typename T>
-Vector2<T>& Vector2<T>::operator-=(const Vector2& _rhs)
+constexpr Vector2<T>& Vector2<T>::operator-=(const Vector2& _rhs)
 {
     x -= _rhs.x;
     y -= _rhs.y;
@@ -67,7 +67,7 @@ Vector2<T>& Vector2<T>::operator-=(const Vector2& _rhs)
 }
 
 template<typename T>
-Vector2<T>& Vector2<T>::operator*=(const Vector2& _rhs)
+constexpr Vector2<T>& Vector2<T>::operator*=(const Vector2& _rhs)
 {
     x *= _rhs.x;
     y *= _rhs.y;
@@ -75,7 +75,7 @@ Vector2<T>& Vector2<T>::operator*=(const Vector2& _rhs)
 }
 
 template<typename T>
-Vector2<T>& Vector2<T>::operator/=(const Vector2& _rhs)
+constexpr Vector2<T>& Vector2<T>::operator/=(const Vector2& _rhs)
 {
     x /= _rhs.x;
     y /= _rhs.y;
@@ -83,7 +83,7 @@ Vector2<T>& Vector2<T>::operator/=(const Vector2& _rhs)
 }
 
 template<typename T>
-Vector2<T>& Vector2<T>::operator*=(const T& _rhs)
+constexpr Vector2<T>& Vector2<T>::operator*=(const T& _rhs)
 {
     x *= _rhs;
     y *= _rhs;
@@ -91,7 +91,7 @@ Vector2<T>& Vector2<T>::operator*=(const T& _rhs)
 }
 
 template<typename T>
-Vector2<T>& Vector2<T>::operator/=(const T& _rhs)
+constexpr Vector2<T>& Vector2<T>::operator/=(const T& _rhs)
 {
     x /= _rhs;
     y /= _rhs;
@@ -99,13 +99,13 @@ Vector2<T>& Vector2<T>::operator/=(const T& _rhs)
 }
 
 template<typename T>
-float Vector2<T>::Dot(const Vector2& _rhs) const
+constexpr float Vector2<T>::Dot(const Vector2& _rhs) const
 {
     return x * _rhs.x + y * _rhs.y;
 }
 
 template<typename T>
-float Vector2<T>::Cross(const Vector2& _rhs) const
+constexpr float Vector2<T>::Cross(const Vector2& _rhs) const
 {
     return x * _rhs.y - y * _rhs.x;
 }
@@ -117,7 +117,7 @@ float Vector2<T>::Magnitude() const
 }
 
 template<typename T>
-float Vector2<T>::MagnitudeSquared() const
+constexpr float Vector2<T>::MagnitudeSquared() const
 {
     return x * x + y * y;
 }
@@ -134,6 +134,15 @@ Vector2<T> Vector2<T>::Normalize() const
     return Vector2(x / mag, y / mag);
 }
 
+template<typename T>
+Vector2<T> Vector2<T>::NormalizeSafe(const Vector2& _fallback) const
+{
+    const float mag = Magnitude();
+
+    // A select rather than a branch, null vectors are common for velocities and inputs
+    return mag != 0 ? Vector2(x / mag, y / mag) : _fallback;
+}
+
 template<typename T>
 float Vector2<T>::Distance(const Vector2<T>& _rhs) const
 {
@@ -141,7 +150,7 @@ float Vector2<T>::Distance(const Vector2<T>& _rhs) const
 }
 
 template<typename T>
-float Vector2<T>::DistanceSquared(const Vector2& _rhs) const
+constexpr float Vector2<T>::DistanceSquared(const Vector2& _rhs) const
 {
     return (x - _rhs.x) * (x - _rhs.x) + (y - _rhs.y) * (y - _rhs.y);
 }
@@ -155,88 +164,96 @@ float Vector2<T>::Angle(const Vector2& _rhs) const
 template<typename T>
 Vector2<T> Vector2<T>::Rotate(const T& _angle) const
 {
-    return Vector2(x * std::cos(_angle) - y * std::sin(_angle), x * std::sin(_angle) + y * std::cos(_angle));
+    const auto cos = std::cos(_angle);
+    const auto sin = std::sin(_angle);
+    return Vector2(x * cos - y * sin, x * sin + y * cos);
+}
+
+template<typename T>
+constexpr Vector2<T> Vector2<T>::Rotate(const T& _cos, const T& _sin) const
+{
+    return Vector2(x * _cos - y * _sin, x * _sin + y * _cos);
 }
 
 template<typename T>
-Vector2<T> Vector2<T>::Lerp(const Vector2& _lhs, const Vector2<T>& _rhs, const T& _alpha)
+constexpr Vector2<T> Vector2<T>::Lerp(const Vector2& _lhs, const Vector2<T>& _rhs, const T& _alpha)
 {
     return Vector2(_lhs.x * (1 - _alpha) + _rhs.x * _alpha, _lhs.y * (1 - _alpha) + _rhs.y * _alpha);
 }
 
 template<typename T>
-Vector2<T> Vector2<T>::Max(const Vector2& _lhs, const Vector2& _rhs)
+constexpr Vector2<T> Vector2<T>::Max(const Vector2& _lhs, const Vector2& _rhs)
 {
     return Vector2(_lhs.x > _rhs.x ? _lhs.x : _rhs.x, _lhs.y > _rhs.y ? _lhs.y : _rhs.y);
 }
 
 template<typename T>
-Vector2<T> Vector2<T>::Min(const Vector2& _lhs, const Vector2& _rhs)
+constexpr Vector2<T> Vector2<T>::Min(const Vector2& _lhs, const Vector2& _rhs)
 {
     return Vector2(_lhs.x < _rhs.x ? _lhs.x : _rhs.x, _lhs.y < _rhs.y ? _lhs.y : _rhs.y);
 }
 
 template<typename T>
-T Vector2<T>::GetX() const
+constexpr T Vector2<T>::GetX() const
 {
     return x;
 }
 
 template<typename T>
-T Vector2<T>::GetY() const
+constexpr T Vector2<T>::GetY() const
 {
     return y;
 }
 
 template<typename T>
-void Vector2<T>::SetX(const T& _new_x)
+constexpr void Vector2<T>::SetX(const T& _new_x)
 {
     x = _new_x;
 }
 
 template<typename T>
-void Vector2<T>::SetY(const T& _new_y)
+constexpr void Vector2<T>::SetY(const T& _new_y)
 {
     y = _new_y;
 }
 
 template<typename T>
-void Vector2<T>::Set(const T& _new_x, const T& _new_y)
+constexpr void Vector2<T>::Set(const T& _new_x, const T& _new_y)
 {
     x = _new_x;
     y = _new_y;
 }
 
 template<typename T>
-void Vector2<T>::Set(const Vector2& _rhs)
+constexpr void Vector2<T>::Set(const Vector2& _rhs)
 {
     x = _rhs.x;
     y = _rhs.y;
 }
 
 template<typename T>
-const Vector2<T> Vector2<T>::Zero(0, 0);
+constexpr Vector2<T> Vector2<T>::Zero(0, 0);
 
 template<typename T>
-const Vector2<T> Vector2<T>::One(1, 1);
+constexpr Vector2<T> Vector2<T>::One(1, 1);
 
 template<typename T>
-const Vector2<T> Vector2<T>::UnitX(1, 0);
+constexpr Vector2<T> Vector2<T>::UnitX(1, 0);
 
 template<typename T>
-const Vector2<T> Vector2<T>::UnitY(0, 1);
+constexpr Vector2<T> Vector2<T>::UnitY(0, 1);
 
 template<typename T>
-const Vector2<T> Vector2<T>::Up(0, 1);
+constexpr Vector2<T> Vector2<T>::Up(0, 1);
 
 template<typename T>
-const Vector2<T> Vector2<T>::Down(0, -1);
+constexpr Vector2<T> Vector2<T>::Down(0, -1);
 
 template<typename T>
-const Vector2<T> Vector2<T>::Left(-1, 0);
+constexpr Vector2<T> Vector2<T>::Left(-1, 0);
 
 template<typename T>
-const Vector2<T> Vector2<T>::Right(1, 0);
+constexpr Vector2<T> Vector2<T>::Right(1, 0);
 
 }
 
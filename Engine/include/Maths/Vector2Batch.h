@@ -0,0 +1,140 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "Maths/Vector2.h"
+
+namespace Maths
+{
+	class Transform2D;
+
+	/**
+	 * \struct ConstVector2Span
+	 * \brief Read-only vectors stored as separate arrays of x and y.
+	 */
+	struct ConstVector2Span
+	{
+		const float* x = nullptr;
+		const float* y = nullptr;
+		std::size_t size = 0;
+	};
+
+	/**
+	 * \struct Vector2Span
+	 * \brief Vectors stored as separate arrays of x and y, written by the batch kernels.
+	 */
+	struct Vector2Span
+	{
+		float* x = nullptr;
+		float* y = nullptr;
+		std::size_t size = 0;
+
+		operator ConstVector2Span() const { return {x, y, size}; }
+	};
+
+	/**
+	 * \class Vector2Array
+	 * \brief Array of Vector2f stored as structure of arrays, the layout the batch kernels work on.
+	 */
+	class Vector2Array
+	{
+	public:
+		Vector2Array() = default;
+		explicit Vector2Array(const std::size_t _size) : x(_size), y(_size) {}
+
+		std::size_t Size() const { return x.size(); }
+
+		void Resize(const std::size_t _size)
+		{
+			x.resize(_size);
+			y.resize(_size);
+		}
+
+		Vector2f Get(const std::size_t _index) const { return Vector2f(x[_index], y[_index]); }
+
+		void Set(const std::size_t _index, const Vector2f& _value)
+		{
+			x[_index] = _value.x;
+			y[_index] = _value.y;
+		}
+
+		Vector2Span GetSpan() { return {x.data(), y.data(), x.size()}; }
+		ConstVector2Span GetSpan() const { return {x.data(), y.data(), x.size()}; }
+
+		operator Vector2Span() { return GetSpan(); }
+		operator ConstVector2Span() const { return GetSpan(); }
+
+	private:
+		std::vector<float> x;
+		std::vector<float> y;
+	};
+
+	/**
+	 * \brief Operations on many vectors at once, with SIMD kernels chosen for the CPU at startup.
+	 *
+	 * Each result is bit for bit the one of the matching Vector2f operation: kernels use the
+	 * same operations in the same order, without fused multiply-add nor approximate square
+	 * roots. Outputs may alias inputs, the number of vectors processed is the smallest size.
+	 */
+	namespace Vector2Batch
+	{
+		enum class SimdLevel : std::uint8_t
+		{
+			Scalar,
+			Sse2,
+			Avx2
+		};
+
+		/**
+		 * \brief Gets the best instruction set supported by the CPU.
+		 * \return The detected level, Scalar on CPUs other than x86.
+		 */
+		SimdLevel GetSupportedSimdLevel();
+
+		/**
+		 * \brief Gets the kernels in use.
+		 * \return The level of the kernels in use.
+		 */
+		SimdLevel GetSimdLevel();
+
+		/**
+		 * \brief Selects the kernels, to compare them. Not thread-safe, to call before using batches.
+		 * \param _level The level, lowered to the supported one.
+		 */
+		void SetSimdLevel(SimdLevel _level);
+
+		const char* GetSimdLevelName(SimdLevel _level);
+
+		/// _out = _lhs + _rhs
+		void Add(ConstVector2Span _lhs, ConstVector2Span _rhs, Vector2Span _out);
+
+		/// _out = _lhs + _rhs * _scale, to integrate velocities.
+		void AddScaled(ConstVector2Span _lhs, ConstVector2Span _rhs, float _scale, Vector2Span _out);
+
+		/// _out = _vectors + _offset, to apply a uniform acceleration.
+		void Translate(ConstVector2Span _vectors, const Vector2f& _offset, Vector2Span _out);
+
+		/// _out = _vectors * _scale
+		void Scale(ConstVector2Span _vectors, float _scale, Vector2Span _out);
+
+		/// _out = Vector2f::Lerp(_lhs, _rhs, _alpha)
+		void Lerp(ConstVector2Span _lhs, ConstVector2Span _rhs, float _alpha, Vector2Span _out);
+
+		/// _out = _vectors.NormalizeSafe()
+		void Normalize(ConstVector2Span _vectors, Vector2Span _out);
+
+		/// _out = _vectors.Rotate(_angle), _angle in radians.
+		void Rotate(ConstVector2Span _vectors, float _angle, Vector2Span _out);
+
+		/// _out[i] = _vectors[i].Magnitude(), _out holds at least _vectors.size floats.
+		void Length(ConstVector2Span _vectors, float* _out);
+
+		/// _out[i] = _lhs[i].Distance(_rhs[i]), _out holds at least the smallest size.
+		void Distance(ConstVector2Span _lhs, ConstVector2Span _rhs, float* _out);
+
+		/// _out = _transform.TransformPoint(_points)
+		void Transform(ConstVector2Span _points, const Transform2D& _transform, Vector2Span _out);
+	}
+}
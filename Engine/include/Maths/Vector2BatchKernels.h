@@ -0,0 +1,48 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#if defined(_M_X64) || defined(_M_IX86) || defined(__x86_64__) || defined(__i386__)
+#define VECTOR2_BATCH_X86
+#endif
+
+namespace Maths::Vector2Batch
+{
+	/**
+	 * \struct Kernels
+	 * \brief Implementation of the batch operations for one instruction set, on raw arrays.
+	 */
+	struct Kernels
+	{
+		void (*add)(const float* _ax, const float* _ay, const float* _bx, const float* _by, float* _out_x, float* _out_y, std::size_t _count);
+		void (*addScaled)(const float* _ax, const float* _ay, const float* _bx, const float* _by, float _scale, float* _out_x, float* _out_y, std::size_t _count);
+		void (*translate)(const float* _ax, const float* _ay, float _offset_x, float _offset_y, float* _out_x, float* _out_y, std::size_t _count);
+		void (*scale)(const float* _ax, const float* _ay, float _scale, float* _out_x, float* _out_y, std::size_t _count);
+		void (*lerp)(const float* _ax, const float* _ay, const float* _bx, const float* _by, float _alpha, float* _out_x, float* _out_y, std::size_t _count);
+		void (*normalize)(const float* _ax, const float* _ay, float* _out_x, float* _out_y, std::size_t _count);
+		void (*rotate)(const float* _ax, const float* _ay, float _cos, float _sin, float* _out_x, float* _out_y, std::size_t _count);
+		void (*length)(const float* _ax, const float* _ay, float* _out, std::size_t _count);
+		void (*distance)(const float* _ax, const float* _ay, const float* _bx, const float* _by, float* _out, std::size_t _count);
+
+		/// _matrix holds a, b, c, d, tx and ty of a Transform2D.
+		void (*transform)(const float* _ax, const float* _ay, const float* _matrix, float* _out_x, float* _out_y, std::size_t _count);
+
+		/// _query holds min x, min y, max x and max y, returns the number of indices written, from _first_index.
+		std::size_t (*overlapping)(const float* _min_x, const float* _min_y, const float* _max_x, const float* _max_y, const float* _query, std::uint32_t _first_index, std::uint32_t* _out, std::size_t _count);
+
+		/// _values[i] += _rates[i] * _scale, returns the number of indices written of the values reaching _limit, from _first_index.
+		std::size_t (*addScaledReaching)(float* _values, const float* _rates, float _scale, float _limit, std::uint32_t _first_index, std::uint32_t* _out, std::size_t _count);
+	};
+
+	/// Reference implementation, the SIMD kernels finish the last vectors with it.
+	extern const Kernels ScalarKernels;
+
+	/// Kernels selected by SetSimdLevel, for the batches built on them.
+	const Kernels& GetActiveKernels();
+
+#ifdef VECTOR2_BATCH_X86
+	extern const Kernels Sse2Kernels;
+	extern const Kernels Avx2Kernels;
+#endif
+}
@@ -9,7 +9,7 @@ public:
 	ModuleManager() = default;
 	~ModuleManager();
 
-	void CreateDefaultModules();
+	void CreateDefaultModules(bool _headless = false);
 	void AddModule(Module* _module);
 
 	void Awake() const;
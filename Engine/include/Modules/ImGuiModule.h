@@ -1,12 +1,55 @@
 #pragma once
 
+#include <string>
+#include <vector>
+
 #include "Module.h"
+#include "ResourcesModule.h"
 #include "SceneModule.h"
 #include "TimeModule.h"
 #include "WindowModule.h"
 
+/**
+ * \class ImGuiModule
+ * \brief Debug window listing the scenes and inspecting the selected game object.
+ *
+ * Only the visible rows of the hierarchy are drawn, and searching goes through an index
+ * of the names, so the cost of the open window does not grow with the scenes. While
+ * the window is closed no ImGui frame is built nor rendered.
+ *
+ * Only created in builds defining ENGINE_DEBUG_UI, the Debug configuration. The other
+ * configurations do not compile this module nor ImGui.
+ */
 class ImGuiModule final : public Module
 {
+public:
+	/**
+	 * \brief Checks if an ImGui frame is being built, components must not call ImGui otherwise.
+	 * \return True between the Update() and the PostRender() of a frame showing debug UI, always false without ENGINE_DEBUG_UI.
+	 */
+#ifdef ENGINE_DEBUG_UI
+	static bool IsFrameActive() { return frameActive; }
+#else
+	static bool IsFrameActive() { return false; }
+#endif
+
+private:
+	/**
+	 * \struct SceneIndex
+	 * \brief Lowercase names of the game objects of a scene, searched instead of the game objects.
+	 */
+	struct SceneIndex
+	{
+		const Scene* scene = nullptr;
+
+		/// Version of the game objects of the scene the names were read at.
+		std::uint32_t version = 0;
+		std::vector<std::string> names;
+
+		/// Indices of the game objects whose name contains the search filter.
+		std::vector<std::uint32_t> matches;
+	};
+
 	void Start() override;
 	void Update() override;
 	void PostRender() override;
@@ -14,19 +57,44 @@ class ImGuiModule final : public Module
 
 	void DisplayDebugWindow();
 	void DisplayScenesList();
-	void DisplayGameObjectsList(const Scene* _scene);
-	void DisplayGameObjectItem(const GameObject* _game_object);
+	void DisplayGameObjectsList(const Scene* _scene, const std::vector<std::uint32_t>* _matches);
+	void DisplayGameObjectItem(const GameObject* _game_object, std::uint32_t _index);
+
+	void DisplayGameObjectAsSelected(GameObject* _game_object);
 
-	void DisplayGameObjectAsSelected(const GameObject* _game_object);
+	/**
+	 * \brief Indexes the names of the scenes that changed and filters them again if the search changed.
+	 * Names are indexed again when a game object of the scene is created, destroyed or renamed.
+	 * \param _scenes The scenes displayed.
+	 */
+	void UpdateSearchIndex(const std::vector<Scene*>& _scenes);
+
+	void DisplayTransitionStats() const;
+	void DisplayResourcesStats() const;
 
 	SceneModule* sceneModule = nullptr;
 	WindowModule* windowModule = nullptr;
 	TimeModule* timeModule = nullptr;
+	ResourcesModule* resourcesModule = nullptr;
 
 	GameObject* selectedGameObject = nullptr;
+	std::uint32_t selectedScenesVersion = 0;
+
+	/// Scene of the selected game object and its game objects version, the object is looked for again once it changes.
+	Scene* selectedScene = nullptr;
+	std::uint32_t selectedGameObjectsVersion = 0;
 
 	bool displayDebugWindow = false;
 
+	static bool frameActive;
+
+	char searchFilter[128] = {};
+	std::vector<SceneIndex> searchIndex;
+
+	/// Lowercase filter the matches were computed with.
+	std::string indexedFilter;
+	std::uint32_t indexedScenesVersion = 0;
+
 protected:
 	~ImGuiModule() = default;
 };
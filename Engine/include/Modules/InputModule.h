@@ -1,17 +1,40 @@
 #pragma once
 
+#include <array>
 #include <bitset>
+#include <cstdint>
+#include <span>
 
 #include <SFML/Graphics/RenderWindow.hpp>
+#include <SFML/Window/Event.hpp>
 #include <SFML/Window/Keyboard.hpp>
 #include <SFML/Window/Mouse.hpp>
 
 #include "Module.h"
+#include "Input/ActionMap.h"
+#include "Input/InputRecording.h"
+#include "Input/Joystick.h"
 #include "Maths/Vector2.h"
 
+/**
+ * \class InputModule
+ * \brief Captures the input once per frame, every query of the frame reads that snapshot.
+ *
+ * Held keys and buttons are tracked from the window events, which also mark the keys
+ * and buttons pressed and released during the frame, so a tap shorter than a frame is
+ * still seen. Joysticks are polled from a JoystickSource, their pressed and released
+ * states compare them with the previous frame. Nothing is allocated nor queried from
+ * the operating system when a value is read.
+ */
 class InputModule final : public Module
 {
 public:
+	/// Events kept per frame, the state still follows the events past it.
+	static constexpr std::size_t MaxEvents = 256;
+
+	/// Characters kept by the text input ring buffer.
+	static constexpr std::size_t TextCapacity = 256;
+
 	void Start() override;
 	void Update() override;
 
@@ -27,18 +50,116 @@ public:
 	static bool GetMouseButtonUp(sf::Mouse::Button _button);
 	static bool GetKeyUp(sf::Keyboard::Key _key);
 
-	static const std::vector<sf::Event>& GetEvents() { return events; }
+	static bool IsJoystickConnected(const unsigned int _joystick) { return _joystick < sf::Joystick::Count && joysticks[_joystick].connected; }
+	static bool WasJoystickConnected(unsigned int _joystick);
+	static bool WasJoystickDisconnected(unsigned int _joystick);
+
+	static bool GetJoystickButton(unsigned int _joystick, unsigned int _button);
+	static bool GetJoystickButtonDown(unsigned int _joystick, unsigned int _button);
+	static bool GetJoystickButtonUp(unsigned int _joystick, unsigned int _button);
+
+	/**
+	 * \brief Gets the position of a joystick axis.
+	 * \param _joystick The joystick slot.
+	 * \param _axis The axis.
+	 * \return The position in [-1, 1], with the dead zone removed.
+	 */
+	static float GetJoystickAxis(unsigned int _joystick, sf::Joystick::Axis _axis);
+
+	/**
+	 * \brief Gets the state of a joystick for the frame.
+	 * \param _joystick The joystick slot, lower than sf::Joystick::Count.
+	 * \return The state of the joystick.
+	 */
+	static const JoystickState& GetJoystick(const unsigned int _joystick) { return joysticks[_joystick]; }
+
+	/**
+	 * \brief Replaces where joysticks are read from, to simulate devices.
+	 * \param _source The source, not owned, nullptr to read the devices through SFML again.
+	 */
+	void SetJoystickSource(JoystickSource* _source) { joystickSource = _source; }
+
+	/**
+	 * \brief Gets the actions, evaluated at the end of every Update().
+	 * \return The action map, to add actions and rebind them.
+	 */
+	static ActionMap& GetActions() { return actions; }
+
+	static bool GetAction(const ActionId _action) { return actions.IsPressed(_action); }
+	static bool GetActionDown(const ActionId _action) { return actions.WasPressedThisFrame(_action); }
+	static bool GetActionUp(const ActionId _action) { return actions.WasReleasedThisFrame(_action); }
+	static float GetAxis(const ActionId _action) { return actions.GetValue(_action); }
+	static Maths::Vector2f GetAxis2D(const ActionId _action) { return actions.GetValue2D(_action); }
+
+	/**
+	 * \brief Gets the window events of the frame, without copying them.
+	 * \return View on the events, valid until the next Update().
+	 */
+	static std::span<const sf::Event> GetEvents() { return std::span<const sf::Event>(events.data(), eventCount); }
+
+	/**
+	 * \brief Gets the position of the text input after the last character entered.
+	 * \return The number of characters entered since the beginning, the cursor to give to ReadText().
+	 */
+	static std::uint64_t GetTextCursor() { return textWritten; }
+
+	/**
+	 * \brief Reads the characters entered since a cursor, for text fields reading at their own pace.
+	 * Only the last TextCapacity characters are kept, older ones are skipped.
+	 * \param _cursor The position of the first character to read, moved past the characters read.
+	 * \param _output The buffer receiving the characters.
+	 * \param _capacity The size of the buffer.
+	 * \return The number of characters read.
+	 */
+	static std::size_t ReadText(std::uint64_t& _cursor, char32_t* _output, std::size_t _capacity);
+
+	/**
+	 * \brief Copies the input state of the current frame, to record it.
+	 * \param _frame The frame to assign, its delta time is left untouched.
+	 */
+	static void GetFrame(InputFrame& _frame);
+
+	/**
+	 * \brief Makes the next Update() read a recorded frame instead of the window.
+	 * \param _frame The frame to replay, must stay valid until the next Update(), nullptr to read live input.
+	 */
+	void SetReplayedFrame(const InputFrame* _frame) { replayedFrame = _frame; }
 
 private:
+	/**
+	 * \brief Stores an event of the frame and applies it to the held, pressed and released states.
+	 * \param _event The event.
+	 */
+	static void ProcessEvent(const sf::Event& _event);
+
+	/// Null in headless mode, no event is read then.
 	sf::RenderWindow* window = nullptr;
 
+	const InputFrame* replayedFrame = nullptr;
+
+	SfmlJoystickSource sfmlJoystickSource;
+	JoystickSource* joystickSource = nullptr;
+
 	static Maths::Vector2i mousePosition;
 	static Maths::Vector2i mouseDelta;
 
-	static std::bitset<sf::Keyboard::Key::KeyCount> keyDown;
-	static std::bitset<sf::Keyboard::Key::KeyCount> keyUp;
-	static std::bitset<sf::Mouse::Button::ButtonCount> mouseDown;
-	static std::bitset<sf::Mouse::Button::ButtonCount> mouseUp;
+	static std::bitset<sf::Keyboard::Key::KeyCount> keys;
+	static std::bitset<sf::Mouse::Button::ButtonCount> mouseButtons;
+
+	/// Keys and buttons pressed and released by the events of the frame, both set by a tap within the frame.
+	static std::bitset<sf::Keyboard::Key::KeyCount> keysDown;
+	static std::bitset<sf::Keyboard::Key::KeyCount> keysUp;
+	static std::bitset<sf::Mouse::Button::ButtonCount> mouseButtonsDown;
+	static std::bitset<sf::Mouse::Button::ButtonCount> mouseButtonsUp;
+
+	static JoystickStates joysticks;
+	static JoystickStates previousJoysticks;
+
+	static std::array<sf::Event, MaxEvents> events;
+	static std::size_t eventCount;
+
+	static ActionMap actions;
 
-	static std::vector<sf::Event> events;
+	static std::array<char32_t, TextCapacity> text;
+	static std::uint64_t textWritten;
 };
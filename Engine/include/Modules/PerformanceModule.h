@@ -0,0 +1,150 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <filesystem>
+#include <vector>
+
+#include <SFML/Graphics/VertexArray.hpp>
+
+#include "Engine.h"
+#include "Module.h"
+
+class ResourcesModule;
+class SceneModule;
+class WindowModule;
+
+/**
+ * \class PerformanceModule
+ * \brief Frame time statistics, shown by a lightweight HUD and appended to a CSV file on demand.
+ *
+ * The HUD is a single vertex array, text included through a built-in pixel font, drawn
+ * in one draw call without ImGui so it is available in every build. F2 toggles it, F3
+ * appends the statistics to the CSV file.
+ */
+class PerformanceModule final : public Module
+{
+public:
+	static constexpr std::size_t PhaseCount = static_cast<std::size_t>(Engine::FramePhase::Count);
+
+	/// Frames kept, the oldest are overwritten.
+	static constexpr std::size_t MaxSamples = 1024;
+
+	/**
+	 * \struct FrameSample
+	 * \brief Measures of one frame.
+	 */
+	struct FrameSample
+	{
+		/// Duration of the frame, in seconds.
+		float frameTime = 0.0f;
+
+		/// Duration of each Engine::FramePhase, in seconds.
+		std::array<float, PhaseCount> phaseTimes = {};
+
+		std::uint32_t drawCalls = 0;
+	};
+
+	/**
+	 * \struct Stats
+	 * \brief Statistics over the frames of the last seconds.
+	 */
+	struct Stats
+	{
+		std::uint32_t frames = 0;
+
+		/// Sum of the frame times, in seconds.
+		float duration = 0.0f;
+
+		/// Frame time percentiles, in seconds.
+		float p50 = 0.0f;
+		float p95 = 0.0f;
+		float p99 = 0.0f;
+		float max = 0.0f;
+
+		/// Average duration of each Engine::FramePhase, in seconds.
+		std::array<float, PhaseCount> phaseTimes = {};
+
+		float drawCalls = 0.0f;
+		std::size_t gameObjects = 0;
+		std::size_t resourceBytes = 0;
+
+		/// Memory of the process, 0 where it cannot be read.
+		std::size_t processBytes = 0;
+	};
+
+	void Start() override;
+	void Update() override;
+	void PostRender() override;
+
+	void SetVisible(const bool _visible) { visible = _visible; }
+	bool IsVisible() const { return visible; }
+
+	/**
+	 * \brief Sets how many seconds of frames the statistics cover.
+	 * \param _seconds The duration, 5 seconds by default.
+	 */
+	void SetStatsWindow(const float _seconds) { statsWindow = _seconds; }
+
+	void SetCsvPath(const std::filesystem::path& _path) { csvPath = _path; }
+	const std::filesystem::path& GetCsvPath() const { return csvPath; }
+
+	/**
+	 * \brief Computes the statistics of the last frames.
+	 * \return The statistics, valid until the next call.
+	 */
+	const Stats& ComputeStats();
+
+	/**
+	 * \brief Appends the statistics of the last frames as a CSV row, with a header if the file is new.
+	 * \param _path The path of the file.
+	 * \return True if the row was written.
+	 */
+	bool DumpCsv(const std::filesystem::path& _path);
+
+	/**
+	 * \brief Gets a frame among the recorded ones.
+	 * \param _age 0 for the last completed frame, 1 for the one before...
+	 * \return The frame.
+	 */
+	const FrameSample& GetSample(const std::size_t _age) const { return samples[(nextSample + MaxSamples - 1 - _age) % MaxSamples]; }
+
+	std::size_t GetSampleCount() const { return sampleCount; }
+
+private:
+	/**
+	 * \brief Rebuilds the vertices of the HUD.
+	 */
+	void BuildHud();
+
+	WindowModule* windowModule = nullptr;
+	SceneModule* sceneModule = nullptr;
+	ResourcesModule* resourcesModule = nullptr;
+
+	std::array<FrameSample, MaxSamples> samples;
+	std::size_t nextSample = 0;
+	std::size_t sampleCount = 0;
+
+	/// False until a frame completed, Update() records the previous frame.
+	bool hasFrame = false;
+
+	float statsWindow = 5.0f;
+	Stats stats;
+
+	/// Frame times of the stats window, reused to sort them.
+	std::vector<float> sortedTimes;
+
+	std::filesystem::path csvPath = "performance.csv";
+
+	bool visible = false;
+
+	/// Background and text first, they are kept between refreshes, the graph follows them.
+	sf::VertexArray hud;
+	std::size_t hudTextVertexCount = 0;
+
+	/// Time until the text is refreshed, a few times per second to stay readable.
+	float hudRefreshTime = 0.0f;
+
+protected:
+	~PerformanceModule() = default;
+};
@@ -0,0 +1,59 @@
+#pragma once
+
+#include <memory>
+
+#include "Module.h"
+#include "WorkerPool.h"
+
+class SceneModule;
+class TimeModule;
+
+/**
+ * \class PhysicsModule
+ * \brief Steps the physics world of every scene, then updates its collision world and dispatches the collisions.
+ *
+ * Created after SceneModule, the game objects moved this frame before their pairs are found.
+ * The physics worlds are stepped with a fixed time step, zero or more times per frame,
+ * so the simulation does not depend on the frame rate. Contacts, islands and the moves of
+ * the bodies are shared between the threads of a WorkerPool, with the same result whatever
+ * their number. The broadphase runs on the main thread.
+ */
+class PhysicsModule final : public Module
+{
+public:
+	void Start() override;
+	void Update() override;
+
+	float GetFixedDeltaTime() const { return fixedDeltaTime; }
+	void SetFixedDeltaTime(const float _fixed_delta_time) { fixedDeltaTime = _fixed_delta_time; }
+
+	/**
+	 * \brief Limits the steps of one frame, a long frame slows the simulation down instead of taking longer to catch up.
+	 * \param _max_steps The maximum number of steps per frame.
+	 */
+	void SetMaxStepsPerFrame(const int _max_steps) { maxStepsPerFrame = _max_steps; }
+	int GetMaxStepsPerFrame() const { return maxStepsPerFrame; }
+
+	/**
+	 * \brief Sets the number of threads stepping the physics, the main thread included.
+	 * \param _thread_count The number of threads, 1 to step on the main thread only.
+	 */
+	void SetThreadCount(std::size_t _thread_count);
+	std::size_t GetThreadCount() const { return workers ? workers->GetThreadCount() : 1; }
+
+protected:
+	~PhysicsModule() = default;
+
+private:
+	SceneModule* sceneModule = nullptr;
+	TimeModule* timeModule = nullptr;
+
+	/// Created on start unless set before, one thread per core up to 4.
+	std::unique_ptr<WorkerPool> workers;
+
+	float fixedDeltaTime = 1.0f / 60.0f;
+	int maxStepsPerFrame = 4;
+
+	/// Frame time not simulated yet, less than a step.
+	float accumulator = 0.0f;
+};
@@ -0,0 +1,98 @@
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <filesystem>
+
+#include "Module.h"
+
+#include "Input/InputRecording.h"
+
+class InputModule;
+class TimeModule;
+
+/**
+ * \class ReplayModule
+ * \brief Records the input and delta time of every frame, and feeds a recording back for deterministic runs.
+ *
+ * Created before the other modules so a replayed frame is handed to TimeModule and
+ * InputModule before they update. A frame is recorded at the beginning of the next
+ * one, once everything read it, the last one when the module is finalized.
+ */
+class ReplayModule final : public Module
+{
+public:
+	/**
+	 * \struct ReplayStats
+	 * \brief Duration of the last replay, to compare runs of the same workload.
+	 */
+	struct ReplayStats
+	{
+		std::uint32_t frames = 0;
+
+		/// Sum of the replayed delta times, in seconds.
+		float simulatedTime = 0.0f;
+
+		/// Time the replay took, in seconds.
+		float realTime = 0.0f;
+	};
+
+	void Start() override;
+	void Update() override;
+	void Finalize() override;
+
+	/**
+	 * \brief Starts recording the following frames to a file, stopping any replay.
+	 * \param _path The path of the recording.
+	 * \return True if the file was created.
+	 */
+	bool StartRecording(const std::filesystem::path& _path);
+
+	/**
+	 * \brief Writes the last frame and closes the recording.
+	 */
+	void StopRecording();
+
+	/**
+	 * \brief Replays a recording from the next frame, stopping any recording.
+	 * In headless mode the engine quits when the replay ends.
+	 * \param _path The path of the recording.
+	 * \return True if the recording was read.
+	 */
+	bool StartReplay(const std::filesystem::path& _path);
+
+	/**
+	 * \brief Stops replaying, input and time are read live again from the next frame.
+	 */
+	void StopReplay();
+
+	bool IsRecording() const { return recording.IsWriting(); }
+	bool IsReplaying() const { return recording.IsReading(); }
+
+	const ReplayStats& GetReplayStats() const { return replayStats; }
+
+private:
+	using Clock = std::chrono::steady_clock;
+
+	/**
+	 * \brief Writes the frame that just ended.
+	 */
+	void RecordFrame();
+
+	TimeModule* timeModule = nullptr;
+	InputModule* inputModule = nullptr;
+
+	InputRecording recording;
+
+	/// Frame being recorded or replayed, kept to reuse its events buffer.
+	InputFrame frame;
+
+	/// False until a frame ran since the recording started.
+	bool hasFrameToRecord = false;
+
+	ReplayStats replayStats;
+	Clock::time_point replayStart;
+
+protected:
+	~ReplayModule() = default;
+};
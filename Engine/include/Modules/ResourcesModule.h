@@ -1,38 +1,268 @@
 #pragma once
 
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <list>
+#include <mutex>
 #include <string>
+#include <thread>
 #include <unordered_map>
+#include <vector>
 
 #include "Module.h"
 
+#include "Resources/AssetPack.h"
+#include "Resources/FileWatcher.h"
 #include "Resources/ResourceBase.h"
+#include "Resources/ResourceHandle.h"
 
 class ResourcesModule final : public Module
 {
+	friend class AResource;
+
+public:
+	/**
+	 * \struct CacheStats
+	 * \brief Counters of the resource cache.
+	 */
+	struct CacheStats
+	{
+		std::uint64_t hits = 0;
+		std::uint64_t misses = 0;
+		std::uint64_t evictions = 0;
+		std::uint64_t reloads = 0;
+		std::size_t residentBytes = 0;
+		std::size_t budgetBytes = 256 * 1024 * 1024;
+		std::size_t residentCount = 0;
+		std::size_t unreferencedCount = 0;
+	};
+
+	void Start() override;
+	void Update() override;
+	void Finalize() override;
+
+	/**
+	 * \brief Mounts an asset pack, resources found in it are loaded from the mapping instead of loose files.
+	 * \param _path The path to the pack file.
+	 * \return True if the pack was mounted, false otherwise.
+	 */
+	bool MountPack(const std::string& _path);
+
+	/**
+	 * \brief Unmounts the asset pack, resources are loaded from loose files again.
+	 */
+	void UnmountPack();
+
+	bool IsPackMounted() const { return assetPack.IsOpen(); }
+
+	/**
+	 * \brief Enables hot-reload: modified files of the assets folder are decoded by a background thread
+	 * and swapped into their cached resource at the next frame boundary. Enabled by default in debug builds.
+	 * \param _enabled Whether hot-reload is enabled.
+	 * \return True if hot-reload is in the requested state, false if the assets folder could not be watched.
+	 */
+	bool SetHotReload(bool _enabled);
+
+	bool IsHotReloadEnabled() const { return fileWatcher.IsRunning(); }
+
+	/**
+	 * \brief Loads a resource, or gets it from the cache, and adds a reference to it.
+	 * \tparam T The type of the resource.
+	 * \param _name The name of the resource, relative to the assets folder.
+	 * \return The resource, to give back with ReleaseResource(), or nullptr if it could not be loaded.
+	 */
+	template<typename T>
+	T* LoadResource(const std::string& _name);
+
+	/**
+	 * \brief Loads a resource, or gets it from the cache, as a handle releasing its reference automatically.
+	 * \tparam T The type of the resource.
+	 * \param _name The name of the resource, relative to the assets folder.
+	 * \return The handle, empty if the resource could not be loaded.
+	 */
+	template<typename T>
+	ResourceHandle<T> Acquire(const std::string& _name);
+
+	/**
+	 * \brief Removes a reference from a resource, unreferenced resources are evicted when over budget.
+	 * Can be called from any thread, the cache is updated at the next frame boundary.
+	 * \param _resource The resource to release.
+	 */
+	static void ReleaseResource(AResource* _resource);
+
+	/**
+	 * \brief Sets the memory budget of the cache, unreferenced resources are evicted to fit in it.
+	 * \param _bytes The budget in bytes.
+	 */
+	void SetMemoryBudget(std::size_t _bytes);
+
+	/**
+	 * \brief Evicts every unreferenced resource, typically after a level transition.
+	 */
+	void EvictUnreferenced();
+
+	const CacheStats& GetStats() const { return stats; }
+
 protected:
 	~ResourcesModule() = default;
 
-	template<typename T>
-	ResourceBase<T>* LoadResource(const std::string& path)
+private:
+	/**
+	 * \struct ReloadJob
+	 * \brief A modified resource to decode, holding a weak reference to it.
+	 */
+	struct ReloadJob
 	{
-		using ResourceIterator = std::unordered_map<std::string, AResource*>::iterator;
+		AResource* resource = nullptr;
+		std::string path;
+		bool decoded = false;
+	};
 
-		if (ResourceIterator it = resources.find(path); it != resources.end())
-		{
-			return static_cast<T*>(it->second);
-		}
+	/**
+	 * \struct CacheEntry
+	 * \brief A resident resource with its place in the LRU list.
+	 */
+	struct CacheEntry
+	{
+		AResource* resource = nullptr;
+		std::list<AResource*>::iterator lruPosition;
+		bool unreferenced = false;
+	};
+
+	bool LoadFromPack(AResource* _resource, const std::string& _name);
+
+	void Insert(const std::string& _name, AResource* _resource);
+
+	/**
+	 * \brief Evicts least recently released resources until the resident size fits in the budget.
+	 * \param _budget The size to fit in.
+	 */
+	void Trim(std::size_t _budget);
+
+	/**
+	 * \brief Measures the resident size again, resources such as atlases grow after they are cached.
+	 */
+	void MeasureResidentBytes();
+
+	/**
+	 * \brief Queues a resource whose last reference was released, from any thread.
+	 * \param _resource The released resource.
+	 * \return False if the cache was finalized while the resource was referenced, the caller unloads it.
+	 */
+	bool QueueRelease(AResource* _resource);
+
+	/**
+	 * \brief Moves the queued resources still unreferenced to the LRU list, on the main thread.
+	 */
+	void ProcessReleaseQueue();
+
+	/**
+	 * \brief Unloads a resource on the main thread and drops the cache weak reference to it.
+	 * \param _resource The resource to evict.
+	 */
+	static void Evict(AResource* _resource);
 
-		ResourceBase<T>* resource = new ResourceBase<T>;
+	/**
+	 * \brief Sends the cached resources whose file changed to the reload thread.
+	 */
+	void QueueReloads();
 
-		if (resource->Load(path))
+	/**
+	 * \brief Swaps the decoded resources in, on the main thread.
+	 */
+	void ApplyReloads();
+
+	/**
+	 * \brief Body of the reload thread, decoding modified resources.
+	 */
+	void ReloadThread();
+
+	/**
+	 * \brief Stops the reload thread and drops the pending reloads.
+	 */
+	void StopReloadThread();
+
+	std::unordered_map<std::string, CacheEntry> resources;
+
+	/// Unreferenced resources, most recently released first.
+	std::list<AResource*> lruList;
+
+	CacheStats stats;
+
+	/// Resources released to zero references, possibly from other threads.
+	std::vector<AResource*> releaseQueue;
+	std::vector<AResource*> processedReleases;
+	std::mutex releaseQueueMutex;
+
+	/// Set by Finalize(), with the resources it left to their last release, both under the release queue mutex.
+	bool finalized = false;
+	std::vector<AResource*> orphanedResources;
+
+	AssetPack assetPack;
+
+	FileWatcher fileWatcher;
+
+	/// Modified files reported by the watcher, and the ones waiting for a reload in flight.
+	std::vector<std::string> changedFiles;
+	std::vector<std::string> deferredChanges;
+
+	/// Resources being decoded, touched by the main thread only.
+	std::vector<AResource*> reloadsInFlight;
+
+	std::thread reloadThread;
+	std::mutex reloadMutex;
+	std::condition_variable reloadCondition;
+	std::deque<ReloadJob> reloadJobs;
+	std::vector<ReloadJob> finishedReloads;
+	std::vector<ReloadJob> appliedReloads;
+	bool stopReloading = false;
+
+	/// Reused buffer receiving compressed assets from the pack.
+	std::vector<std::uint8_t> decompressionBuffer;
+};
+
+template<typename T>
+T* ResourcesModule::LoadResource(const std::string& _name)
+{
+	using ResourceIterator = std::unordered_map<std::string, CacheEntry>::iterator;
+
+	if (ResourceIterator it = resources.find(_name); it != resources.end())
+	{
+		CacheEntry& entry = it->second;
+		++stats.hits;
+		entry.resource->AddRef();
+
+		if (entry.unreferenced)
 		{
-			resources[path] = resource;
-			return resource;
+			lruList.erase(entry.lruPosition);
+			entry.lruPosition = lruList.end();
+			entry.unreferenced = false;
+			--stats.unreferencedCount;
 		}
 
+		return static_cast<T*>(entry.resource);
+	}
+
+	++stats.misses;
+
+	T* resource = new T();
+
+	const bool loaded = assetPack.Contains(_name) ? LoadFromPack(resource, _name) : resource->Load(AResource::GetPathFromName(_name).string());
+	if (!loaded)
+	{
+		resource->ReleaseWeakRef();
 		return nullptr;
 	}
 
-private:
-	std::unordered_map<std::string, AResource*> resources;
-};
+	Insert(_name, resource);
+	resource->AddRef();
+	Trim(stats.budgetBytes);
+	return resource;
+}
+
+template<typename T>
+ResourceHandle<T> ResourcesModule::Acquire(const std::string& _name)
+{
+	return ResourceHandle<T>::Adopt(LoadResource<T>(_name));
+}
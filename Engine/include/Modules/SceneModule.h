@@ -1,14 +1,39 @@
 #pragma once
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <thread>
 #include <vector>
 
+#include <SFML/Graphics/Rect.hpp>
+
 #include "Module.h"
 #include "Scene.h"
+#include "Resources/AssetPack.h"
 #include "TimeModule.h"
 #include "WindowModule.h"
 
 class SceneModule final : public Module
 {
 public:
+	/**
+	 * \struct TransitionStats
+	 * \brief Frame times measured while scenes are loaded in the background and activated.
+	 */
+	struct TransitionStats
+	{
+		/// Worst frame time of the current or last transition, in seconds.
+		float worstFrameTime = 0.0f;
+
+		/// Worst frame time of every transition so far, in seconds.
+		float worstFrameTimeEver = 0.0f;
+
+		std::uint32_t transitions = 0;
+		std::uint32_t pendingLoads = 0;
+	};
+
 	SceneModule();
 	~SceneModule() = default;
 
@@ -27,17 +52,177 @@ public:
 	void PreRender() override;
 	void Present() override;
 
+	/**
+	 * \brief Builds a scene in code on the main thread, it is active when this returns. Meant for startup.
+	 * \tparam T The type of the scene, built with its default constructor.
+	 * \param _replace_scenes Whether the scene replaces the current scenes.
+	 * \return The scene.
+	 */
 	template<typename T>
 	Scene* SetScene(bool _replace_scenes = true);
 
+	/**
+	 * \brief Builds a scene in code on the loading thread, it is activated at the beginning of a later frame.
+	 * The constructor of T must not load resources nor touch other scenes.
+	 * \tparam T The type of the scene, built with its default constructor.
+	 * \param _replace_scenes Whether the scene replaces the current scenes, or is added to them.
+	 */
+	template<typename T>
+	void SetSceneAsync(bool _replace_scenes = true);
+
+	/**
+	 * \brief Loads a scene saved with SceneSerializer, from the mounted asset pack or the assets folder.
+	 * \param _name The name of the scene file, relative to the assets folder.
+	 * \param _replace_scenes Whether the loaded scene replaces the current scenes.
+	 * \return The loaded scene, or nullptr if it could not be loaded.
+	 */
+	Scene* LoadScene(const std::string& _name, bool _replace_scenes = true);
+
+	/**
+	 * \brief Loads a scene on the loading thread, it is activated at the beginning of a later frame.
+	 * The asset pack mounted now is read, it must stay mounted until IsLoading() is false.
+	 * \param _name The name of the scene file, relative to the assets folder.
+	 * \param _replace_scenes Whether the loaded scene replaces the current scenes, or is added to them.
+	 */
+	void LoadSceneAsync(const std::string& _name, bool _replace_scenes = true);
+
+	/**
+	 * \brief Removes a scene at the beginning of the next frame, it is deleted at a later frame boundary.
+	 * \param _scene The scene to unload.
+	 */
+	void UnloadScene(Scene* _scene);
+
+	bool IsLoading() const { return transitionStats.pendingLoads > 0; }
+
+	/// Removed scenes whose game objects are still being deleted.
+	std::size_t GetRemovedSceneCount() const { return removedScenes.size(); }
+
+	/**
+	 * \brief Declares a sub-scene streamed in additively when the streaming focus gets close to its bounds.
+	 * \param _scene_name The name of the scene file, relative to the assets folder.
+	 * \param _bounds The world area covered by the scene.
+	 */
+	void AddStreamingRegion(const std::string& _scene_name, const sf::FloatRect& _bounds);
+
+	/**
+	 * \brief Moves the point around which regions are streamed, typically the player position.
+	 * \param _position The focus position.
+	 * \param _load_distance Regions closer than this distance are loaded.
+	 * \param _unload_distance Regions farther than this distance are unloaded, larger than the load distance to avoid reloading on the edge.
+	 */
+	void SetStreamingFocus(const Maths::Vector2f& _position, float _load_distance, float _unload_distance);
+
 	Scene* GetMainScene() const { return mainScene; }
 	const std::vector<Scene*>& GetScenes() const;
 	Scene* GetScene(const std::string& _scene_name) const;
 
+	const TransitionStats& GetTransitionStats() const { return transitionStats; }
+
+	/**
+	 * \brief Gets a counter incremented every time scenes are removed, to drop pointers to their game objects.
+	 * \return The version of the scenes list.
+	 */
+	std::uint32_t GetScenesVersion() const { return scenesVersion; }
+
 private:
+	/**
+	 * \struct LoadJob
+	 * \brief Work for the loading thread: a scene file to read, or a scene to build in code.
+	 */
+	struct LoadJob
+	{
+		std::string name;
+		bool replaceScenes = true;
+
+		/// Index of the streaming region requesting the scene, -1 for none.
+		int region = -1;
+
+		/// Builds the scene instead of reading the file if set.
+		Scene* (*build)() = nullptr;
+
+		/// The asset pack mounted when the job was queued, the loading thread never reads the current one.
+		const AssetPack* assetPack = nullptr;
+
+		/// Number of scene replacements when the job was queued, a region loaded for replaced scenes is dropped.
+		std::uint32_t replacements = 0;
+
+		/// The loaded scene once done.
+		Scene* scene = nullptr;
+	};
+
+	/**
+	 * \struct StreamingRegion
+	 * \brief A sub-scene covering an area of the world.
+	 */
+	struct StreamingRegion
+	{
+		std::string sceneName;
+		sf::FloatRect bounds;
+		Scene* scene = nullptr;
+		bool loading = false;
+	};
+
+	Scene* AddScene(Scene* _scene, bool _replace_scenes);
+	void RemoveScene(Scene* _scene);
+
+	/**
+	 * \brief Reads and deserializes a scene file, from any thread.
+	 * \param _name The name of the scene file.
+	 * \param _asset_pack The asset pack to read it from if it contains it, nullptr for the assets folder only.
+	 * \return The scene, or nullptr if it could not be loaded.
+	 */
+	static Scene* ReadScene(const std::string& _name, const AssetPack* _asset_pack);
+
+	template<typename T>
+	static Scene* BuildScene();
+
+	void QueueLoadJob(LoadJob&& _job);
+	void LoadingThread();
+	void StopLoadingThread();
+
+	void ProcessUnloads();
+	void ActivateLoadedScenes();
+
+	/// Game objects of removed scenes deleted per frame.
+	static constexpr std::size_t DeletedGameObjectsPerFrame = 1000;
+
+	/**
+	 * \brief Deletes some game objects of the removed scenes on the main thread, a scene once it is empty.
+	 */
+	void DeleteRemovedScenes();
+	void UpdateStreaming();
+	void RecordTransitionFrame();
+
 	std::vector<Scene*> scenes;
 	Scene* mainScene = nullptr;
 
+	bool started = false;
+	std::uint32_t scenesVersion = 0;
+
+	std::thread loadingThread;
+	std::mutex loadingMutex;
+	std::condition_variable loadingCondition;
+	std::deque<LoadJob> loadJobs;
+	std::vector<LoadJob> loadedScenes;
+	std::vector<LoadJob> activatedScenes;
+	bool stopLoading = false;
+
+	std::vector<Scene*> pendingUnloads;
+
+	/// Scenes removed from the list, deleted at the next frame boundaries.
+	std::vector<Scene*> removedScenes;
+	std::uint32_t replacements = 0;
+
+	std::vector<StreamingRegion> streamingRegions;
+	Maths::Vector2f streamingFocus;
+	float loadDistance = 0.0f;
+	float unloadDistance = 0.0f;
+
+	TransitionStats transitionStats;
+
+	/// Frames since a scene was activated, the frame after an activation measures it.
+	std::uint32_t framesSinceActivation = 2;
+
 	WindowModule* windowModule = nullptr;
 	TimeModule* timeModule = nullptr;
 };
@@ -45,20 +230,20 @@ private:
 template<typename T>
 Scene* SceneModule::SetScene(const bool _replace_scenes)
 {
-	if (_replace_scenes)
-	{
-		for (const Scene* scene : scenes)
-		{
-			delete scene;
-		}
-		scenes.clear();
-	}
-
-	Scene* scene = static_cast<Scene*>(new T());
-	scenes.push_back(scene);
+	return AddScene(BuildScene<T>(), _replace_scenes);
+}
 
-	if (_replace_scenes)
-		mainScene = scene;
+template<typename T>
+void SceneModule::SetSceneAsync(const bool _replace_scenes)
+{
+	LoadJob job;
+	job.replaceScenes = _replace_scenes;
+	job.build = &BuildScene<T>;
+	QueueLoadJob(std::move(job));
+}
 
-	return scene;
+template<typename T>
+Scene* SceneModule::BuildScene()
+{
+	return static_cast<Scene*>(new T());
 }
@@ -32,6 +32,12 @@ public:
 	 */
 	void Update() override;
 
+	/**
+	 * \brief Replaces the measured delta time of the next frame, to replay a recorded run.
+	 * \param _delta_time The delta time in seconds.
+	 */
+	void SetNextDeltaTime(float _delta_time);
+
 	/**
 	 * \brief Gets the time elapsed between the current and the previous frame.
 	 * \return The delta time in seconds.
@@ -65,4 +71,7 @@ private:
 
 	/// Time elapsed between the current and the previous frame.
 	float deltaTime = 0.0f;
+
+	/// Delta time of the next frame, negative to measure it.
+	float nextDeltaTime = -1.0f;
 };
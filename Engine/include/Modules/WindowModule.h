@@ -1,5 +1,7 @@
 #pragma once
 
+#include <cstdint>
+
 #include <SFML/Graphics/RenderWindow.hpp>
 
 #include "Module.h"
@@ -21,6 +23,19 @@ public:
 
 	void SetTitle(const std::string& _title) const;
 
+	/**
+	 * \brief Counts a draw submitted to the window, renderers call it for every draw.
+	 */
+	static void CountDrawCall() { ++drawCalls; }
+
+	/**
+	 * \brief Gets the draws counted since the window was last cleared.
+	 * \return The number of draws, those of the last frame until PreRender().
+	 */
+	static std::uint32_t GetDrawCallCount() { return drawCalls; }
+
 private:
 	sf::RenderWindow* window = nullptr;
+
+	static std::uint32_t drawCalls;
 };
@@ -0,0 +1,82 @@
+#pragma once
+
+#include <cstdint>
+
+/// Number of collision layers, a mask has one bit per layer.
+constexpr std::uint32_t CollisionLayerCount = 32;
+
+constexpr std::uint32_t AllLayers = 0xFFFFFFFF;
+
+/**
+ * \struct CollisionFilter
+ * \brief What a collider is and what it collides with, tested before the bounds of a pair.
+ */
+struct CollisionFilter
+{
+	/// Bit of the layer of the collider.
+	std::uint32_t layerBit = 1;
+
+	/// Layers the collider collides with, its own mask combined with the row of its layer in the CollisionMatrix.
+	std::uint32_t mask = AllLayers;
+
+	/// Reported to the callbacks without pushing bodies apart.
+	bool isTrigger = false;
+
+	/**
+	 * \brief Checks two colliders may collide, each must accept the layer of the other and two triggers have nothing to report.
+	 * \param _other The filter of the other collider.
+	 * \return True if the pair is kept.
+	 */
+	constexpr bool Accepts(const CollisionFilter& _other) const
+	{
+		return (mask & _other.layerBit) != 0 && (_other.mask & layerBit) != 0 && !(isTrigger && _other.isTrigger);
+	}
+};
+
+/**
+ * \class CollisionMatrix
+ * \brief Which layers collide with which, for every scene. All of them by default.
+ *
+ * Changes are picked up by the next CollisionWorld::Update(), which finds the pairs
+ * again: set the matrix once at startup rather than every frame. Layers past
+ * CollisionLayerCount - 1 are clamped to it, as by SquareCollider::SetLayer().
+ */
+class CollisionMatrix
+{
+public:
+	/**
+	 * \brief Sets whether two layers collide, both ways.
+	 * \param _layer_a A layer, from 0 to CollisionLayerCount - 1.
+	 * \param _layer_b The other layer, or the same one.
+	 * \param _collide Whether colliders of these layers collide.
+	 */
+	static void SetLayersCollide(std::uint32_t _layer_a, std::uint32_t _layer_b, bool _collide);
+
+	static bool DoLayersCollide(std::uint32_t _layer_a, std::uint32_t _layer_b);
+
+	/**
+	 * \brief Gets the layers colliding with a layer.
+	 * \param _layer The layer.
+	 * \return One bit per layer.
+	 */
+	static std::uint32_t GetMask(std::uint32_t _layer);
+
+	/**
+	 * \brief Makes every layer collide with every other one again.
+	 */
+	static void Reset();
+
+	/**
+	 * \brief Gets a number changed by every change of the matrix, for the worlds to notice it.
+	 */
+	static std::uint32_t GetVersion();
+
+	/**
+	 * \brief Builds the filter of a collider.
+	 * \param _layer The layer of the collider.
+	 * \param _mask The layers the collider collides with, before the matrix.
+	 * \param _is_trigger Whether the collider is a trigger.
+	 * \return The filter.
+	 */
+	static CollisionFilter MakeFilter(std::uint32_t _layer, std::uint32_t _mask, bool _is_trigger);
+};
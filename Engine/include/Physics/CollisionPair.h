@@ -0,0 +1,34 @@
+#pragma once
+
+#include <cstdint>
+
+/// Index of a collider in its CollisionWorld, reused once the collider is removed.
+using ColliderId = std::uint32_t;
+
+constexpr ColliderId InvalidCollider = 0xFFFFFFFF;
+
+/**
+ * \struct CollisionPair
+ * \brief Two colliders whose bounds overlap, a is the smallest id.
+ */
+struct CollisionPair
+{
+	ColliderId a = InvalidCollider;
+	ColliderId b = InvalidCollider;
+
+	/**
+	 * \brief Builds the pair of two colliders in either order.
+	 * \param _first A collider.
+	 * \param _second The other collider.
+	 * \return The pair, ordered.
+	 */
+	static constexpr CollisionPair Make(const ColliderId _first, const ColliderId _second)
+	{
+		return _first < _second ? CollisionPair{_first, _second} : CollisionPair{_second, _first};
+	}
+
+	/// Both ids in one integer, for hashing and sorting.
+	constexpr std::uint64_t GetKey() const { return static_cast<std::uint64_t>(a) << 32 | b; }
+
+	friend constexpr bool operator==(const CollisionPair& _lhs, const CollisionPair& _rhs) { return _lhs.a == _rhs.a && _lhs.b == _rhs.b; }
+};
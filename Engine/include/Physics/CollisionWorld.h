@@ -0,0 +1,217 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "Maths/Rect.h"
+#include "Maths/RectBatch.h"
+#include "Physics/CollisionFilter.h"
+#include "Physics/CollisionPair.h"
+#include "Physics/DynamicTree.h"
+#include "Physics/SweepAndPrune.h"
+
+class SquareCollider;
+
+/**
+ * \class CollisionWorld
+ * \brief The colliders of a scene and the pairs whose bounds overlap.
+ *
+ * Colliders register themselves when attached to a game object of the scene. The bounds
+ * of moving colliders are read every frame, static colliders only after Refresh().
+ * Pairs are filtered by the layers of the colliders before their bounds are tested,
+ * a pair filtered out is never reported: the brute force groups the colliders by layer
+ * and skips the layers that cannot collide, the sweep and prune checks the filters of
+ * two boxes before their bounds.
+ * Spatial queries go through a DynamicTree and see the bounds of the last Update(),
+ * they fill a vector given by the caller and allocate nothing once it is large enough.
+ */
+class CollisionWorld
+{
+public:
+	/**
+	 * \enum Broadphase
+	 * \brief How the overlapping pairs are found.
+	 */
+	enum class Broadphase : std::uint8_t
+	{
+		/// Every collider against every other one of the layers it collides with, for small scenes where everything moves.
+		BruteForce,
+
+		/// Sorted bounds updated by insertion sort, for large scenes where most colliders are static.
+		SweepAndPrune
+	};
+
+	/**
+	 * \struct RaycastHit
+	 * \brief The first collider hit by a segment.
+	 */
+	struct RaycastHit
+	{
+		SquareCollider* collider = nullptr;
+		Maths::Vector2f point;
+
+		/// Normal of the side hit, zero when the segment starts inside the collider.
+		Maths::Vector2f normal;
+
+		/// Position of the hit along the segment, 0 at its start and 1 at its end.
+		float fraction = 1.0f;
+	};
+
+	/**
+	 * \brief Adds a collider, its pairs are found by the next Update().
+	 * \param _collider The collider, attached to a game object.
+	 * \param _is_static Whether the collider never moves unless refreshed.
+	 * \return The id of the collider in the world.
+	 */
+	ColliderId AddCollider(SquareCollider* _collider, bool _is_static);
+
+	/**
+	 * \brief Removes a collider, it is not part of any pair dispatched afterwards.
+	 * \param _id The id returned by AddCollider().
+	 */
+	void RemoveCollider(ColliderId _id);
+
+	void SetStatic(ColliderId _id, bool _is_static);
+
+	/**
+	 * \brief Reads the bounds of a static collider again by the next Update(), after it moved or was resized.
+	 * \param _id The id of the collider.
+	 */
+	void RefreshCollider(ColliderId _id);
+
+	/**
+	 * \brief Reads the layer, mask and trigger flag of a collider again, its pairs are found again by the next Update().
+	 * Only this collider is taken out of the broadphase and put back, as cheap as adding it.
+	 * \param _id The id of the collider.
+	 */
+	void RefreshFilter(ColliderId _id);
+
+	/**
+	 * \brief Changes the broadphase, the pairs are found again by the next Update().
+	 * \param _broadphase The broadphase to use.
+	 */
+	void SetBroadphase(Broadphase _broadphase);
+	Broadphase GetBroadphase() const { return broadphase; }
+
+	/**
+	 * \brief Reads the bounds of the moving colliders and updates the overlapping pairs.
+	 */
+	void Update();
+
+	/**
+	 * \brief Calls Component::OnCollision() on both game objects of every pair, triggers included.
+	 */
+	void DispatchCollisions() const;
+
+	/**
+	 * \brief Gets the colliders whose bounds overlap, after Update().
+	 * \return The pairs, in no particular order.
+	 */
+	const std::vector<CollisionPair>& GetPairs() const;
+
+	/**
+	 * \brief Finds the colliders overlapping a rectangle, as Rectf::Overlaps.
+	 * \param _rect The rectangle, the view or an area of effect.
+	 * \param _results Cleared, then filled with the colliders found.
+	 * \param _layers The layers of the colliders to find, one bit per layer.
+	 * \return The number of colliders found.
+	 */
+	std::size_t QueryRect(const Maths::Rectf& _rect, std::vector<SquareCollider*>& _results, std::uint32_t _layers = AllLayers) const;
+
+	/**
+	 * \brief Finds the colliders containing a point, as Rectf::Contains, like what is under the mouse.
+	 * \param _point The point.
+	 * \param _results Cleared, then filled with the colliders found.
+	 * \param _layers The layers of the colliders to find, one bit per layer.
+	 * \return The number of colliders found.
+	 */
+	std::size_t QueryPoint(const Maths::Vector2f& _point, std::vector<SquareCollider*>& _results, std::uint32_t _layers = AllLayers) const;
+
+	/**
+	 * \brief Finds the colliders within a distance of a point, edges included.
+	 * \param _center The center of the circle.
+	 * \param _radius The radius of the circle.
+	 * \param _results Cleared, then filled with the colliders found.
+	 * \param _layers The layers of the colliders to find, one bit per layer.
+	 * \return The number of colliders found.
+	 */
+	std::size_t QueryCircle(const Maths::Vector2f& _center, float _radius, std::vector<SquareCollider*>& _results, std::uint32_t _layers = AllLayers) const;
+
+	/**
+	 * \brief Finds the first collider along a segment, for line of sight.
+	 * \param _from The start of the segment.
+	 * \param _to The end of the segment.
+	 * \param _hit The closest hit, left as is if nothing is hit.
+	 * \param _layers The layers of the colliders that stop the segment, one bit per layer.
+	 * \return True if a collider is hit.
+	 */
+	bool Raycast(const Maths::Vector2f& _from, const Maths::Vector2f& _to, RaycastHit& _hit, std::uint32_t _layers = AllLayers) const;
+
+	SquareCollider* GetCollider(const ColliderId _id) const { return proxies[_id].collider; }
+
+	/// Bounds of a collider as of the last Update(), or as added.
+	const Maths::Rectf& GetBounds(const ColliderId _id) const { return proxies[_id].bounds; }
+
+	const CollisionFilter& GetFilter(const ColliderId _id) const { return proxies[_id].filter; }
+
+	std::size_t GetColliderCount() const { return proxies.size() - freeIds.size() - releasedIds.size(); }
+
+	const SweepAndPrune& GetSweepAndPrune() const { return sweepAndPrune; }
+	const DynamicTree& GetTree() const { return tree; }
+
+private:
+	static constexpr std::uint32_t InvalidIndex = 0xFFFFFFFF;
+
+	/**
+	 * \struct Proxy
+	 * \brief A collider and the bounds known to the broadphase.
+	 */
+	struct Proxy
+	{
+		SquareCollider* collider = nullptr;
+		Maths::Rectf bounds;
+		CollisionFilter filter;
+
+		/// Index in dynamicIds, InvalidIndex for static colliders.
+		std::uint32_t dynamicIndex = InvalidIndex;
+
+		std::int32_t treeProxy = DynamicTree::NullNode;
+
+		bool refreshed = false;
+	};
+
+	void MoveProxy(ColliderId _id, const Maths::Rectf& _bounds);
+	void UpdateBruteForce();
+
+	/**
+	 * \brief Adds every collider to the sweep and prune again, its pairs are found by its next update.
+	 */
+	void ResetSweepAndPrune();
+
+	static CollisionFilter MakeFilter(const SquareCollider* _collider);
+
+	std::vector<Proxy> proxies;
+
+	std::vector<ColliderId> freeIds;
+
+	/// Removed ids, reused once the broadphase forgot them.
+	std::vector<ColliderId> releasedIds;
+
+	std::vector<ColliderId> dynamicIds;
+	std::vector<ColliderId> refreshedIds;
+
+	Broadphase broadphase = Broadphase::SweepAndPrune;
+	SweepAndPrune sweepAndPrune;
+	DynamicTree tree;
+
+	/// Proxies added to the tree since the last Update().
+	std::size_t treeAdditions = 0;
+
+	/// Version of the CollisionMatrix the filters were made with.
+	std::uint32_t matrixVersion = 0;
+
+	std::vector<CollisionPair> bruteForcePairs;
+	std::vector<ColliderId> bruteForceIds;
+	Maths::RectArray bruteForceBounds;
+	std::vector<std::uint32_t> overlapping;
+};
@@ -0,0 +1,193 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "Maths/Rect.h"
+
+/**
+ * \class DynamicTree
+ * \brief Bounding volume tree of rectangles, for queries of the colliders in an area, at a point or along a ray.
+ *
+ * Leaves hold the bounds grown by a margin, so a proxy moving a little stays inside
+ * them and the tree is left as is. Leaves are inserted next to the sibling that grows
+ * the tree the least, and the parents are refitted and rotated on the way up to keep
+ * the tree balanced. Nodes live in one array and are reused, queries walk it with a
+ * stack on the call stack: neither allocates once the tree is built.
+ */
+class DynamicTree
+{
+public:
+	static constexpr std::int32_t NullNode = -1;
+
+	/**
+	 * \brief Constructor.
+	 * \param _margin Distance added on each side of the leaves, a proxy moving less is not reinserted.
+	 */
+	explicit DynamicTree(float _margin = 4.0f) : margin(_margin) {}
+
+	/**
+	 * \brief Adds a leaf.
+	 * \param _bounds The bounds of the proxy.
+	 * \param _user_data The value given back by GetUserData().
+	 * \return The id of the proxy.
+	 */
+	std::int32_t CreateProxy(const Maths::Rectf& _bounds, std::uint32_t _user_data);
+
+	void DestroyProxy(std::int32_t _proxy);
+
+	/**
+	 * \brief Moves a proxy, reinserting it only if it left its fat bounds.
+	 * \param _proxy The id of the proxy.
+	 * \param _bounds The new bounds of the proxy.
+	 * \param _displacement The last move, the fat bounds are grown in this direction.
+	 * \return True if the proxy was reinserted.
+	 */
+	bool MoveProxy(std::int32_t _proxy, const Maths::Rectf& _bounds, const Maths::Vector2f& _displacement);
+
+	std::uint32_t GetUserData(const std::int32_t _proxy) const { return nodes[_proxy].userData; }
+	const Maths::Rectf& GetFatBounds(const std::int32_t _proxy) const { return nodes[_proxy].bounds; }
+
+	/**
+	 * \brief Calls a function for the proxies whose fat bounds overlap a rectangle.
+	 * \param _bounds The rectangle.
+	 * \param _callback Called with the id of each proxy, returns false to stop.
+	 */
+	template<typename Callback>
+	void Query(const Maths::Rectf& _bounds, Callback&& _callback) const;
+
+	/**
+	 * \brief Calls a function for the proxies whose fat bounds contain a point.
+	 * \param _point The point.
+	 * \param _callback Called with the id of each proxy, returns false to stop.
+	 */
+	template<typename Callback>
+	void QueryPoint(const Maths::Vector2f& _point, Callback&& _callback) const;
+
+	/**
+	 * \brief Calls a function for the proxies whose fat bounds are within a distance of a point.
+	 * \param _center The center of the circle.
+	 * \param _radius The radius of the circle.
+	 * \param _callback Called with the id of each proxy, returns false to stop.
+	 */
+	template<typename Callback>
+	void QueryCircle(const Maths::Vector2f& _center, float _radius, Callback&& _callback) const;
+
+	/**
+	 * \brief Calls a function for the proxies whose fat bounds a segment may cross, in no particular order.
+	 * \param _from The start of the segment.
+	 * \param _to The end of the segment.
+	 * \param _callback Called with the id of each proxy and the current max fraction of the segment.
+	 * Returns the new max fraction to clip the segment at a hit, the same fraction to go on, 0 to stop.
+	 */
+	template<typename Callback>
+	void Raycast(const Maths::Vector2f& _from, const Maths::Vector2f& _to, Callback&& _callback) const;
+
+	/**
+	 * \brief Builds the tree again from the top, splitting the proxies in halves, after many were added at once.
+	 * Inserted one by one in no particular order, like a scene load, they make a deeper tree with more overlap.
+	 */
+	void Rebuild();
+
+	void Clear();
+
+	/**
+	 * \brief Gets the height of the tree, a leaf alone has a height of 0.
+	 */
+	std::int32_t GetHeight() const { return root == NullNode ? 0 : nodes[root].height; }
+
+	std::size_t GetProxyCount() const { return proxyCount; }
+
+	/**
+	 * \brief Gets the sum of the perimeters of the nodes over the perimeter of the root, the cost of a query.
+	 */
+	float GetAreaRatio() const;
+
+	/**
+	 * \brief Checks the links, heights and bounds of every node, for tests and benchmarks.
+	 * \return True if the tree is consistent.
+	 */
+	bool Validate() const;
+
+private:
+	/**
+	 * \struct Node
+	 * \brief A leaf holding a proxy, or the union of two children.
+	 */
+	struct Node
+	{
+		/// Fat bounds for a leaf.
+		Maths::Rectf bounds;
+
+		/// The parent, or the next free node.
+		std::int32_t parent = NullNode;
+
+		std::int32_t child1 = NullNode;
+		std::int32_t child2 = NullNode;
+
+		/// 0 for a leaf, -1 for a free node.
+		std::int32_t height = -1;
+
+		std::uint32_t userData = 0;
+
+		bool IsLeaf() const { return child1 == NullNode; }
+	};
+
+	/**
+	 * \class NodeStack
+	 * \brief Stack of the nodes left to visit, on the call stack unless the tree is unexpectedly deep.
+	 */
+	class NodeStack
+	{
+	public:
+		void Push(std::int32_t _node);
+		std::int32_t Pop();
+		bool IsEmpty() const { return size == 0; }
+
+	private:
+		static constexpr std::size_t Capacity = 256;
+
+		std::int32_t stack[Capacity];
+		std::size_t size = 0;
+		std::vector<std::int32_t> overflow;
+	};
+
+	std::int32_t AllocateNode();
+	void FreeNode(std::int32_t _node);
+
+	/**
+	 * \brief Builds a subtree over leaves.
+	 * \param _leaves The leaves, reordered.
+	 * \param _count The number of leaves, at least one.
+	 * \param _parent The parent of the subtree.
+	 * \return The root of the subtree.
+	 */
+	std::int32_t BuildTopDown(std::int32_t* _leaves, std::size_t _count, std::int32_t _parent);
+
+	void InsertLeaf(std::int32_t _leaf);
+	void RemoveLeaf(std::int32_t _leaf);
+
+	/**
+	 * \brief Refits the ancestors of a node after its children changed, rotating the unbalanced ones.
+	 * \param _node The first ancestor to refit.
+	 */
+	void Refit(std::int32_t _node);
+
+	/**
+	 * \brief Rotates a child up if one side is more than one level deeper than the other.
+	 * \param _node The node to balance.
+	 * \return The node now at its place.
+	 */
+	std::int32_t Balance(std::int32_t _node);
+
+	bool ValidateNode(std::int32_t _node, std::int32_t _parent) const;
+
+	std::vector<Node> nodes;
+	std::int32_t root = NullNode;
+	std::int32_t freeList = NullNode;
+	std::size_t proxyCount = 0;
+
+	float margin = 4.0f;
+};
+
+#include "Physics/DynamicTree.inl"
@@ -0,0 +1,166 @@
+#pragma once
+
+#include <cmath>
+
+inline void DynamicTree::NodeStack::Push(const std::int32_t _node)
+{
+	if (size < Capacity)
+		stack[size] = _node;
+	else
+		overflow.push_back(_node);
+	++size;
+}
+
+inline std::int32_t DynamicTree::NodeStack::Pop()
+{
+	--size;
+	if (size < Capacity)
+		return stack[size];
+
+	const std::int32_t node = overflow.back();
+	overflow.pop_back();
+	return node;
+}
+
+template<typename Callback>
+void DynamicTree::Query(const Maths::Rectf& _bounds, Callback&& _callback) const
+{
+	NodeStack stack;
+	stack.Push(root);
+
+	while (!stack.IsEmpty())
+	{
+		const std::int32_t index = stack.Pop();
+		if (index == NullNode)
+			continue;
+
+		const Node& node = nodes[index];
+		if (!node.bounds.Overlaps(_bounds))
+			continue;
+
+		if (node.IsLeaf())
+		{
+			if (!_callback(index))
+				return;
+		}
+		else
+		{
+			stack.Push(node.child1);
+			stack.Push(node.child2);
+		}
+	}
+}
+
+template<typename Callback>
+void DynamicTree::QueryPoint(const Maths::Vector2f& _point, Callback&& _callback) const
+{
+	NodeStack stack;
+	stack.Push(root);
+
+	while (!stack.IsEmpty())
+	{
+		const std::int32_t index = stack.Pop();
+		if (index == NullNode)
+			continue;
+
+		const Node& node = nodes[index];
+		if (!node.bounds.Contains(_point))
+			continue;
+
+		if (node.IsLeaf())
+		{
+			if (!_callback(index))
+				return;
+		}
+		else
+		{
+			stack.Push(node.child1);
+			stack.Push(node.child2);
+		}
+	}
+}
+
+template<typename Callback>
+void DynamicTree::QueryCircle(const Maths::Vector2f& _center, const float _radius, Callback&& _callback) const
+{
+	const float radius_squared = _radius * _radius;
+
+	NodeStack stack;
+	stack.Push(root);
+
+	while (!stack.IsEmpty())
+	{
+		const std::int32_t index = stack.Pop();
+		if (index == NullNode)
+			continue;
+
+		const Node& node = nodes[index];
+		if (node.bounds.DistanceSquared(_center) > radius_squared)
+			continue;
+
+		if (node.IsLeaf())
+		{
+			if (!_callback(index))
+				return;
+		}
+		else
+		{
+			stack.Push(node.child1);
+			stack.Push(node.child2);
+		}
+	}
+}
+
+template<typename Callback>
+void DynamicTree::Raycast(const Maths::Vector2f& _from, const Maths::Vector2f& _to, Callback&& _callback) const
+{
+	const Maths::Vector2f delta = _to - _from;
+
+	// Normal of the segment, a box is missed if its projection on it does not reach the segment
+	const Maths::Vector2f normal(-delta.y, delta.x);
+	const Maths::Vector2f abs_normal(std::abs(normal.x), std::abs(normal.y));
+
+	float max_fraction = 1.0f;
+	Maths::Vector2f end = _to;
+	Maths::Rectf segment_bounds(Maths::Vector2f::Min(_from, end), Maths::Vector2f::Max(_from, end));
+
+	NodeStack stack;
+	stack.Push(root);
+
+	while (!stack.IsEmpty())
+	{
+		const std::int32_t index = stack.Pop();
+		if (index == NullNode)
+			continue;
+
+		// Edges included, the bounds of an horizontal or vertical segment are flat
+		const Node& node = nodes[index];
+		if (node.bounds.min.x > segment_bounds.max.x || node.bounds.max.x < segment_bounds.min.x
+			|| node.bounds.min.y > segment_bounds.max.y || node.bounds.max.y < segment_bounds.min.y)
+			continue;
+
+		const Maths::Vector2f center = node.bounds.GetCenter();
+		const Maths::Vector2f half_size = node.bounds.GetSize() * 0.5f;
+		if (std::abs(normal.Dot(_from - center)) > abs_normal.Dot(half_size))
+			continue;
+
+		if (node.IsLeaf())
+		{
+			const float fraction = _callback(index, max_fraction);
+			if (fraction <= 0.0f)
+				return;
+
+			if (fraction < max_fraction)
+			{
+				max_fraction = fraction;
+				end = _from + delta * max_fraction;
+				segment_bounds = Maths::Rectf(Maths::Vector2f::Min(_from, end), Maths::Vector2f::Max(_from, end));
+			}
+		}
+		else
+		{
+			stack.Push(node.child1);
+			stack.Push(node.child2);
+		}
+	}
+}
@@ -0,0 +1,268 @@
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+#include "Maths/Rect.h"
+#include "Physics/CollisionPair.h"
+
+class CollisionWorld;
+class Rigidbody2D;
+class SquareCollider;
+class WorkerPool;
+
+/// Index of a body in its PhysicsWorld, reused once the body is removed.
+using BodyId = std::uint32_t;
+
+constexpr BodyId InvalidBody = 0xFFFFFFFF;
+
+/**
+ * \class PhysicsWorld
+ * \brief Moves the rigidbodies of a scene with a fixed time step and pushes them out of the colliders.
+ *
+ * Contacts come from the pairs of the CollisionWorld, their normal is the axis of least
+ * overlap of the two boxes. Velocities are solved with sequential impulses, warm started
+ * from the impulses of the previous step. The depth is corrected by separate impulses
+ * that move the bodies without changing their velocity, so stacks do not pop. Bodies touching each other form islands, an
+ * island at rest for a while sleeps: its colliders are marked static in the collision
+ * world and the step skips it until an awake body touches it.
+ *
+ * Given a WorkerPool, contacts are made, sorted and warm started in batches of pairs,
+ * islands are solved, bodies are moved and swept and islands are tested for sleep on
+ * several threads. Tasks do not depend on the number of threads and contacts are sorted,
+ * the bodies end up at the same place with any number of threads. The broadphase, the
+ * union of the islands, waking and putting islands to sleep stay on the calling thread.
+ */
+class PhysicsWorld
+{
+public:
+	/**
+	 * \brief Constructor.
+	 * \param _collision_world The colliders of the same scene.
+	 */
+	explicit PhysicsWorld(CollisionWorld& _collision_world) : collisionWorld(_collision_world) {}
+
+	/**
+	 * \brief Adds a body, awake.
+	 * \param _rigidbody The rigidbody, attached to a game object of the scene.
+	 * \return The id of the body in the world.
+	 */
+	BodyId AddBody(Rigidbody2D* _rigidbody);
+
+	/**
+	 * \brief Removes a body, waking its island since what it held may fall.
+	 * \param _id The id returned by AddBody().
+	 */
+	void RemoveBody(BodyId _id);
+
+	/**
+	 * \brief Links the collider moved with a body, a body without collider only moves.
+	 * \param _id The id of the body.
+	 * \param _collider The collider of the same game object, nullptr once removed.
+	 */
+	void SetBodyCollider(BodyId _id, SquareCollider* _collider);
+
+	Maths::Vector2f GetVelocity(const BodyId _id) const { return bodies[_id].velocity; }
+	void SetVelocity(BodyId _id, const Maths::Vector2f& _velocity);
+	void ApplyForce(BodyId _id, const Maths::Vector2f& _force);
+
+	/**
+	 * \brief Wakes a body and the island it sleeps with.
+	 * \param _id The id of the body.
+	 */
+	void WakeUp(BodyId _id);
+	bool IsAwake(const BodyId _id) const { return bodies[_id].awakeIndex != InvalidIndex; }
+
+	/**
+	 * \brief Wakes the sleeping bodies around an area, after a collider there was moved or removed.
+	 * \param _bounds The area.
+	 */
+	void WakeUpArea(const Maths::Rectf& _bounds);
+
+	/**
+	 * \brief Moves the awake bodies by one time step.
+	 * \param _delta_time The fixed time step in seconds.
+	 * \param _workers Threads sharing the contacts and islands, nullptr to do everything on the caller.
+	 */
+	void Step(float _delta_time, WorkerPool* _workers = nullptr);
+
+	const Maths::Vector2f& GetGravity() const { return gravity; }
+	void SetGravity(const Maths::Vector2f& _gravity) { gravity = _gravity; }
+
+	int GetVelocityIterations() const { return velocityIterations; }
+	void SetVelocityIterations(const int _iterations) { velocityIterations = _iterations; }
+
+	std::size_t GetBodyCount() const { return bodies.size() - freeIds.size(); }
+	std::size_t GetAwakeBodyCount() const { return awakeBodies.size(); }
+	std::size_t GetContactCount() const { return contacts.size(); }
+	std::size_t GetIslandCount() const { return islands.size(); }
+
+private:
+	static constexpr std::uint32_t InvalidIndex = 0xFFFFFFFF;
+
+	/**
+	 * \struct Body
+	 * \brief The state of a rigidbody solved by the world.
+	 */
+	struct Body
+	{
+		Rigidbody2D* rigidbody = nullptr;
+		SquareCollider* collider = nullptr;
+		ColliderId colliderId = InvalidCollider;
+
+		Maths::Vector2f velocity;
+
+		/// Moves the body out of the others during a step, then dropped.
+		Maths::Vector2f biasVelocity;
+
+		Maths::Vector2f force;
+		float inverseMass = 0.0f;
+
+		/// Time spent slower than the sleep tolerance.
+		float sleepTime = 0.0f;
+
+		/// Index in awakeBodies, InvalidIndex while sleeping.
+		std::uint32_t awakeIndex = InvalidIndex;
+
+		/// Index in sleepingIslands while sleeping.
+		std::uint32_t sleepingIsland = InvalidIndex;
+
+		/// Root of the island of the body during a step.
+		std::uint32_t islandParent = InvalidIndex;
+
+		/// Index in islands while building them, for the root only.
+		std::uint32_t island = InvalidIndex;
+	};
+
+	/**
+	 * \struct Contact
+	 * \brief Two overlapping boxes, at least one of them a dynamic body.
+	 */
+	struct Contact
+	{
+		std::uint64_t key = 0;
+
+		/// InvalidBody for a collider without body.
+		BodyId bodyA = InvalidBody;
+		BodyId bodyB = InvalidBody;
+
+		/// From A to B.
+		Maths::Vector2f normal;
+		float depth = 0.0f;
+
+		float friction = 0.0f;
+		float restitution = 0.0f;
+		float normalMass = 0.0f;
+
+		/// Separating speed wanted along the normal after a bounce.
+		float velocityBias = 0.0f;
+
+		/// Separating speed of the bias velocities, to correct the depth.
+		float depthBias = 0.0f;
+
+		/// Accumulated over the iterations, and kept for the next step.
+		float normalImpulse = 0.0f;
+		float tangentImpulse = 0.0f;
+
+		/// Accumulated on the bias velocities, not kept.
+		float depthImpulse = 0.0f;
+	};
+
+	/**
+	 * \struct Island
+	 * \brief Bodies linked by contacts, solved together and put to sleep together.
+	 */
+	struct Island
+	{
+		std::uint32_t firstBody = 0;
+		std::uint32_t bodyCount = 0;
+		std::uint32_t firstContact = 0;
+		std::uint32_t contactCount = 0;
+
+		/// At rest for long enough, found in parallel and put to sleep after.
+		bool fallsAsleep = false;
+	};
+
+	BodyId GetColliderBody(const ColliderId _id) const { return _id < colliderBodies.size() ? colliderBodies[_id] : InvalidBody; }
+	void LinkCollider(BodyId _id, bool _linked);
+
+	void WakeUpIsland(std::uint32_t _island);
+
+	void WakeUpTouched();
+	void BuildContacts(float _delta_time, WorkerPool* _workers);
+
+	/**
+	 * \brief Makes the contact of a pair, the narrowphase, reading the bodies only.
+	 * \param _pair The pair.
+	 * \param _delta_time The time step.
+	 * \param _contact Replaced by the contact.
+	 * \return False if the pair makes no contact.
+	 */
+	bool MakeContact(const CollisionPair& _pair, float _delta_time, Contact& _contact) const;
+
+	/**
+	 * \brief Merges the sorted runs of contacts made by the narrowphase tasks, two by two in parallel.
+	 * \param _workers Threads sharing the merges, nullptr to merge on the caller.
+	 */
+	void MergeContactRuns(WorkerPool* _workers);
+
+	void BuildIslands(WorkerPool* _workers);
+	void SolveIsland(const Island& _island);
+	void IntegratePositions(float _delta_time, WorkerPool* _workers);
+
+	/**
+	 * \brief Stops a fast body at the first collider along its move, it would pass through thin ones otherwise.
+	 * \param _id The id of the body, continuous and with a collider.
+	 * \param _move The move of the step, shortened on a hit.
+	 * \param _results Colliders found along the move, one list per thread.
+	 */
+	void SweepBody(BodyId _id, Maths::Vector2f& _move, std::vector<SquareCollider*>& _results);
+
+	void UpdateSleep(float _delta_time, WorkerPool* _workers);
+
+	std::uint32_t FindIsland(BodyId _id);
+
+	static void RunTasks(WorkerPool* _workers, std::size_t _count, const std::function<void(std::size_t)>& _task);
+
+	CollisionWorld& collisionWorld;
+
+	std::vector<Body> bodies;
+	std::vector<BodyId> freeIds;
+	std::vector<BodyId> awakeBodies;
+
+	/// Body of each collider id, InvalidBody for static colliders.
+	std::vector<BodyId> colliderBodies;
+
+	std::vector<std::vector<BodyId>> sleepingIslands;
+	std::vector<std::uint32_t> freeSleepingIslands;
+
+	/// Sorted by key, the previous step's ones are kept to warm start the solver.
+	std::vector<Contact> contacts;
+	std::vector<Contact> previousContacts;
+
+	/// Contacts of a round of merges, swapped with contacts after it.
+	std::vector<Contact> mergedContacts;
+
+	/// Start of the sorted run of each narrowphase task in contacts, then the contact count.
+	std::vector<std::uint32_t> contactRuns;
+
+	/// Bodies and contacts of the islands of a step, grouped by island.
+	std::vector<Island> islands;
+	std::vector<BodyId> islandBodies;
+	std::vector<std::uint32_t> islandContacts;
+
+	/// Island of each contact, found in parallel once the islands are joined.
+	std::vector<std::uint32_t> contactIslands;
+
+	/// First island of each solver task, then the island count.
+	std::vector<std::uint32_t> islandTasks{0};
+
+	std::vector<SquareCollider*> sweepResults;
+
+	/// Query results of the continuous sweeps, one list per task.
+	std::vector<std::vector<SquareCollider*>> sweepTaskResults;
+
+	Maths::Vector2f gravity = Maths::Vector2f(0.0f, 980.0f);
+	int velocityIterations = 8;
+};
@@ -0,0 +1,173 @@
+#pragma once
+
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+#include "Maths/Rect.h"
+#include "Physics/CollisionFilter.h"
+#include "Physics/CollisionPair.h"
+
+/**
+ * \class SweepAndPrune
+ * \brief Broadphase keeping the bounds sorted along x and y, and the overlapping pairs between frames.
+ *
+ * Moving a box slides its endpoints to their new place by insertion sort, a pair is added
+ * or removed only when two endpoints swap. Objects move little between frames, so an
+ * update costs in proportion to the boxes that moved and not to the static ones.
+ * Added boxes are merged into the sorted endpoints and find their pairs among the boxes
+ * starting at most the width of the widest box before them. Many boxes added at once,
+ * like a scene load, sort the endpoints again instead.
+ * Pairs whose filters do not accept each other are never added, whatever their bounds.
+ */
+class SweepAndPrune
+{
+public:
+	/**
+	 * \brief Adds a box, inserted by the next Update().
+	 * \param _id The id of the box, not already added.
+	 * \param _bounds The bounds of the box.
+	 * \param _filter The filter of the box, changed with SetFilter().
+	 */
+	void Add(ColliderId _id, const Maths::Rectf& _bounds, const CollisionFilter& _filter);
+
+	/**
+	 * \brief Changes the filter of a box, its pairs are found again by the next Update().
+	 * The box is removed and inserted again, the other boxes keep their pairs.
+	 * \param _id The id of the box.
+	 * \param _filter The new filter of the box.
+	 */
+	void SetFilter(ColliderId _id, const CollisionFilter& _filter);
+
+	/**
+	 * \brief Removes a box, its pairs are removed by the next Update().
+	 * \param _id The id of the box.
+	 */
+	void Remove(ColliderId _id);
+
+	/**
+	 * \brief Moves a box, its pairs are updated at once.
+	 * \param _id The id of the box.
+	 * \param _bounds The new bounds of the box.
+	 */
+	void Move(ColliderId _id, const Maths::Rectf& _bounds);
+
+	/**
+	 * \brief Applies the boxes added and removed since the last update.
+	 */
+	void Update();
+
+	void Clear();
+
+	/**
+	 * \brief Gets the overlapping boxes, after Update().
+	 * \return The pairs, in no particular order.
+	 */
+	const std::vector<CollisionPair>& GetPairs() const { return pairs; }
+
+	/**
+	 * \brief Gets the endpoint swaps of the last frames, the work done by the insertion sorts.
+	 * \return The number of swaps since the last call to ResetSwapCount().
+	 */
+	std::uint64_t GetSwapCount() const { return swapCount; }
+	void ResetSwapCount() { swapCount = 0; }
+
+private:
+	/**
+	 * \struct Endpoint
+	 * \brief A side of a box along an axis.
+	 */
+	struct Endpoint
+	{
+		float value = 0.0f;
+
+		/// Id of the box shifted left once, the lowest bit is set for the max side.
+		std::uint32_t data = 0;
+
+		ColliderId GetId() const { return data >> 1; }
+		bool IsMax() const { return (data & 1) != 0; }
+	};
+
+	/**
+	 * \struct Box
+	 * \brief A box and the position of its endpoints.
+	 */
+	struct Box
+	{
+		Maths::Rectf bounds;
+		CollisionFilter filter;
+
+		/// Index of the min and max endpoints in the list of each axis.
+		std::uint32_t min[2] = {};
+		std::uint32_t max[2] = {};
+
+		enum class State : std::uint8_t
+		{
+			Free,
+			Adding,
+			Inserted,
+			Removing
+		};
+
+		State state = State::Free;
+
+		/// Inserted again once removed, after its filter changed.
+		bool reinsert = false;
+	};
+
+	/**
+	 * \brief Endpoints of equal values are ordered max first, so boxes sharing an edge do not overlap like Rectf::Overlaps.
+	 */
+	static bool IsBefore(const Endpoint& _lhs, const Endpoint& _rhs)
+	{
+		return _lhs.value < _rhs.value || (_lhs.value == _rhs.value && _lhs.IsMax() && !_rhs.IsMax());
+	}
+
+	void SortDown(int _axis, std::uint32_t _index);
+	void SortUp(int _axis, std::uint32_t _index);
+
+	/**
+	 * \brief Updates the pair of two boxes after two of their endpoints swapped.
+	 */
+	void OnSwap(ColliderId _moving, ColliderId _other);
+
+	void SetEndpointIndex(int _axis, const Endpoint& _endpoint, std::uint32_t _index);
+
+	void AddPair(ColliderId _first, ColliderId _second);
+	void RemovePair(ColliderId _first, ColliderId _second);
+
+	/**
+	 * \brief Merges the endpoints of the added boxes into the sorted ones and finds their pairs.
+	 */
+	void InsertAdded();
+
+	/**
+	 * \brief Sorts every endpoint and finds every pair again, faster than inserting many boxes.
+	 */
+	void Rebuild();
+
+	/**
+	 * \brief Drops the endpoints and pairs of the removed boxes, the refiltered ones are added again.
+	 */
+	void PurgeRemoved();
+
+	std::vector<Box> boxes;
+	std::vector<Endpoint> endpoints[2];
+
+	std::vector<ColliderId> adding;
+	std::vector<ColliderId> removing;
+
+	/// Endpoints of the added boxes and the lists merged with them, kept to not allocate every insertion.
+	std::vector<Endpoint> insertedEndpoints;
+	std::vector<Endpoint> mergedEndpoints;
+
+	/// Width along x of the widest box inserted since the last rebuild, the reach of the pair search of an added box.
+	float maxWidth = 0.0f;
+
+	std::vector<CollisionPair> pairs;
+
+	/// Index of every pair in pairs, by CollisionPair::GetKey().
+	std::unordered_map<std::uint64_t, std::uint32_t> pairIndices;
+
+	std::uint64_t swapCount = 0;
+};
@@ -1,16 +1,31 @@
 #pragma once
 
+#include <atomic>
 #include <filesystem>
 
+class AssetPack;
+class ResourcesModule;
+
 /**
  * \class AResource
  * \brief Base class for managing resources with reference counting.
  * 
  * This class provides basic functionality for resource management,
- * including reference counting and path handling.
+ * including intrusive reference counting and path handling.
+ * Resources loaded through the ResourcesModule are owned by its cache:
+ * when their reference count drops to zero they stay resident until
+ * evicted to respect the cache memory budget.
+ *
+ * Reference counts are atomic, so resources can be shared with other threads
+ * through ResourceHandle. Releasing the last reference only queues the resource,
+ * the cache processes the queue and frees GPU data on the main thread.
+ * A weak count keeps the object itself alive for WeakResourceHandle after eviction.
+ * Resources still referenced when the cache is finalized are unloaded by their last release.
  */
 class AResource
 {
+	friend class ResourcesModule;
+
 public:
 	/**
 	 * \brief Default constructor.
@@ -18,30 +33,14 @@ public:
 	AResource();
 
 	/**
-	 * \brief Copy constructor.
-	 * \param _other The other AResource object to copy from.
-	 */
-	AResource(const AResource& _other);
-
-	/**
-	 * \brief Move constructor.
-	 * \param _other The other AResource object to move from.
-	 */
-	AResource(AResource&& _other) noexcept;
-
-	/**
-	 * \brief Copy assignment operator.
-	 * \param _other The other AResource object to copy from.
-	 * \return Reference to this AResource object.
+	 * \brief Resources are shared through their reference count, never copied.
 	 */
-	AResource& operator=(const AResource& _other);
+	AResource(const AResource& _other) = delete;
 
 	/**
-	 * \brief Move assignment operator.
-	 * \param _other The other AResource object to move from.
-	 * \return Reference to this AResource object.
+	 * \brief Resources are shared through their reference count, never copied.
 	 */
-	AResource& operator=(AResource&& _other) noexcept;
+	AResource& operator=(const AResource& _other) = delete;
 
 	/// Type alias for filesystem path.
 	using Path = std::filesystem::path;
@@ -59,6 +58,25 @@ public:
 	 */
 	static bool Exists(const std::string& _name);
 
+	/**
+	 * \brief Gets the path from the resource name.
+	 * \param _name The name of the resource.
+	 * \return The path to the resource.
+	 */
+	static Path GetPathFromName(const std::string& _name);
+
+	/**
+	 * \brief Sets the asset pack looked up before the assets folder.
+	 * \param _asset_pack The mounted asset pack, or nullptr to only use loose files.
+	 */
+	static void SetAssetPack(const AssetPack* _asset_pack);
+
+	/**
+	 * \brief Gets the asset pack looked up before the assets folder.
+	 * \return The mounted asset pack, or nullptr if none.
+	 */
+	static const AssetPack* GetAssetPack();
+
 	/**
 	 * \brief Destructor.
 	 */
@@ -71,38 +89,98 @@ public:
 	 */
 	virtual bool Load(const std::string& _path);
 
+	/**
+	 * \brief Loads the resource from a buffer holding the content of its file.
+	 * \param _data Pointer to the file content.
+	 * \param _size Size of the file content.
+	 * \return True if the resource was loaded successfully, false otherwise.
+	 */
+	virtual bool LoadFromMemory(const void* _data, std::size_t _size);
+
 	/**
 	 * \brief Unloads the resource.
 	 */
 	virtual void Unload();
 
+	/**
+	 * \brief Decodes a new version of the resource file, called from a background thread.
+	 *
+	 * The decoded data must be kept aside, the resource may be in use by the main thread.
+	 * \param _path The path to the modified file.
+	 * \return True if the resource supports hot-reload and the file was decoded.
+	 */
+	virtual bool DecodeReload(const std::string& _path);
+
+	/**
+	 * \brief Swaps the data decoded by DecodeReload() in, called on the main thread at a frame boundary.
+	 */
+	virtual void ApplyReload();
+
+	/**
+	 * \brief Gets the memory used by the decoded resource, accounted in the cache budget.
+	 * \return The size in bytes.
+	 */
+	virtual std::size_t GetMemorySize() const;
+
+	/**
+	 * \brief Gets the name the resource was loaded with.
+	 * \return The name of the resource, empty if not loaded through the ResourcesModule.
+	 */
+	const std::string& GetName() const { return name; }
+
 	/**
 	 * \brief Gets the reference counter.
 	 * \return The reference count.
 	 */
 	unsigned int GetRefCount() const;
 
-private:
-	/// Path to the resource.
-	Path path;
+	/**
+	 * \brief Increases the reference counter.
+	 *
+	 * Reviving a resource with no reference left is only allowed on the main thread,
+	 * other threads must copy an existing ResourceHandle or use TryAddRef().
+	 */
+	void AddRef() noexcept;
 
 	/**
-	 * \brief Gets the path from the resource name.
-	 * \param _name The name of the resource.
-	 * \return The path to the resource.
+	 * \brief Increases the reference counter only if the resource is still referenced.
+	 * \return True if a reference was added.
 	 */
-	static Path GetPathFromName(const std::string& _name);
+	bool TryAddRef() noexcept;
 
 	/**
-	 * \brief Increases the reference counter.
+	 * \brief Decreases the reference counter, an unreferenced cached resource becomes evictable.
+	 *
+	 * Once the cache is finalized, the last release unloads the resource on the calling thread.
 	 */
-	void IncreaseRefCount() noexcept;
+	void Release() noexcept;
 
 	/**
-	 * \brief Decreases the reference counter.
+	 * \brief Increases the weak counter, keeping the object alive but not its data.
 	 */
-	void DecreaseRefCount() noexcept;
+	void AddWeakRef() noexcept;
+
+	/**
+	 * \brief Decreases the weak counter, deletes the resource when it reaches zero.
+	 */
+	void ReleaseWeakRef() noexcept;
+
+private:
+	/// Path to the resource.
+	Path path;
+
+	/// Name of the resource, key of the cache.
+	std::string name;
+
+	/// Asset pack looked up before the assets folder.
+	static const AssetPack* assetPack;
+
+	/// Cache owning the resource, notified when the resource is no longer referenced. Cleared when the cache is finalized.
+	std::atomic<ResourcesModule*> cache = nullptr;
+
+	/// Intrusive reference counter.
+	std::atomic<unsigned int> refCount = 0;
 
-	/// Pointer to the reference counter.
-	unsigned int* refCount = nullptr;
+	/// Weak references, plus one held by the cache until eviction.
+	std::atomic<unsigned int> weakCount = 1;
 };
@@ -1,15 +1,27 @@
 #pragma once
 
+#include <string>
+#include <unordered_map>
+
 #include "Texture.h"
+#include "Animation/AnimationClip.h"
 
+/**
+ * \class AnimatedTileSet
+ * \brief A texture of animation frames laid out in tiles, cut into clips played by AnimatorComponent.
+ */
 class AnimatedTileSet : public Texture
 {
 public:
 	explicit AnimatedTileSet(const std::string& _path) : Texture(_path) {}
 
-	void SetSpeed(float& _speed) const
+	/**
+	 * \brief Sets the duration of a frame of the clips added afterwards.
+	 * \param _speed Seconds per frame.
+	 */
+	void SetSpeed(const float _speed)
 	{
-		_speed = speed;
+		speed = _speed;
 	}
 
 	float GetSpeed() const
@@ -17,6 +29,21 @@ public:
 		return speed;
 	}
 
+	/**
+	 * \brief Adds the sprites of a grid of tiles as Texture::AddSprites, and a clip playing them row by row.
+	 * \param _name The name of the clip, and the base name of its sprites.
+	 * \param _rect The rectangle of the first tile.
+	 * \param _size The number of tiles on each axis.
+	 * \param _offset The distance between two tiles, and their size.
+	 * \param _loop Whether the clip starts over after its last frame.
+	 * \return The clip, owned by the tile set.
+	 */
+	const AnimationClip* AddClip(const std::string& _name, const sf::IntRect& _rect, const sf::Vector2i& _size, const sf::Vector2i& _offset, bool _loop = true);
+
+	const AnimationClip* GetClip(const std::string& _name) const;
+
 private:
 	float speed = 0.5f;
+
+	std::unordered_map<std::string, AnimationClip> clips;
 };
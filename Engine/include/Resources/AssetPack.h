@@ -0,0 +1,172 @@
+#pragma once
+
+#include <cstdint>
+#include <filesystem>
+#include <string>
+#include <vector>
+
+/**
+ * \class AssetPack
+ * \brief A read-only archive of assets, memory-mapped and read without copies.
+ *
+ * Layout of a pack file:
+ * - a Header,
+ * - the asset blobs, each one aligned on Alignment bytes,
+ * - the table of contents: one TocEntry per asset, sorted by name hash,
+ * - the names table: every asset name, relative to the assets folder with '/' separators.
+ *
+ * Blobs may be compressed with LZ4, in which case they are decompressed into
+ * a caller owned buffer, otherwise they are returned as a view on the mapping.
+ */
+class AssetPack
+{
+public:
+	/// "SDEP" read as a little-endian integer.
+	static constexpr std::uint32_t Magic = 0x50454453;
+
+	/// Version of the format, bumped on any layout change.
+	static constexpr std::uint32_t Version = 1;
+
+	/// Alignment of every blob inside the file.
+	static constexpr std::uint64_t Alignment = 16;
+
+	/**
+	 * \enum EEntryFlags
+	 * \brief Flags of a table of contents entry.
+	 */
+	enum EEntryFlags : std::uint32_t
+	{
+		None = 0,
+		Compressed = 1 << 0
+	};
+
+	/**
+	 * \struct Header
+	 * \brief Header at the beginning of a pack file.
+	 */
+	struct Header
+	{
+		std::uint32_t magic = Magic;
+		std::uint32_t version = Version;
+		std::uint32_t entryCount = 0;
+		std::uint32_t reserved = 0;
+		std::uint64_t tocOffset = 0;
+		std::uint64_t namesOffset = 0;
+	};
+
+	/**
+	 * \struct TocEntry
+	 * \brief Description of one asset inside the pack.
+	 */
+	struct TocEntry
+	{
+		std::uint64_t nameHash = 0;
+		std::uint32_t nameOffset = 0;
+		std::uint32_t nameLength = 0;
+		std::uint64_t dataOffset = 0;
+		std::uint64_t size = 0;
+		std::uint64_t uncompressedSize = 0;
+		std::uint32_t flags = None;
+		std::uint32_t reserved = 0;
+	};
+
+	/**
+	 * \brief Default constructor.
+	 */
+	AssetPack() = default;
+
+	/**
+	 * \brief Destructor, unmaps the file.
+	 */
+	~AssetPack();
+
+	AssetPack(const AssetPack&) = delete;
+	AssetPack& operator=(const AssetPack&) = delete;
+
+	/**
+	 * \brief Maps a pack file and validates its header.
+	 * \param _path The path to the pack file.
+	 * \return True if the pack was opened, false otherwise.
+	 */
+	bool Open(const std::filesystem::path& _path);
+
+	/**
+	 * \brief Unmaps the pack file.
+	 */
+	void Close();
+
+	/**
+	 * \brief Checks if a pack file is mapped.
+	 * \return True if the pack is open.
+	 */
+	bool IsOpen() const { return mappedData != nullptr; }
+
+	/**
+	 * \brief Checks if the pack contains an asset.
+	 * \param _name The name of the asset, relative to the assets folder.
+	 * \return True if the asset is in the pack.
+	 */
+	bool Contains(const std::string& _name) const;
+
+	/**
+	 * \brief Gets the content of an asset.
+	 * \param _name The name of the asset, relative to the assets folder.
+	 * \param _data Output pointer to the content, valid while the pack is open or the buffer alive.
+	 * \param _size Output size of the content.
+	 * \param _buffer Buffer receiving the content of compressed assets.
+	 * \return True if the asset was found and is valid.
+	 */
+	bool GetData(const std::string& _name, const void*& _data, std::size_t& _size, std::vector<std::uint8_t>& _buffer) const;
+
+	/**
+	 * \brief Gets the number of assets in the pack.
+	 * \return The asset count.
+	 */
+	std::uint32_t GetEntryCount() const;
+
+	/**
+	 * \brief Hashes an asset name, FNV-1a on the name with '/' separators.
+	 * \param _name The name to hash.
+	 * \return The hash of the name.
+	 */
+	static std::uint64_t HashName(const std::string& _name);
+
+	/**
+	 * \brief Writes a pack containing every file of a folder.
+	 * \param _folder The folder to pack, names are stored relative to it.
+	 * \param _output The path of the pack file to write.
+	 * \param _compress Whether assets are LZ4 compressed when it makes them smaller.
+	 * \return True if the pack was written, false otherwise.
+	 */
+	static bool Build(const std::filesystem::path& _folder, const std::filesystem::path& _output, bool _compress);
+
+private:
+	/**
+	 * \brief Finds the entry of an asset.
+	 * \param _name The name of the asset.
+	 * \return Pointer to the entry, or nullptr if not found.
+	 */
+	const TocEntry* FindEntry(const std::string& _name) const;
+
+	/**
+	 * \brief Maps a file in memory.
+	 * \param _path The path to the file.
+	 * \return True if the file was mapped.
+	 */
+	bool Map(const std::filesystem::path& _path);
+
+	/// Mapped content of the pack file.
+	const std::uint8_t* mappedData = nullptr;
+
+	/// Size of the mapped content.
+	std::size_t mappedSize = 0;
+
+#ifdef _WIN32
+	void* fileHandle = nullptr;
+	void* mappingHandle = nullptr;
+#endif
+
+	const Header* header = nullptr;
+	const TocEntry* toc = nullptr;
+	const char* names = nullptr;
+};
@@ -0,0 +1,96 @@
+#pragma once
+
+#include <atomic>
+#include <filesystem>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * \class FileWatcher
+ * \brief Watches a folder and its subfolders for modified files from a background thread.
+ *
+ * On Linux the folder is watched with inotify, files are reported once closed after writing
+ * or moved into the folder, which covers editors saving through a temporary file.
+ * Elsewhere the folder is scanned periodically and files are reported when their write time changes.
+ */
+class FileWatcher
+{
+public:
+	/**
+	 * \brief Default constructor.
+	 */
+	FileWatcher() = default;
+
+	/**
+	 * \brief Destructor, stops the watching thread.
+	 */
+	~FileWatcher();
+
+	FileWatcher(const FileWatcher&) = delete;
+	FileWatcher& operator=(const FileWatcher&) = delete;
+
+	/**
+	 * \brief Starts watching a folder.
+	 * \param _folder The folder to watch, recursively.
+	 * \return True if the folder is watched, false otherwise.
+	 */
+	bool Start(const std::filesystem::path& _folder);
+
+	/**
+	 * \brief Stops watching and joins the watching thread.
+	 */
+	void Stop();
+
+	bool IsRunning() const { return thread.joinable(); }
+
+	/**
+	 * \brief Gets the files modified since the last call, without duplicates.
+	 * \param _names Output names of the files, relative to the watched folder with '/' separators.
+	 */
+	void PollChanges(std::vector<std::string>& _names);
+
+private:
+	/**
+	 * \brief Body of the watching thread.
+	 */
+	void Run();
+
+	/**
+	 * \brief Reports a modified file.
+	 * \param _name The name of the file, relative to the watched folder.
+	 */
+	void Push(const std::string& _name);
+
+#ifdef __linux__
+	/**
+	 * \brief Watches a folder and all its subfolders.
+	 * \param _path The folder to watch.
+	 */
+	void AddWatches(const std::filesystem::path& _path);
+
+	int inotifyDescriptor = -1;
+
+	/// Watched folders by watch descriptor, relative to the watched folder.
+	std::unordered_map<int, std::string> watchedFolders;
+#else
+	/**
+	 * \brief Scans the folder, reporting files whose write time changed.
+	 * \param _report Whether changes are reported, false to record the initial write times.
+	 */
+	void Scan(bool _report);
+
+	/// Last known write time of every file.
+	std::unordered_map<std::string, std::filesystem::file_time_type> writeTimes;
+#endif
+
+	std::filesystem::path folder;
+
+	std::thread thread;
+	std::atomic<bool> running = false;
+
+	std::mutex changesMutex;
+	std::vector<std::string> changes;
+};
@@ -0,0 +1,42 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * \namespace Lz4
+ * \brief Minimal codec for the LZ4 block format, used by asset packs.
+ *
+ * The output is a raw LZ4 block (no frame header), readable by any LZ4
+ * block decoder. The compressor is a greedy single-probe matcher, tuned
+ * for the offline packer rather than for speed.
+ */
+namespace Lz4
+{
+	/**
+	 * \brief Gets the worst case compressed size of a buffer.
+	 * \param _size The size of the uncompressed buffer.
+	 * \return The maximum size of the compressed block.
+	 */
+	std::size_t CompressBound(std::size_t _size);
+
+	/**
+	 * \brief Compresses a buffer into an LZ4 block.
+	 * \param _source The uncompressed data.
+	 * \param _source_size The size of the uncompressed data.
+	 * \param _destination The output buffer.
+	 * \param _destination_capacity The size of the output buffer, at least CompressBound(_source_size).
+	 * \return The size of the compressed block, or 0 if the output buffer is too small.
+	 */
+	std::size_t Compress(const std::uint8_t* _source, std::size_t _source_size, std::uint8_t* _destination, std::size_t _destination_capacity);
+
+	/**
+	 * \brief Decompresses an LZ4 block.
+	 * \param _source The compressed block.
+	 * \param _source_size The size of the compressed block.
+	 * \param _destination The output buffer.
+	 * \param _destination_size The exact size of the uncompressed data.
+	 * \return True if the block was valid and filled exactly the output buffer.
+	 */
+	bool Decompress(const std::uint8_t* _source, std::size_t _source_size, std::uint8_t* _destination, std::size_t _destination_size);
+}
@@ -4,11 +4,10 @@
 
 /**
  * \class ResourceBase
- * \brief A template class for managing resources with reference counting.
+ * \brief A template class for resources wrapping their loaded data.
  * 
- * This class provides automatic memory management for resources by using
- * reference counting. It ensures that the resource is properly deleted
- * when no longer in use.
+ * The reference count lives in the AResource itself, so a resource is
+ * shared by pointer and never copied.
  * 
  * \tparam ResourceType The type of the resource.
  */
@@ -28,37 +27,11 @@ public:
 	 */
 	explicit ResourceBase(ResourceType* _data);
 
-	/**
-	 * \brief Copy constructor.
-	 * \param _other The other Resource object to copy from.
-	 */
-	ResourceBase(const ResourceBase& _other);
-
-	/**
-	 * \brief Move constructor.
-	 * \param _other The other Resource object to move from.
-	 */
-	ResourceBase(ResourceBase&& _other) noexcept;
-
 	/**
 	 * \brief Destructor.
 	 */
 	~ResourceBase() override;
 
-	/**
-	 * \brief Copy assignment operator.
-	 * \param _other The other Resource object to copy from.
-	 * \return Reference to this Resource object.
-	 */
-	ResourceBase& operator=(const ResourceBase& _other);
-
-	/**
-	 * \brief Move assignment operator.
-	 * \param _other The other Resource object to move from.
-	 * \return Reference to this Resource object.
-	 */
-	ResourceBase& operator=(ResourceBase&& _other) noexcept;
-
 	/**
 	 * \brief Gets the data.
 	 * \return Pointer to the resource data.
@@ -0,0 +1,158 @@
+#pragma once
+
+#include "Resources/AResource.h"
+
+/**
+ * \class ResourceHandle
+ * \brief A strong reference to a resource, safe to copy and release from any thread.
+ *
+ * The handle adds a reference on copy and releases it on destruction.
+ * Releasing the last reference never frees anything on the calling thread:
+ * the resource is queued and the ResourcesModule frees it on the main thread.
+ *
+ * \tparam T The type of the resource.
+ */
+template<typename T>
+class ResourceHandle
+{
+public:
+	/**
+	 * \brief Default constructor, an empty handle.
+	 */
+	ResourceHandle() = default;
+
+	/**
+	 * \brief Constructor adding a reference to a resource.
+	 * \param _resource The resource to reference.
+	 */
+	explicit ResourceHandle(T* _resource);
+
+	/**
+	 * \brief Copy constructor, adds a reference.
+	 * \param _other The handle to copy.
+	 */
+	ResourceHandle(const ResourceHandle& _other);
+
+	/**
+	 * \brief Move constructor, takes over the reference.
+	 * \param _other The handle to move from.
+	 */
+	ResourceHandle(ResourceHandle&& _other) noexcept;
+
+	/**
+	 * \brief Destructor, releases the reference.
+	 */
+	~ResourceHandle();
+
+	/**
+	 * \brief Copy assignment operator.
+	 * \param _other The handle to copy.
+	 * \return Reference to this handle.
+	 */
+	ResourceHandle& operator=(const ResourceHandle& _other);
+
+	/**
+	 * \brief Move assignment operator.
+	 * \param _other The handle to move from.
+	 * \return Reference to this handle.
+	 */
+	ResourceHandle& operator=(ResourceHandle&& _other) noexcept;
+
+	/**
+	 * \brief Creates a handle taking over a reference already added, as returned by ResourcesModule::LoadResource().
+	 * \param _resource The resource to adopt.
+	 * \return The handle.
+	 */
+	static ResourceHandle Adopt(T* _resource);
+
+	/**
+	 * \brief Releases the reference, the handle becomes empty.
+	 */
+	void Reset();
+
+	T* Get() const { return resource; }
+	T* operator->() const { return resource; }
+	T& operator*() const { return *resource; }
+	explicit operator bool() const { return resource != nullptr; }
+
+private:
+	T* resource = nullptr;
+};
+
+/**
+ * \class WeakResourceHandle
+ * \brief A weak reference to a resource, expiring when its last strong reference is released.
+ *
+ * The weak handle keeps the resource object alive, never its data, so it can
+ * be checked safely from any thread even after the cache evicted the resource.
+ *
+ * \tparam T The type of the resource.
+ */
+template<typename T>
+class WeakResourceHandle
+{
+public:
+	/**
+	 * \brief Default constructor, an empty weak handle.
+	 */
+	WeakResourceHandle() = default;
+
+	/**
+	 * \brief Constructor from a strong handle.
+	 * \param _handle The handle to observe.
+	 */
+	WeakResourceHandle(const ResourceHandle<T>& _handle);
+
+	/**
+	 * \brief Copy constructor.
+	 * \param _other The weak handle to copy.
+	 */
+	WeakResourceHandle(const WeakResourceHandle& _other);
+
+	/**
+	 * \brief Move constructor.
+	 * \param _other The weak handle to move from.
+	 */
+	WeakResourceHandle(WeakResourceHandle&& _other) noexcept;
+
+	/**
+	 * \brief Destructor.
+	 */
+	~WeakResourceHandle();
+
+	/**
+	 * \brief Copy assignment operator.
+	 * \param _other The weak handle to copy.
+	 * \return Reference to this weak handle.
+	 */
+	WeakResourceHandle& operator=(const WeakResourceHandle& _other);
+
+	/**
+	 * \brief Move assignment operator.
+	 * \param _other The weak handle to move from.
+	 * \return Reference to this weak handle.
+	 */
+	WeakResourceHandle& operator=(WeakResourceHandle&& _other) noexcept;
+
+	/**
+	 * \brief Gets a strong handle if the resource is still referenced.
+	 * \return The strong handle, empty if the resource expired.
+	 */
+	ResourceHandle<T> Lock() const;
+
+	/**
+	 * \brief Checks if the resource has no strong reference left.
+	 * \return True if the resource expired.
+	 */
+	bool Expired() const;
+
+	/**
+	 * \brief Drops the weak reference, the handle becomes empty.
+	 */
+	void Reset();
+
+private:
+	T* resource = nullptr;
+};
+
+#include "ResourceHandle.inl"
@@ -0,0 +1,140 @@
+#pragma once
+
+#include <utility>
+
+template<typename T>
+ResourceHandle<T>::ResourceHandle(T* _resource) : resource(_resource)
+{
+    if (resource)
+        resource->AddRef();
+}
+
+template<typename T>
+ResourceHandle<T>::ResourceHandle(const ResourceHandle& _other) : resource(_other.resource)
+{
+    if (resource)
+        resource->AddRef();
+}
+
+template<typename T>
+ResourceHandle<T>::ResourceHandle(ResourceHandle&& _other) noexcept : resource(_other.resource)
+{
+    _other.resource = nullptr;
+}
+
+template<typename T>
+ResourceHandle<T>::~ResourceHandle()
+{
+    Reset();
+}
+
+template<typename T>
+ResourceHandle<T>& ResourceHandle<T>::operator=(const ResourceHandle& _other)
+{
+    if (this != &_other)
+    {
+        if (_other.resource)
+            _other.resource->AddRef();
+        Reset();
+        resource = _other.resource;
+    }
+    return *this;
+}
+
+template<typename T>
+ResourceHandle<T>& ResourceHandle<T>::operator=(ResourceHandle&& _other) noexcept
+{
+    if (this != &_other)
+    {
+        Reset();
+        resource = std::exchange(_other.resource, nullptr);
+    }
+    return *this;
+}
+
+template<typename T>
+ResourceHandle<T> ResourceHandle<T>::Adopt(T* _resource)
+{
+    ResourceHandle handle;
+    handle.resource = _resource;
+    return handle;
+}
+
+template<typename T>
+void ResourceHandle<T>::Reset()
+{
+    if (resource)
+        std::exchange(resource, nullptr)->Release();
+}
+
+template<typename T>
+WeakResourceHandle<T>::WeakResourceHandle(const ResourceHandle<T>& _handle) : resource(_handle.Get())
+{
+    if (resource)
+        resource->AddWeakRef();
+}
+
+template<typename T>
+WeakResourceHandle<T>::WeakResourceHandle(const WeakResourceHandle& _other) : resource(_other.resource)
+{
+    if (resource)
+        resource->AddWeakRef();
+}
+
+template<typename T>
+WeakResourceHandle<T>::WeakResourceHandle(WeakResourceHandle&& _other) noexcept : resource(_other.resource)
+{
+    _other.resource = nullptr;
+}
+
+template<typename T>
+WeakResourceHandle<T>::~WeakResourceHandle()
+{
+    Reset();
+}
+
+template<typename T>
+WeakResourceHandle<T>& WeakResourceHandle<T>::operator=(const WeakResourceHandle& _other)
+{
+    if (this != &_other)
+    {
+        if (_other.resource)
+            _other.resource->AddWeakRef();
+        Reset();
+        resource = _other.resource;
+    }
+    return *this;
+}
+
+template<typename T>
+WeakResourceHandle<T>& WeakResourceHandle<T>::operator=(WeakResourceHandle&& _other) noexcept
+{
+    if (this != &_other)
+    {
+        Reset();
+        resource = std::exchange(_other.resource, nullptr);
+    }
+    return *this;
+}
+
+template<typename T>
+ResourceHandle<T> WeakResourceHandle<T>::Lock() const
+{
+    if (resource && resource->TryAddRef())
+        return ResourceHandle<T>::Adopt(resource);
+
+    return ResourceHandle<T>();
+}
+
+template<typename T>
+bool WeakResourceHandle<T>::Expired() const
+{
+    return resource == nullptr || resource->GetRefCount() == 0;
+}
+
+template<typename T>
+void WeakResourceHandle<T>::Reset()
+{
+    if (resource)
+        std::exchange(resource, nullptr)->ReleaseWeakRef();
+}
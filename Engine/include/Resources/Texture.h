@@ -3,22 +3,71 @@
 #include <string>
 #include <unordered_map>
 
+#include <SFML/Graphics/Image.hpp>
 #include <SFML/Graphics/Sprite.hpp>
 #include <SFML/Graphics/Texture.hpp>
 
 #include "ResourceBase.h"
 
+class TextureAtlas;
+
 class Texture : public ResourceBase<sf::Texture>
 {
 public:
+	Texture();
+
 	explicit Texture(const std::string& _path);
 
 	~Texture() override;
 
+	bool Load(const std::string& _path) override;
+
+	bool LoadFromMemory(const void* _data, std::size_t _size) override;
+
+	void Unload() override;
+
+	bool DecodeReload(const std::string& _path) override;
+
+	/**
+	 * \brief Uploads the reloaded image into the same sf::Texture, so sprites and handles keep working.
+	 */
+	void ApplyReload() override;
+
+	std::size_t GetMemorySize() const override;
+
 	Texture* AddSprite(const std::string& _name, const sf::IntRect& _rect);
 
 	Texture* AddSprites(const std::string& _base_name, const sf::IntRect& _rect, const sf::Vector2i& _size, const sf::Vector2i& _offset);
 
+	sf::Sprite* GetSprite(const std::string& _name);
+
+	/**
+	 * \brief Redirects every sprite to an atlas page, rects are offset into atlas coordinates.
+	 * \param _atlas The atlas owning the page.
+	 * \param _page The page containing this texture.
+	 * \param _offset The position of this texture inside the page.
+	 */
+	void MapToAtlas(TextureAtlas* _atlas, const sf::Texture* _page, const sf::Vector2i& _offset);
+
+	/**
+	 * \brief Redirects every sprite back to this texture.
+	 */
+	void UnmapFromAtlas();
+
+	TextureAtlas* GetAtlas() const { return atlas; }
+
 private:
+	void RemapSprite(sf::Sprite& _sprite, const sf::IntRect& _rect) const;
+
 	std::unordered_map<std::string, sf::Sprite> sprites;
+
+	/// Sprite rects in this texture coordinates, kept to remap sprites when the atlas is rebuilt.
+	std::unordered_map<std::string, sf::IntRect> spriteRects;
+
+	/// Image decoded by a hot-reload, waiting to be uploaded on the main thread.
+	sf::Image reloadedImage;
+
+	TextureAtlas* atlas = nullptr;
+	const sf::Texture* atlasPage = nullptr;
+	sf::Vector2i atlasOffset;
 };
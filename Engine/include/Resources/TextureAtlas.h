@@ -0,0 +1,212 @@
+#pragma once
+
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <SFML/Graphics/Image.hpp>
+#include <SFML/Graphics/Rect.hpp>
+#include <SFML/Graphics/Texture.hpp>
+
+#include "Resources/AResource.h"
+
+class Texture;
+
+/**
+ * \class TextureAtlas
+ * \brief A resource packing many images into a few large atlas pages.
+ *
+ * Images are packed with a shelf allocator, separated by a padding and
+ * optionally extruded by one pixel to avoid bleeding when filtering.
+ * New images are packed incrementally into the free space of existing pages,
+ * a full Rebuild() repacks everything sorted by height for a tighter fit.
+ * Textures added to the atlas get their sprites remapped to atlas coordinates,
+ * so sprites from different files share the same sf::Texture and can be batched.
+ */
+class TextureAtlas : public AResource
+{
+public:
+	/**
+	 * \struct Region
+	 * \brief Location of a packed image inside the atlas.
+	 */
+	struct Region
+	{
+		/// Index of the page containing the image.
+		unsigned int page = 0;
+
+		/// Rectangle of the image inside the page, padding excluded.
+		sf::IntRect rect;
+	};
+
+	/**
+	 * \brief Constructor.
+	 * \param _page_size Width and height of each atlas page in pixels.
+	 * \param _padding Empty pixels kept between two packed images.
+	 * \param _extrude Whether image borders are extruded by one pixel into the padding.
+	 */
+	explicit TextureAtlas(unsigned int _page_size = 2048, unsigned int _padding = 2, bool _extrude = false);
+
+	/**
+	 * \brief Destructor.
+	 */
+	~TextureAtlas() override;
+
+	/**
+	 * \brief Packs an image into the atlas.
+	 * \param _name The name used to retrieve the region.
+	 * \param _image The image to pack.
+	 * \return True if the image was packed, false if it is larger than a page.
+	 */
+	bool AddImage(const std::string& _name, const sf::Image& _image);
+
+	/**
+	 * \brief Loads an image from a file and packs it into the atlas.
+	 * \param _name The name used to retrieve the region.
+	 * \param _path The path to the image file.
+	 * \return True if the image was loaded and packed, false otherwise.
+	 */
+	bool AddImageFromFile(const std::string& _name, const std::string& _path);
+
+	/**
+	 * \brief Packs a texture into the atlas and remaps its sprites to atlas coordinates.
+	 * \param _name The name used to retrieve the region.
+	 * \param _texture The texture to pack.
+	 * \return True if the texture was packed, false otherwise.
+	 */
+	bool AddTexture(const std::string& _name, Texture* _texture);
+
+	/**
+	 * \brief Uploads a new version of a packed texture, repacking it if its size changed.
+	 * \param _texture The packed texture.
+	 * \param _image The new content of the texture.
+	 */
+	void UpdateTexture(Texture* _texture, const sf::Image& _image);
+
+	/**
+	 * \brief Removes a texture from the atlas, its sprites go back to the original texture.
+	 * \param _texture The texture to remove.
+	 */
+	void RemoveTexture(Texture* _texture);
+
+	/**
+	 * \brief Repacks every image from scratch, sorted by height, and remaps all textures.
+	 */
+	void Rebuild();
+
+	/**
+	 * \brief Gets the region of a packed image.
+	 * \param _name The name of the image.
+	 * \return Pointer to the region, or nullptr if the image is not in the atlas.
+	 */
+	const Region* GetRegion(const std::string& _name) const;
+
+	/**
+	 * \brief Gets an atlas page.
+	 * \param _index The index of the page.
+	 * \return Pointer to the page texture, or nullptr if the index is out of range.
+	 */
+	const sf::Texture* GetPage(unsigned int _index) const;
+
+	/**
+	 * \brief Gets the number of atlas pages.
+	 * \return The page count.
+	 */
+	unsigned int GetPageCount() const;
+
+	/**
+	 * \brief Gets the number of packed images.
+	 * \return The image count.
+	 */
+	unsigned int GetImageCount() const;
+
+	/**
+	 * \brief Gets the number of draw calls saved by the atlas.
+	 *
+	 * Drawing one sprite of each packed image needs one texture switch per page
+	 * instead of one per image.
+	 * \return The number of draw calls saved.
+	 */
+	unsigned int GetDrawCallsSaved() const;
+
+	/**
+	 * \brief Unloads the atlas pages.
+	 */
+	void Unload() override;
+
+	/**
+	 * \brief Gets the memory used by the pages and the images kept for rebuilds.
+	 * \return The size in bytes.
+	 */
+	std::size_t GetMemorySize() const override;
+
+private:
+	/**
+	 * \struct Shelf
+	 * \brief A row of the shelf allocator.
+	 */
+	struct Shelf
+	{
+		unsigned int y = 0;
+		unsigned int height = 0;
+		unsigned int cursor = 0;
+	};
+
+	/**
+	 * \struct Page
+	 * \brief An atlas texture with its allocator state.
+	 */
+	struct Page
+	{
+		sf::Texture texture;
+		std::vector<Shelf> shelves;
+		unsigned int nextShelfY = 0;
+	};
+
+	/**
+	 * \struct Entry
+	 * \brief A packed image, kept on the CPU side for incremental rebuilds.
+	 */
+	struct Entry
+	{
+		sf::Image image;
+		Region region;
+		Texture* texture = nullptr;
+	};
+
+	/**
+	 * \brief Finds a place for an image and uploads it.
+	 * \param _entry The entry to pack.
+	 * \return True if the entry was packed.
+	 */
+	bool Pack(Entry& _entry);
+
+	/**
+	 * \brief Tries to allocate a padded rectangle inside a page.
+	 * \param _page The page to allocate in.
+	 * \param _width The padded width.
+	 * \param _height The padded height.
+	 * \param _position Output position of the allocated rectangle.
+	 * \return True if the allocation succeeded.
+	 */
+	bool Allocate(Page& _page, unsigned int _width, unsigned int _height, sf::Vector2u& _position) const;
+
+	/**
+	 * \brief Creates a new empty page.
+	 * \return The created page.
+	 */
+	Page* CreatePage();
+
+	/**
+	 * \brief Uploads an image into its page, with extrusion if enabled.
+	 * \param _entry The entry to upload.
+	 */
+	void Upload(const Entry& _entry);
+
+	unsigned int pageSize = 2048;
+	unsigned int padding = 2;
+	bool extrude = false;
+
+	std::vector<Page*> pages;
+	std::unordered_map<std::string, Entry> entries;
+};
@@ -2,12 +2,16 @@
 #include <SFML/Graphics/RenderWindow.hpp>
 
 #include "GameObject.h"
+#include "Animation/AnimationSystem.h"
+#include "Physics/CollisionWorld.h"
+#include "Physics/PhysicsWorld.h"
+#include "Serialization/ComponentRegistry.h"
 
 class Scene
 {
 public:
 	explicit Scene(const std::string& _name);
-	virtual ~Scene() = default;
+	virtual ~Scene();
 
 	void Awake() const;
 	void Start() const;
@@ -34,7 +38,72 @@ public:
 	GameObject* FindGameObject(const std::string& _name) const;
 	const std::vector<GameObject*>& GetGameObjects() const;
 
+	void ReserveGameObjects(std::size_t _count);
+
+	/**
+	 * \brief Gets a number changed whenever a game object of the scene is created, destroyed or renamed.
+	 * \return The version, kept by the caches of the game objects to know when they are stale.
+	 */
+	std::uint32_t GetGameObjectsVersion() const { return gameObjectsVersion; }
+
+	/**
+	 * \brief Changes the version of the game objects, called by a game object of the scene when renamed.
+	 */
+	void OnGameObjectRenamed() { ++gameObjectsVersion; }
+
+	/**
+	 * \brief Deletes the last game objects, to spread the deletion of a large scene over several frames.
+	 * \param _max_count The number of game objects to delete at most.
+	 * \return True if no game object is left.
+	 */
+	bool DeleteGameObjects(std::size_t _max_count);
+
+	/**
+	 * \brief Takes ownership of components allocated in one block, destroyed after the game objects.
+	 * \param _type The type of the components.
+	 * \param _pool The pool created with ComponentRegistry::CreatePool().
+	 */
+	void AddComponentPool(const ComponentRegistry::ComponentType* _type, void* _pool);
+
+	/**
+	 * \brief Gets the colliders of the scene, updated by the PhysicsModule.
+	 * \return The collision world.
+	 */
+	CollisionWorld& GetCollisionWorld() { return collisionWorld; }
+	const CollisionWorld& GetCollisionWorld() const { return collisionWorld; }
+
+	/**
+	 * \brief Gets the rigidbodies of the scene, stepped by the PhysicsModule.
+	 * \return The physics world.
+	 */
+	PhysicsWorld& GetPhysicsWorld() { return physicsWorld; }
+	const PhysicsWorld& GetPhysicsWorld() const { return physicsWorld; }
+
+	/**
+	 * \brief Gets the animators of the scene, updated by the SceneModule.
+	 * \return The animation system.
+	 */
+	AnimationSystem& GetAnimationSystem() { return animationSystem; }
+	const AnimationSystem& GetAnimationSystem() const { return animationSystem; }
+
 private:
+	struct ComponentPool
+	{
+		const ComponentRegistry::ComponentType* type = nullptr;
+		void* data = nullptr;
+	};
+
 	std::string name;
 	std::vector<GameObject*> gameObjects;
+	std::vector<ComponentPool> componentPools;
+	std::uint32_t gameObjectsVersion = 0;
+
+	/// Colliders of the game objects, they remove themselves when the destructor deletes the game objects.
+	CollisionWorld collisionWorld;
+
+	/// Bodies of the game objects, built on the colliders above.
+	PhysicsWorld physicsWorld{collisionWorld};
+
+	/// Animators of the game objects, they remove themselves like the colliders.
+	AnimationSystem animationSystem;
 };
@@ -0,0 +1,54 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+
+#include <SFML/Graphics/Color.hpp>
+
+#include "Maths/Vector2.h"
+
+/**
+ * \class Archive
+ * \brief Visitor over the serialized fields of an object.
+ *
+ * Components describe their state once in Component::Serialize() by calling Field()
+ * for every member, the same code then writes, reads or exports the component
+ * depending on the archive it is given.
+ */
+class Archive
+{
+public:
+	/**
+	 * \brief Destructor.
+	 */
+	virtual ~Archive() = default;
+
+	/**
+	 * \brief Checks if the archive assigns the fields instead of reading them.
+	 * \return True when loading.
+	 */
+	virtual bool IsReading() const = 0;
+
+	/**
+	 * \brief Gets the version of the data, to read fields written by older versions.
+	 * \return The version the data was written with.
+	 */
+	std::uint32_t GetVersion() const { return version; }
+
+	/**
+	 * \brief Sets the version of the data.
+	 * \param _version The version the data was written with.
+	 */
+	void SetVersion(const std::uint32_t _version) { version = _version; }
+
+	virtual void Field(const char* _name, bool& _value) = 0;
+	virtual void Field(const char* _name, std::int32_t& _value) = 0;
+	virtual void Field(const char* _name, std::uint32_t& _value) = 0;
+	virtual void Field(const char* _name, float& _value) = 0;
+	virtual void Field(const char* _name, std::string& _value) = 0;
+	virtual void Field(const char* _name, Maths::Vector2f& _value) = 0;
+	virtual void Field(const char* _name, sf::Color& _value) = 0;
+
+protected:
+	std::uint32_t version = 1;
+};
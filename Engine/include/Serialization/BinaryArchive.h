@@ -0,0 +1,104 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "Serialization/Archive.h"
+
+/**
+ * \class BinaryWriter
+ * \brief Archive appending fields to a byte buffer, without names nor padding.
+ */
+class BinaryWriter final : public Archive
+{
+public:
+	/**
+	 * \brief Constructor.
+	 * \param _buffer The buffer the fields are appended to.
+	 */
+	explicit BinaryWriter(std::vector<std::uint8_t>& _buffer) : buffer(_buffer) {}
+
+	bool IsReading() const override { return false; }
+
+	/**
+	 * \brief Appends raw bytes.
+	 * \param _data The bytes to append.
+	 * \param _size The number of bytes.
+	 */
+	void Write(const void* _data, std::size_t _size);
+
+	/**
+	 * \brief Gets the number of bytes in the buffer.
+	 * \return The size of the buffer.
+	 */
+	std::size_t GetPosition() const { return buffer.size(); }
+
+	void Field(const char* _name, bool& _value) override;
+	void Field(const char* _name, std::int32_t& _value) override;
+	void Field(const char* _name, std::uint32_t& _value) override;
+	void Field(const char* _name, float& _value) override;
+	void Field(const char* _name, std::string& _value) override;
+	void Field(const char* _name, Maths::Vector2f& _value) override;
+	void Field(const char* _name, sf::Color& _value) override;
+
+private:
+	std::vector<std::uint8_t>& buffer;
+};
+
+/**
+ * \class BinaryReader
+ * \brief Archive assigning fields from a byte buffer written by a BinaryWriter.
+ *
+ * Reading past the end of the buffer zeroes the fields and invalidates the reader
+ * instead of failing on every call, IsValid() is checked once everything is read.
+ */
+class BinaryReader final : public Archive
+{
+public:
+	/**
+	 * \brief Constructor.
+	 * \param _data The buffer to read, must outlive the reader.
+	 * \param _size The size of the buffer.
+	 */
+	BinaryReader(const void* _data, std::size_t _size) : data(static_cast<const std::uint8_t*>(_data)), size(_size) {}
+
+	bool IsReading() const override { return true; }
+
+	/**
+	 * \brief Reads raw bytes.
+	 * \param _data The destination of the bytes.
+	 * \param _size The number of bytes.
+	 * \return True if the bytes were read.
+	 */
+	bool Read(void* _data, std::size_t _size);
+
+	/**
+	 * \brief Gets a view on the next bytes and moves past them.
+	 * \param _size The number of bytes.
+	 * \return Pointer to the bytes, or nullptr if the buffer is too small.
+	 */
+	const std::uint8_t* Skip(std::size_t _size);
+
+	/**
+	 * \brief Checks that nothing was read past the end of the buffer.
+	 * \return True if every read succeeded.
+	 */
+	bool IsValid() const { return valid; }
+
+	std::size_t GetPosition() const { return position; }
+	std::size_t GetRemaining() const { return size - position; }
+
+	void Field(const char* _name, bool& _value) override;
+	void Field(const char* _name, std::int32_t& _value) override;
+	void Field(const char* _name, std::uint32_t& _value) override;
+	void Field(const char* _name, float& _value) override;
+	void Field(const char* _name, std::string& _value) override;
+	void Field(const char* _name, Maths::Vector2f& _value) override;
+	void Field(const char* _name, sf::Color& _value) override;
+
+private:
+	const std::uint8_t* data = nullptr;
+	std::size_t size = 0;
+	std::size_t position = 0;
+	bool valid = true;
+};
@@ -0,0 +1,118 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <typeindex>
+#include <typeinfo>
+#include <unordered_map>
+
+class Component;
+
+/**
+ * \class ComponentRegistry
+ * \brief Registry of the serializable component types, by name hash and by C++ type.
+ *
+ * Engine components are registered automatically, game components are registered
+ * once at startup with Register<T>(), before any scene is saved or loaded.
+ * Registration is not thread-safe, lookups are.
+ */
+class ComponentRegistry
+{
+public:
+	/**
+	 * \struct ComponentType
+	 * \brief A serializable component type, with the functions creating it.
+	 */
+	struct ComponentType
+	{
+		/// Hash of the name, stored in scene files.
+		std::uint32_t id = 0;
+
+		std::string name;
+
+		/// Version of the serialized data, given to the Archive when reading.
+		std::uint32_t version = 1;
+
+		/// Creates one component.
+		Component* (*create)() = nullptr;
+
+		/// Creates an array of components in one allocation.
+		void* (*createPool)(std::size_t _count) = nullptr;
+
+		/// Gets a component of a pool.
+		Component* (*getPoolElement)(void* _pool, std::size_t _index) = nullptr;
+
+		/// Destroys a pool created by createPool.
+		void (*destroyPool)(void* _pool) = nullptr;
+	};
+
+	/**
+	 * \brief Registers a component type.
+	 * \tparam T The type of the component, default constructible.
+	 * \param _name The name of the type, stored as a hash in scene files so it must not change.
+	 * \param _version The version of the serialized data, bumped when Serialize() changes.
+	 * \return The registered type, or nullptr if another type has the same name hash.
+	 */
+	template<typename T>
+	static const ComponentType* Register(const std::string& _name, std::uint32_t _version = 1);
+
+	/**
+	 * \brief Finds a type by its id.
+	 * \param _id The id of the type.
+	 * \return The type, or nullptr if not registered.
+	 */
+	static const ComponentType* Find(std::uint32_t _id);
+
+	/**
+	 * \brief Finds a type by its name.
+	 * \param _name The name of the type.
+	 * \return The type, or nullptr if not registered.
+	 */
+	static const ComponentType* Find(const std::string& _name);
+
+	/**
+	 * \brief Finds the type of a component from its dynamic type.
+	 * \param _component The component.
+	 * \return The type, or nullptr if not registered.
+	 */
+	static const ComponentType* Find(const Component* _component);
+
+	/**
+	 * \brief Creates a pool of components, flagged as pooled so their owner does not delete them.
+	 * \param _type The type of the components.
+	 * \param _count The number of components.
+	 * \return The pool, to destroy with _type.destroyPool.
+	 */
+	static void* CreatePool(const ComponentType& _type, std::size_t _count);
+
+	/**
+	 * \brief Hashes a type name, FNV-1a.
+	 * \param _name The name to hash.
+	 * \return The id of the type.
+	 */
+	static std::uint32_t HashName(const std::string& _name);
+
+private:
+	/**
+	 * \struct Registry
+	 * \brief Registered types, node based so pointers to them stay valid.
+	 */
+	struct Registry
+	{
+		std::unordered_map<std::uint32_t, ComponentType> types;
+		std::unordered_map<std::type_index, const ComponentType*> typesByIndex;
+	};
+
+	/**
+	 * \brief Gets the registry, registering the engine components on first use.
+	 * \return The registry.
+	 */
+	static Registry& GetRegistry();
+
+	template<typename T>
+	static ComponentType MakeType(const std::string& _name, std::uint32_t _version);
+
+	static const ComponentType* Add(Registry& _registry, const std::type_index& _type_index, ComponentType&& _type);
+};
+
+#include "ComponentRegistry.inl"
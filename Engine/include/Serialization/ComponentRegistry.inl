@@ -0,0 +1,38 @@
+#pragma once
+
+template<typename T>
+const ComponentRegistry::ComponentType* ComponentRegistry::Register(const std::string& _name, const std::uint32_t _version)
+{
+    return Add(GetRegistry(), std::type_index(typeid(T)), MakeType<T>(_name, _version));
+}
+
+template<typename T>
+ComponentRegistry::ComponentType ComponentRegistry::MakeType(const std::string& _name, const std::uint32_t _version)
+{
+    ComponentType type;
+    type.id = HashName(_name);
+    type.name = _name;
+    type.version = _version;
+
+    type.create = []() -> Component*
+    {
+        return new T();
+    };
+
+    type.createPool = [](const std::size_t _count) -> void*
+    {
+        return new T[_count];
+    };
+
+    type.getPoolElement = [](void* _pool, const std::size_t _index) -> Component*
+    {
+        return static_cast<T*>(_pool) + _index;
+    };
+
+    type.destroyPool = [](void* _pool)
+    {
+        delete[] static_cast<T*>(_pool);
+    };
+
+    return type;
+}
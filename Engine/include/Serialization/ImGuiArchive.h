@@ -0,0 +1,33 @@
+#pragma once
+
+#include "Serialization/Archive.h"
+
+/**
+ * \class ImGuiArchive
+ * \brief Archive drawing an edit widget for every field, so components show in the inspector without UI code of their own.
+ *
+ * Fields are edited in place. IsReading() is false: components must not redo their
+ * loading work every frame they are displayed.
+ */
+class ImGuiArchive final : public Archive
+{
+public:
+	bool IsReading() const override { return false; }
+
+	/**
+	 * \brief Checks if a field was edited since the archive was created.
+	 * \return True if a value changed.
+	 */
+	bool IsModified() const { return modified; }
+
+	void Field(const char* _name, bool& _value) override;
+	void Field(const char* _name, std::int32_t& _value) override;
+	void Field(const char* _name, std::uint32_t& _value) override;
+	void Field(const char* _name, float& _value) override;
+	void Field(const char* _name, std::string& _value) override;
+	void Field(const char* _name, Maths::Vector2f& _value) override;
+	void Field(const char* _name, sf::Color& _value) override;
+
+private:
+	bool modified = false;
+};
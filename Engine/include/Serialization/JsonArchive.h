@@ -0,0 +1,75 @@
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include "Serialization/Archive.h"
+
+/**
+ * \class JsonWriter
+ * \brief Archive exporting fields as indented JSON, one field per line so files diff well.
+ *
+ * Floats are written with enough digits to be read back exactly.
+ */
+class JsonWriter final : public Archive
+{
+public:
+	/**
+	 * \brief Constructor.
+	 * \param _output The string the JSON is appended to.
+	 */
+	explicit JsonWriter(std::string& _output) : output(_output) {}
+
+	bool IsReading() const override { return false; }
+
+	/**
+	 * \brief Opens an object, as a field of the current object or as an element of the current array.
+	 * \param _name The name of the field, nullptr inside an array or for the root.
+	 */
+	void BeginObject(const char* _name = nullptr);
+
+	/**
+	 * \brief Closes the current object.
+	 */
+	void EndObject();
+
+	/**
+	 * \brief Opens an array, as a field of the current object.
+	 * \param _name The name of the field.
+	 */
+	void BeginArray(const char* _name);
+
+	/**
+	 * \brief Closes the current array.
+	 */
+	void EndArray();
+
+	void Field(const char* _name, bool& _value) override;
+	void Field(const char* _name, std::int32_t& _value) override;
+	void Field(const char* _name, std::uint32_t& _value) override;
+	void Field(const char* _name, float& _value) override;
+	void Field(const char* _name, std::string& _value) override;
+	void Field(const char* _name, Maths::Vector2f& _value) override;
+	void Field(const char* _name, sf::Color& _value) override;
+
+private:
+	/**
+	 * \brief Starts a new line for a value, with its separator, indentation and name.
+	 * \param _name The name of the field, nullptr inside an array.
+	 */
+	void NewValue(const char* _name);
+
+	/**
+	 * \brief Closes the current object or array.
+	 * \param _character The closing character.
+	 */
+	void Close(char _character);
+
+	void AppendString(const std::string& _value);
+	void AppendFloat(float _value);
+
+	std::string& output;
+
+	/// Whether the current object or array is still empty, one per nesting level.
+	std::vector<bool> empty;
+};
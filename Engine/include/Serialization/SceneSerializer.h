@@ -0,0 +1,129 @@
+#pragma once
+
+#include <cstdint>
+#include <filesystem>
+#include <string>
+#include <vector>
+
+class Scene;
+
+/**
+ * \class SceneSerializer
+ * \brief Saves scenes to a versioned binary format and loads them back in bulk.
+ *
+ * Layout of a scene file:
+ * - a Header,
+ * - one ObjectRecord per game object, holding its transform,
+ * - the names table: the scene name followed by every game object name,
+ * - one pool per component type: a PoolHeader, one PoolSlot per component
+ *   and the components data written by Component::Serialize().
+ *
+ * Loading reads the records in one block and creates every component of a type
+ * in one allocation owned by the scene. Pools of unregistered types are skipped.
+ */
+class SceneSerializer
+{
+public:
+	/// "SDES" read as a little-endian integer.
+	static constexpr std::uint32_t Magic = 0x53454453;
+
+	/// Version of the format, bumped on any layout change.
+	static constexpr std::uint32_t Version = 1;
+
+	/**
+	 * \struct Header
+	 * \brief Header at the beginning of a scene file.
+	 */
+	struct Header
+	{
+		std::uint32_t magic = Magic;
+		std::uint32_t version = Version;
+		std::uint32_t objectCount = 0;
+		std::uint32_t poolCount = 0;
+		std::uint32_t namesSize = 0;
+		std::uint32_t sceneNameLength = 0;
+	};
+
+	/**
+	 * \struct ObjectRecord
+	 * \brief A game object, its name is stored in the names table.
+	 */
+	struct ObjectRecord
+	{
+		float position[2] = {};
+		float rotation = 0.0f;
+		float scale[2] = {};
+		std::uint32_t nameOffset = 0;
+		std::uint32_t nameLength = 0;
+		std::uint32_t componentCount = 0;
+	};
+
+	/**
+	 * \struct PoolHeader
+	 * \brief The components of one type.
+	 */
+	struct PoolHeader
+	{
+		std::uint32_t typeId = 0;
+		std::uint32_t typeVersion = 0;
+		std::uint32_t count = 0;
+		std::uint32_t reserved = 0;
+		std::uint64_t dataSize = 0;
+	};
+
+	/**
+	 * \struct PoolSlot
+	 * \brief The place of a pooled component in its game object.
+	 */
+	struct PoolSlot
+	{
+		std::uint32_t owner = 0;
+		std::uint32_t slot = 0;
+	};
+
+	/**
+	 * \brief Writes a scene to a buffer.
+	 * \param _scene The scene to save.
+	 * \param _buffer The buffer receiving the scene, cleared first.
+	 * \return The number of components skipped because their type is not registered.
+	 */
+	static std::size_t Save(const Scene& _scene, std::vector<std::uint8_t>& _buffer);
+
+	/**
+	 * \brief Writes a scene to a file.
+	 * \param _scene The scene to save.
+	 * \param _path The path of the file.
+	 * \return True if the file was written.
+	 */
+	static bool SaveToFile(const Scene& _scene, const std::filesystem::path& _path);
+
+	/**
+	 * \brief Creates a scene from a buffer, safe to call from any thread.
+	 * \param _data The content of a scene file.
+	 * \param _size The size of the content.
+	 * \return The new scene, or nullptr if the content is invalid.
+	 */
+	static Scene* Load(const void* _data, std::size_t _size);
+
+	/**
+	 * \brief Creates a scene from a file, read in one block.
+	 * \param _path The path of the file.
+	 * \return The new scene, or nullptr if the file could not be read or is invalid.
+	 */
+	static Scene* LoadFromFile(const std::filesystem::path& _path);
+
+	/**
+	 * \brief Exports a scene as JSON, with one field per line for diffing.
+	 * \param _scene The scene to export.
+	 * \return The JSON text.
+	 */
+	static std::string ExportJson(const Scene& _scene);
+
+	/**
+	 * \brief Exports a scene as a JSON file.
+	 * \param _scene The scene to export.
+	 * \param _path The path of the file.
+	 * \return True if the file was written.
+	 */
+	static bool ExportJsonToFile(const Scene& _scene, const std::filesystem::path& _path);
+};
@@ -0,0 +1,94 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "Serialization/ComponentRegistry.h"
+
+class Scene;
+
+/**
+ * \class SceneSnapshot
+ * \brief Captures the state of a scene in one contiguous buffer and restores it in place.
+ *
+ * Only the state is captured: the transform of every game object and the fields of
+ * every component written by Component::Serialize(). Restoring assigns them back to
+ * the existing objects without creating nor destroying anything, so the scene must
+ * still have the structure it had when captured, which is checked before anything
+ * is assigned.
+ *
+ * The buffer keeps its capacity between captures, taking a snapshot every frame does
+ * not allocate once the scene stops growing.
+ */
+class SceneSnapshot
+{
+public:
+	/// "SNAP" read as a little-endian integer.
+	static constexpr std::uint32_t Magic = 0x50414E53;
+
+	/**
+	 * \struct Header
+	 * \brief Header at the beginning of a snapshot.
+	 */
+	struct Header
+	{
+		std::uint32_t magic = Magic;
+		std::uint32_t objectCount = 0;
+		std::uint32_t componentCount = 0;
+		std::uint32_t stateOffset = 0;
+		std::uint32_t stateSize = 0;
+	};
+
+	/**
+	 * \brief Captures the state of a scene, replacing the previous one.
+	 * \param _scene The scene to capture.
+	 */
+	void Capture(const Scene& _scene);
+
+	/**
+	 * \brief Assigns the captured state back to a scene.
+	 * \param _scene The scene, with the game objects and components it had when captured.
+	 * \return False if the snapshot is empty, invalid or does not match the scene, which is then left untouched.
+	 */
+	bool Restore(Scene& _scene) const;
+
+	/**
+	 * \brief Gets the captured bytes, to be written in a save game or sent over the network.
+	 * \return The content of the snapshot.
+	 */
+	const std::vector<std::uint8_t>& GetData() const { return data; }
+
+	/**
+	 * \brief Replaces the snapshot by bytes previously returned by GetData().
+	 * \param _data The content of a snapshot.
+	 * \param _size The size of the content.
+	 */
+	void SetData(const void* _data, std::size_t _size);
+
+	/**
+	 * \brief Checks if the snapshot holds a capture.
+	 * \return True if it is empty.
+	 */
+	bool IsEmpty() const { return data.empty(); }
+
+	/**
+	 * \brief Empties the snapshot, keeping its memory for the next capture.
+	 */
+	void Clear() { data.clear(); }
+
+private:
+	/**
+	 * \brief Checks that the scene has the game objects and components the snapshot was captured from.
+	 * \param _scene The scene to check.
+	 * \param _header The header of the snapshot.
+	 * \return True if the state can be restored.
+	 */
+	bool Matches(const Scene& _scene, const Header& _header) const;
+
+	/// The type of every component in layout order, looked up once per capture or restore.
+	mutable std::vector<const ComponentRegistry::ComponentType*> types;
+
+	/// The Header, the layout of the scene (per game object its component count then
+	/// their type ids) and the state of every game object.
+	std::vector<std::uint8_t> data;
+};
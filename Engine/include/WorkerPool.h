@@ -0,0 +1,72 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/**
+ * \class WorkerPool
+ * \brief Threads kept waiting to run the tasks of a loop in parallel, the caller working with them.
+ *
+ * Tasks are claimed one at a time, a thread finishing early takes the next one. The
+ * split of the work into tasks is left to the caller: with tasks that do not depend
+ * on the number of threads, results do not either.
+ */
+class WorkerPool
+{
+public:
+	/**
+	 * \brief Constructor, starts the threads.
+	 * \param _thread_count Threads running the tasks, the caller included. 1 runs everything on the caller.
+	 */
+	explicit WorkerPool(std::size_t _thread_count);
+
+	/**
+	 * \brief Destructor, joins the threads.
+	 */
+	~WorkerPool();
+
+	WorkerPool(const WorkerPool&) = delete;
+	WorkerPool& operator=(const WorkerPool&) = delete;
+
+	std::size_t GetThreadCount() const { return threads.size() + 1; }
+
+	/**
+	 * \brief Runs tasks on every thread and waits for all of them.
+	 * \param _count The number of tasks.
+	 * \param _task Called once with each index from 0 to _count - 1, from any thread.
+	 */
+	void ParallelFor(std::size_t _count, const std::function<void(std::size_t)>& _task);
+
+private:
+	/**
+	 * \brief Body of the threads.
+	 */
+	void Run();
+
+	/**
+	 * \brief Claims and runs tasks until none are left.
+	 */
+	void RunTasks();
+
+	std::vector<std::thread> threads;
+
+	std::mutex mutex;
+	std::condition_variable startCondition;
+	std::condition_variable doneCondition;
+
+	/// Incremented for every loop, threads wake up when it changes.
+	std::uint64_t generation = 0;
+	bool stopping = false;
+
+	/// Threads inside RunTasks(), the loop is over once none are left.
+	std::size_t activeThreads = 0;
+
+	const std::function<void(std::size_t)>* task = nullptr;
+	std::size_t taskCount = 0;
+	std::atomic<std::size_t> nextTask = 0;
+};
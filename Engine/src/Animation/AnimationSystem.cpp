@@ -0,0 +1,101 @@
+#include "Animation/AnimationSystem.h"
+
+#include "Animation/AnimationClip.h"
+#include "Components/SpriteRenderer.h"
+
+AnimationId AnimationSystem::Add()
+{
+	AnimationId id;
+	if (!freeIds.empty())
+	{
+		id = freeIds.back();
+		freeIds.pop_back();
+	}
+	else
+	{
+		id = static_cast<AnimationId>(indices.size());
+		indices.emplace_back();
+	}
+
+	indices[id] = static_cast<std::uint32_t>(animations.size());
+	animations.emplace_back().id = id;
+	return id;
+}
+
+void AnimationSystem::Remove(const AnimationId _id)
+{
+	const std::uint32_t index = indices[_id];
+	animations[index] = animations.back();
+	indices[animations[index].id] = index;
+	animations.pop_back();
+
+	freeIds.push_back(_id);
+}
+
+void AnimationSystem::Play(const AnimationId _id, const AnimationClip* _clip)
+{
+	Animation& animation = animations[indices[_id]];
+	animation.clip = _clip && !_clip->frames.empty() ? _clip : nullptr;
+	animation.frame = 0;
+	animation.timer = 0.0f;
+	ApplyFrame(animation);
+}
+
+void AnimationSystem::SetRenderer(const AnimationId _id, SpriteRenderer* _renderer)
+{
+	Animation& animation = animations[indices[_id]];
+	animation.renderer = _renderer;
+	ApplyFrame(animation);
+}
+
+bool AnimationSystem::IsFinished(const AnimationId _id) const
+{
+	const Animation& animation = animations[indices[_id]];
+	return animation.clip && !animation.clip->loop && animation.frame + 1 == animation.clip->frames.size();
+}
+
+void AnimationSystem::Update(const float _delta_time)
+{
+	for (Animation& animation : animations)
+	{
+		if (!animation.clip)
+			continue;
+
+		const AnimationClip& clip = *animation.clip;
+		animation.timer += _delta_time * animation.speed;
+		if (animation.timer < clip.frameDuration)
+			continue;
+
+		// A long frame, or a fast clip, may skip frames
+		const std::uint32_t frame_count = static_cast<std::uint32_t>(clip.frames.size());
+		const std::uint32_t steps = clip.frameDuration > 0.0f ? static_cast<std::uint32_t>(animation.timer / clip.frameDuration) : 1;
+		animation.timer -= static_cast<float>(steps) * clip.frameDuration;
+
+		std::uint32_t frame = animation.frame + steps;
+		if (frame >= frame_count)
+		{
+			if (clip.loop)
+			{
+				frame %= frame_count;
+			}
+			else
+			{
+				frame = frame_count - 1;
+				animation.timer = 0.0f;
+			}
+		}
+
+		if (frame == animation.frame)
+			continue;
+
+		animation.frame = frame;
+		if (animation.renderer)
+			animation.renderer->SetSprite(clip.frames[frame]);
+	}
+}
+
+void AnimationSystem::ApplyFrame(const Animation& _animation) const
+{
+	if (_animation.renderer && _animation.clip)
+		_animation.renderer->SetSprite(_animation.clip->frames[_animation.frame]);
+}
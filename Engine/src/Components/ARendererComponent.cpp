@@ -1,7 +1,22 @@
 #include "Components/ARendererComponent.h"
 #include "Component.h"
+#include "Modules/WindowModule.h"
+#include "Serialization/Archive.h"
 
 void ARendererComponent::Render(sf::RenderWindow* _window)
 {
 	Component::Render(_window);
 }
+
+void ARendererComponent::Draw(sf::RenderWindow* _window, const sf::Drawable& _drawable)
+{
+	_window->draw(_drawable);
+	WindowModule::CountDrawCall();
+}
+
+void ARendererComponent::Serialize(Archive& _archive)
+{
+	Component::Serialize(_archive);
+
+	_archive.Field("size", size);
+}
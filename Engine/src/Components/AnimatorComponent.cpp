@@ -0,0 +1,78 @@
+#include "Components/AnimatorComponent.h"
+
+#include "GameObject.h"
+#include "Scene.h"
+#include "Components/SpriteRenderer.h"
+#include "Serialization/Archive.h"
+
+void AnimatorComponent::Play(const AnimationClip* _clip)
+{
+	clip = _clip;
+
+	if (system)
+		system->Play(animationId, clip);
+}
+
+std::uint32_t AnimatorComponent::GetFrame() const
+{
+	return system ? system->GetFrame(animationId) : 0;
+}
+
+bool AnimatorComponent::IsFinished() const
+{
+	return system && system->IsFinished(animationId);
+}
+
+void AnimatorComponent::SetSpeed(const float _speed)
+{
+	speed = _speed;
+
+	if (system)
+		system->SetSpeed(animationId, speed);
+}
+
+void AnimatorComponent::SetRenderer(SpriteRenderer* _renderer)
+{
+	if (system)
+		system->SetRenderer(animationId, _renderer);
+}
+
+void AnimatorComponent::OnAttach()
+{
+	Component::OnAttach();
+
+	Scene* scene = GetOwner()->GetScene();
+	if (!scene || system)
+		return;
+
+	system = &scene->GetAnimationSystem();
+	animationId = system->Add();
+	system->SetSpeed(animationId, speed);
+	system->Play(animationId, clip);
+
+	if (SpriteRenderer* renderer = GetOwner()->GetComponent<SpriteRenderer>())
+		system->SetRenderer(animationId, renderer);
+}
+
+void AnimatorComponent::OnDetach()
+{
+	Component::OnDetach();
+
+	if (!system)
+		return;
+
+	system->Remove(animationId);
+	system = nullptr;
+	animationId = InvalidAnimation;
+}
+
+void AnimatorComponent::Serialize(Archive& _archive)
+{
+	Component::Serialize(_archive);
+
+	float current_speed = speed;
+	_archive.Field("speed", current_speed);
+
+	if (current_speed != speed)
+		SetSpeed(current_speed);
+}
@@ -0,0 +1,321 @@
+#include "Components/ParticleEmitter.h"
+
+#include <algorithm>
+#include <cmath>
+#include <numbers>
+
+#include "GameObject.h"
+#include "Maths/FloatBatch.h"
+#include "Serialization/Archive.h"
+
+namespace
+{
+	// Field names of the curve keys, the archive keeps the pointers
+	constexpr const char* SizeKeyTimeNames[ParticleEmitter::MaxCurveKeys] = {"sizeKey0Time", "sizeKey1Time", "sizeKey2Time", "sizeKey3Time",
+		"sizeKey4Time", "sizeKey5Time", "sizeKey6Time", "sizeKey7Time"};
+	constexpr const char* SizeKeySizeNames[ParticleEmitter::MaxCurveKeys] = {"sizeKey0Size", "sizeKey1Size", "sizeKey2Size", "sizeKey3Size",
+		"sizeKey4Size", "sizeKey5Size", "sizeKey6Size", "sizeKey7Size"};
+	constexpr const char* ColorKeyTimeNames[ParticleEmitter::MaxCurveKeys] = {"colorKey0Time", "colorKey1Time", "colorKey2Time", "colorKey3Time",
+		"colorKey4Time", "colorKey5Time", "colorKey6Time", "colorKey7Time"};
+	constexpr const char* ColorKeyColorNames[ParticleEmitter::MaxCurveKeys] = {"colorKey0Color", "colorKey1Color", "colorKey2Color", "colorKey3Color",
+		"colorKey4Color", "colorKey5Color", "colorKey6Color", "colorKey7Color"};
+
+	std::uint8_t LerpChannel(const std::uint8_t _start, const std::uint8_t _end, const float _alpha)
+	{
+		return static_cast<std::uint8_t>(std::lround(static_cast<float>(_start) + (static_cast<float>(_end) - static_cast<float>(_start)) * _alpha));
+	}
+
+	/**
+	 * \brief Finds the keys around a time in a curve.
+	 * \param _keys The keys, sorted by time.
+	 * \param _count The number of keys, at least 1.
+	 * \param _time The fraction of the life.
+	 * \param _from Index of the last key at or before the time, the first key before it.
+	 * \param _to Index of the key after it, the same key past the last one.
+	 * \return How far the time is from the first key to the second, from 0 to 1.
+	 */
+	template<typename Key>
+	float FindKeys(const Key* _keys, const std::size_t _count, const float _time, std::size_t& _from, std::size_t& _to)
+	{
+		_from = 0;
+		while (_from + 1 < _count && _keys[_from + 1].time <= _time)
+			++_from;
+		_to = std::min(_from + 1, _count - 1);
+
+		const float span = _keys[_to].time - _keys[_from].time;
+		return span > 0.0f ? std::clamp((_time - _keys[_from].time) / span, 0.0f, 1.0f) : 0.0f;
+	}
+}
+
+// Quads rather than two triangles, the vertex array is built every frame and its size bounds the time it takes
+ParticleEmitter::ParticleEmitter() : vertices(sf::Quads)
+{
+	SetMaxParticles(maxParticles);
+}
+
+void ParticleEmitter::SetMaxParticles(const std::uint32_t _max_particles)
+{
+	maxParticles = _max_particles;
+	count = std::min(count, static_cast<std::size_t>(maxParticles));
+
+	positions.Resize(maxParticles);
+	velocities.Resize(maxParticles);
+	ages.resize(maxParticles);
+	ageRates.resize(maxParticles);
+	deadIndices.resize(maxParticles);
+	verticesDirty = true;
+}
+
+void ParticleEmitter::SetLifetime(const float _min, const float _max)
+{
+	minLifetime = std::min(_min, _max);
+	maxLifetime = std::max(_min, _max);
+}
+
+void ParticleEmitter::SetSpeed(const float _min, const float _max)
+{
+	minSpeed = std::min(_min, _max);
+	maxSpeed = std::max(_min, _max);
+}
+
+void ParticleEmitter::SetDirection(const float _direction, const float _spread)
+{
+	direction = _direction;
+	spread = std::abs(_spread);
+}
+
+void ParticleEmitter::SetSizeOverLife(const float _start, const float _end)
+{
+	const SizeKey keys[] = {{0.0f, _start}, {1.0f, _end}};
+	SetSizeOverLife(keys, 2);
+}
+
+void ParticleEmitter::SetSizeOverLife(const SizeKey* _keys, const std::size_t _count)
+{
+	sizeKeyCount = static_cast<std::uint32_t>(std::min(_count, MaxCurveKeys));
+	std::copy_n(_keys, sizeKeyCount, sizeKeys);
+	SortKeys();
+}
+
+void ParticleEmitter::SetColorOverLife(const sf::Color& _start, const sf::Color& _end)
+{
+	const ColorKey keys[] = {{0.0f, _start}, {1.0f, _end}};
+	SetColorOverLife(keys, 2);
+}
+
+void ParticleEmitter::SetColorOverLife(const ColorKey* _keys, const std::size_t _count)
+{
+	colorKeyCount = static_cast<std::uint32_t>(std::min(_count, MaxCurveKeys));
+	std::copy_n(_keys, colorKeyCount, colorKeys);
+	SortKeys();
+}
+
+void ParticleEmitter::Emit(const std::uint32_t _count)
+{
+	Spawn(_count);
+}
+
+void ParticleEmitter::Clear()
+{
+	count = 0;
+	verticesDirty = true;
+}
+
+const sf::VertexArray& ParticleEmitter::GetVertices()
+{
+	if (!verticesDirty)
+		return vertices;
+
+	if (curvesDirty)
+		BuildCurves();
+
+	vertices.resize(count * VerticesPerParticle);
+	verticesDirty = false;
+	if (count == 0)
+		return vertices;
+
+	const float* x = positions.GetSpan().x;
+	const float* y = positions.GetSpan().y;
+	sf::Vertex* vertex = &vertices[0];
+	for (std::size_t i = 0; i < count; i++, vertex += VerticesPerParticle)
+	{
+		const std::size_t step = std::min(static_cast<std::size_t>(ages[i] * static_cast<float>(CurveSteps - 1)), CurveSteps - 1);
+		const float half_size = halfSizes[step];
+		const sf::Color color = colors[step];
+
+		const float left = x[i] - half_size;
+		const float right = x[i] + half_size;
+		const float top = y[i] - half_size;
+		const float bottom = y[i] + half_size;
+
+		// Fields written one by one, the constructor of sf::Vertex is not inlined and clears the unused texture coordinates
+		vertex[0].position = sf::Vector2f(left, top);
+		vertex[1].position = sf::Vector2f(right, top);
+		vertex[2].position = sf::Vector2f(right, bottom);
+		vertex[3].position = sf::Vector2f(left, bottom);
+		for (std::size_t corner = 0; corner < VerticesPerParticle; corner++)
+			vertex[corner].color = color;
+	}
+	return vertices;
+}
+
+void ParticleEmitter::Update(const float _delta_time)
+{
+	ARendererComponent::Update(_delta_time);
+
+	const std::size_t dead = Maths::FloatBatch::AddScaledReaching(ages.data(), ageRates.data(), _delta_time, 1.0f, deadIndices.data(), count);
+
+	// From the highest index down, the last particle moved into a dead one is past every dead index left, so alive
+	for (std::size_t i = dead; i-- > 0;)
+		RemoveParticle(deadIndices[i]);
+
+	const Maths::Vector2Span particle_velocities = {velocities.GetSpan().x, velocities.GetSpan().y, count};
+	const Maths::Vector2Span particle_positions = {positions.GetSpan().x, positions.GetSpan().y, count};
+	Maths::Vector2Batch::Translate(particle_velocities, gravity * _delta_time, particle_velocities);
+	Maths::Vector2Batch::AddScaled(particle_positions, particle_velocities, _delta_time, particle_positions);
+
+	if (emitting)
+	{
+		emissionDebt += emissionRate * _delta_time;
+		const float emitted = std::floor(emissionDebt);
+		emissionDebt -= emitted;
+		Spawn(static_cast<std::uint32_t>(emitted));
+	}
+
+	verticesDirty = true;
+}
+
+void ParticleEmitter::Render(sf::RenderWindow* _window)
+{
+	ARendererComponent::Render(_window);
+
+	if (count > 0)
+		Draw(_window, GetVertices());
+}
+
+void ParticleEmitter::Serialize(Archive& _archive)
+{
+	ARendererComponent::Serialize(_archive);
+
+	std::uint32_t max_particles = maxParticles;
+
+	_archive.Field("emissionRate", emissionRate);
+	_archive.Field("emitting", emitting);
+	_archive.Field("maxParticles", max_particles);
+	_archive.Field("minLifetime", minLifetime);
+	_archive.Field("maxLifetime", maxLifetime);
+	_archive.Field("minSpeed", minSpeed);
+	_archive.Field("maxSpeed", maxSpeed);
+	_archive.Field("direction", direction);
+	_archive.Field("spread", spread);
+	_archive.Field("gravity", gravity);
+
+	if (_archive.GetVersion() >= 2)
+	{
+		// Every key is a field, the count tells the ones in use
+		_archive.Field("sizeKeyCount", sizeKeyCount);
+		for (std::size_t i = 0; i < MaxCurveKeys; i++)
+		{
+			_archive.Field(SizeKeyTimeNames[i], sizeKeys[i].time);
+			_archive.Field(SizeKeySizeNames[i], sizeKeys[i].size);
+		}
+		_archive.Field("colorKeyCount", colorKeyCount);
+		for (std::size_t i = 0; i < MaxCurveKeys; i++)
+		{
+			_archive.Field(ColorKeyTimeNames[i], colorKeys[i].time);
+			_archive.Field(ColorKeyColorNames[i], colorKeys[i].color);
+		}
+	}
+	else
+	{
+		// Version 1 had a start and an end value, the two keys of the curves
+		sizeKeyCount = 2;
+		sizeKeys[0].time = 0.0f;
+		sizeKeys[1].time = 1.0f;
+		_archive.Field("startSize", sizeKeys[0].size);
+		_archive.Field("endSize", sizeKeys[1].size);
+		colorKeyCount = 2;
+		colorKeys[0].time = 0.0f;
+		colorKeys[1].time = 1.0f;
+		_archive.Field("startColor", colorKeys[0].color);
+		_archive.Field("endColor", colorKeys[1].color);
+	}
+
+	// Edited in the inspector or loaded, the ranges and keys are sorted again
+	SetLifetime(minLifetime, maxLifetime);
+	SetSpeed(minSpeed, maxSpeed);
+	SortKeys();
+
+	if (max_particles != maxParticles)
+		SetMaxParticles(max_particles);
+}
+
+void ParticleEmitter::Spawn(std::uint32_t _count)
+{
+	_count = std::min(_count, static_cast<std::uint32_t>(maxParticles - count));
+	if (_count == 0)
+		return;
+
+	const GameObject* owner = GetOwner();
+	const Maths::Vector2f origin = owner->GetPosition();
+	const float base_angle = direction + owner->GetRotation();
+
+	std::uniform_real_distribution<float> area_x(-0.5f * size.x, 0.5f * size.x);
+	std::uniform_real_distribution<float> area_y(-0.5f * size.y, 0.5f * size.y);
+	std::uniform_real_distribution<float> angles(base_angle - spread, base_angle + spread);
+	std::uniform_real_distribution<float> speeds(minSpeed, maxSpeed);
+	std::uniform_real_distribution<float> lifetimes(minLifetime, maxLifetime);
+
+	for (std::uint32_t i = 0; i < _count; i++, count++)
+	{
+		const float angle = angles(random) * (std::numbers::pi_v<float> / 180.0f);
+		const float speed = speeds(random);
+
+		positions.Set(count, origin + Maths::Vector2f(area_x(random), area_y(random)));
+		velocities.Set(count, Maths::Vector2f(std::cos(angle) * speed, std::sin(angle) * speed));
+		ages[count] = 0.0f;
+		ageRates[count] = 1.0f / std::max(lifetimes(random), 0.001f);
+	}
+	verticesDirty = true;
+}
+
+void ParticleEmitter::SortKeys()
+{
+	sizeKeyCount = std::clamp(sizeKeyCount, 1u, static_cast<std::uint32_t>(MaxCurveKeys));
+	colorKeyCount = std::clamp(colorKeyCount, 1u, static_cast<std::uint32_t>(MaxCurveKeys));
+
+	// Stable, keys at the same time make a step in the curve
+	std::stable_sort(sizeKeys, sizeKeys + sizeKeyCount, [](const SizeKey& _lhs, const SizeKey& _rhs) { return _lhs.time < _rhs.time; });
+	std::stable_sort(colorKeys, colorKeys + colorKeyCount, [](const ColorKey& _lhs, const ColorKey& _rhs) { return _lhs.time < _rhs.time; });
+	curvesDirty = true;
+	verticesDirty = true;
+}
+
+void ParticleEmitter::BuildCurves()
+{
+	for (std::size_t step = 0; step < CurveSteps; step++)
+	{
+		const float time = static_cast<float>(step) / static_cast<float>(CurveSteps - 1);
+		std::size_t from = 0;
+		std::size_t to = 0;
+
+		float alpha = FindKeys(sizeKeys, sizeKeyCount, time, from, to);
+		halfSizes[step] = 0.5f * (sizeKeys[from].size + (sizeKeys[to].size - sizeKeys[from].size) * alpha);
+
+		alpha = FindKeys(colorKeys, colorKeyCount, time, from, to);
+		const sf::Color& start = colorKeys[from].color;
+		const sf::Color& end = colorKeys[to].color;
+		colors[step] = sf::Color(LerpChannel(start.r, end.r, alpha), LerpChannel(start.g, end.g, alpha),
+			LerpChannel(start.b, end.b, alpha), LerpChannel(start.a, end.a, alpha));
+	}
+	curvesDirty = false;
+}
+
+void ParticleEmitter::RemoveParticle(const std::size_t _index)
+{
+	const std::size_t last = --count;
+	positions.Set(_index, positions.Get(last));
+	velocities.Set(_index, velocities.Get(last));
+	ages[_index] = ages[last];
+	ageRates[_index] = ageRates[last];
+}
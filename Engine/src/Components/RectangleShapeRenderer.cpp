@@ -5,17 +5,7 @@
 #include <iostream>
 
 #include "SFML/Graphics/Shape.hpp"
-
-RectangleShapeRenderer::RectangleShapeRenderer()
-{
-	shape = new sf::RectangleShape();
-}
-
-RectangleShapeRenderer::~RectangleShapeRenderer()
-{
-	delete shape;
-	shape = nullptr;
-}
+#include "Serialization/Archive.h"
 
 void RectangleShapeRenderer::Render(sf::RenderWindow* _window)
 {
@@ -24,20 +14,27 @@ void RectangleShapeRenderer::Render(sf::RenderWindow* _window)
 	const GameObject* owner = GetOwner();
 
 	const Maths::Vector2<float> position = owner->GetPosition();
-	shape->setPosition(position.x, position.y);
-	shape->setSize(static_cast<sf::Vector2f>(owner->GetScale() * size));
-	shape->setRotation(owner->GetRotation());
-	shape->setFillColor(color);
+	shape.setPosition(position.x, position.y);
+	shape.setSize(static_cast<sf::Vector2f>(owner->GetScale() * size));
+	shape.setRotation(owner->GetRotation());
+	shape.setFillColor(color);
+
+	Draw(_window, shape);
+}
+
+void RectangleShapeRenderer::Serialize(Archive& _archive)
+{
+	ARendererComponent::Serialize(_archive);
 
-	_window->draw(*shape);
+	_archive.Field("color", color);
 }
 
 void RectangleShapeRenderer::OnDebug()
 {
 	/*ARendererComponent::OnDebug();
 
-	const sf::Vector2f min = shape->getPosition();
-	const sf::Vector2f max = min + shape->getSize();
+	const sf::Vector2f min = shape.getPosition();
+	const sf::Vector2f max = min + shape.getSize();
 	const ImU32 col = ImGui::GetColorU32(IM_COL32(255, 0, 0, 255));
 
 	ImGui::Begin("RectangleShapeRenderer");
@@ -0,0 +1,108 @@
+#include "Components/Rigidbody2D.h"
+
+#include "GameObject.h"
+#include "Scene.h"
+#include "Components/SquareCollider.h"
+#include "Serialization/Archive.h"
+
+void Rigidbody2D::SetSleepAllowed(const bool _allow_sleep)
+{
+	allowSleep = _allow_sleep;
+	if (!allowSleep)
+		WakeUp();
+}
+
+Maths::Vector2f Rigidbody2D::GetVelocity() const
+{
+	return world ? world->GetVelocity(bodyId) : velocity;
+}
+
+void Rigidbody2D::SetVelocity(const Maths::Vector2f& _velocity)
+{
+	velocity = _velocity;
+	if (world)
+		world->SetVelocity(bodyId, _velocity);
+}
+
+void Rigidbody2D::ApplyImpulse(const Maths::Vector2f& _impulse)
+{
+	SetVelocity(GetVelocity() + _impulse * GetInverseMass());
+}
+
+void Rigidbody2D::ApplyForce(const Maths::Vector2f& _force)
+{
+	if (world)
+		world->ApplyForce(bodyId, _force);
+}
+
+void Rigidbody2D::WakeUp()
+{
+	if (world)
+		world->WakeUp(bodyId);
+}
+
+bool Rigidbody2D::IsAwake() const
+{
+	return world && world->IsAwake(bodyId);
+}
+
+void Rigidbody2D::SetCollider(SquareCollider* _collider)
+{
+	if (world)
+		world->SetBodyCollider(bodyId, _collider);
+}
+
+void Rigidbody2D::OnAttach()
+{
+	Component::OnAttach();
+
+	Scene* scene = GetOwner()->GetScene();
+	if (!scene || world)
+		return;
+
+	world = &scene->GetPhysicsWorld();
+	bodyId = world->AddBody(this);
+	world->SetVelocity(bodyId, velocity);
+
+	// Otherwise the collider links itself once attached
+	SquareCollider* collider = GetOwner()->GetComponent<SquareCollider>();
+	if (collider && collider->GetColliderId() != InvalidCollider)
+		SetCollider(collider);
+}
+
+void Rigidbody2D::OnDetach()
+{
+	Component::OnDetach();
+
+	if (!world)
+		return;
+
+	velocity = world->GetVelocity(bodyId);
+	world->RemoveBody(bodyId);
+	world = nullptr;
+	bodyId = InvalidBody;
+}
+
+void Rigidbody2D::Serialize(Archive& _archive)
+{
+	Component::Serialize(_archive);
+
+	std::uint32_t body_type = static_cast<std::uint32_t>(bodyType);
+	Maths::Vector2f current_velocity = GetVelocity();
+
+	_archive.Field("bodyType", body_type);
+	_archive.Field("mass", mass);
+	_archive.Field("gravityScale", gravityScale);
+	_archive.Field("linearDamping", linearDamping);
+	_archive.Field("friction", friction);
+	_archive.Field("restitution", restitution);
+	_archive.Field("continuous", continuous);
+	_archive.Field("allowSleep", allowSleep);
+	_archive.Field("velocity", current_velocity);
+
+	bodyType = body_type == static_cast<std::uint32_t>(BodyType::Kinematic) ? BodyType::Kinematic : BodyType::Dynamic;
+
+	// Restored from a snapshot or edited in the inspector
+	if (current_velocity != GetVelocity())
+		SetVelocity(current_velocity);
+}
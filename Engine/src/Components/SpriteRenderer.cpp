@@ -1 +1,53 @@
 #include "Components/SpriteRenderer.h"
+
+#include <SFML/Graphics/RenderWindow.hpp>
+
+#include "GameObject.h"
+#include "Components/AnimatorComponent.h"
+
+SpriteRenderer::SpriteRenderer() = default;
+
+SpriteRenderer::~SpriteRenderer()
+{
+	// The sprite belongs to its texture
+	sprite = nullptr;
+}
+
+void SpriteRenderer::OnAttach()
+{
+	ARendererComponent::OnAttach();
+
+	if (AnimatorComponent* animator = GetOwner()->GetComponent<AnimatorComponent>())
+		animator->SetRenderer(this);
+}
+
+void SpriteRenderer::OnDetach()
+{
+	ARendererComponent::OnDetach();
+
+	if (AnimatorComponent* animator = GetOwner()->GetComponent<AnimatorComponent>())
+		animator->SetRenderer(nullptr);
+}
+
+void SpriteRenderer::Render(sf::RenderWindow* _window)
+{
+	ARendererComponent::Render(_window);
+
+	if (sprite == nullptr)
+		return;
+
+	const GameObject* owner = GetOwner();
+	const Maths::Vector2<float> position = owner->GetPosition();
+	const Maths::Vector2<float> scale = owner->GetScale();
+	const sf::IntRect rect = sprite->getTextureRect();
+
+	// A null size keeps the size of the sprite in the texture
+	const float size_x = size.x != 0.0f && rect.width != 0 ? size.x / static_cast<float>(rect.width) : 1.0f;
+	const float size_y = size.y != 0.0f && rect.height != 0 ? size.y / static_cast<float>(rect.height) : 1.0f;
+
+	sprite->setPosition(position.x, position.y);
+	sprite->setRotation(owner->GetRotation());
+	sprite->setScale(scale.x * size_x, scale.y * size_y);
+
+	Draw(_window, *sprite);
+}
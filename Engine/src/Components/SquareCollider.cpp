@@ -1,11 +1,126 @@
 #include "Components/SquareCollider.h"
 
+#include <algorithm>
+
 #include "GameObject.h"
-#include "Maths/Vector2.h"
+#include "Scene.h"
+#include "Components/Rigidbody2D.h"
+#include "Serialization/Archive.h"
+
+void SquareCollider::SetStatic(const bool _is_static)
+{
+	isStatic = _is_static;
+
+	if (world)
+		world->SetStatic(colliderId, isStatic);
+}
+
+void SquareCollider::Refresh()
+{
+	if (!world)
+		return;
+
+	world->RefreshCollider(colliderId);
+
+	// Bodies sleeping on it at its old or new place would float or stay inside
+	GetOwner()->GetScene()->GetPhysicsWorld().WakeUpArea(world->GetBounds(colliderId).Union(GetBounds()));
+}
+
+void SquareCollider::SetLayer(const std::uint32_t _layer)
+{
+	layer = std::min(_layer, CollisionLayerCount - 1);
+	RefreshFilter();
+}
+
+void SquareCollider::SetMask(const std::uint32_t _mask)
+{
+	mask = _mask;
+	RefreshFilter();
+}
+
+void SquareCollider::SetTrigger(const bool _is_trigger)
+{
+	isTrigger = _is_trigger;
+	RefreshFilter();
+}
+
+void SquareCollider::OnAttach()
+{
+	Component::OnAttach();
+
+	Scene* scene = GetOwner()->GetScene();
+	if (!scene || world)
+		return;
+
+	world = &scene->GetCollisionWorld();
+	colliderId = world->AddCollider(this, isStatic);
+
+	if (Rigidbody2D* rigidbody = GetOwner()->GetComponent<Rigidbody2D>())
+		rigidbody->SetCollider(this);
+}
+
+void SquareCollider::OnDetach()
+{
+	Component::OnDetach();
+
+	if (!world)
+		return;
+
+	if (Rigidbody2D* rigidbody = GetOwner()->GetComponent<Rigidbody2D>())
+		rigidbody->SetCollider(nullptr);
+
+	GetOwner()->GetScene()->GetPhysicsWorld().WakeUpArea(world->GetBounds(colliderId));
+	world->RemoveCollider(colliderId);
+	world = nullptr;
+	colliderId = InvalidCollider;
+}
+
+void SquareCollider::Serialize(Archive& _archive)
+{
+	Component::Serialize(_archive);
+
+	const float previous_width = width;
+	const float previous_height = height;
+	const bool previous_static = isStatic;
+	const std::uint32_t previous_layer = layer;
+	const std::uint32_t previous_mask = mask;
+	const bool previous_trigger = isTrigger;
+
+	_archive.Field("width", width);
+	_archive.Field("height", height);
+
+	if (_archive.GetVersion() >= 2)
+		_archive.Field("static", isStatic);
+
+	if (_archive.GetVersion() >= 3)
+	{
+		_archive.Field("layer", layer);
+		_archive.Field("mask", mask);
+		_archive.Field("trigger", isTrigger);
+		layer = std::min(layer, CollisionLayerCount - 1);
+	}
+
+	// Edited in the inspector or restored from a snapshot while in a scene
+	if (isStatic != previous_static)
+		SetStatic(isStatic);
+	if (width != previous_width || height != previous_height)
+		Refresh();
+	if (layer != previous_layer || mask != previous_mask || isTrigger != previous_trigger)
+		RefreshFilter();
+}
+
+Maths::Rectf SquareCollider::GetBounds() const
+{
+	return Maths::Rectf::FromPositionSize(GetOwner()->GetPosition(), Maths::Vector2f(width, height));
+}
+
+void SquareCollider::RefreshFilter()
+{
+	if (world)
+		world->RefreshFilter(colliderId);
+}
 
 bool SquareCollider::IsColliding(const SquareCollider& _collider_a, const SquareCollider& _collider_b)
 {
-	const Maths::Vector2f position_a = _collider_a.GetOwner()->GetPosition();
-	const Maths::Vector2f position_b = _collider_b.GetOwner()->GetPosition();
-	return position_a.x < position_b.x + _collider_b.GetWidth() && position_a.x + _collider_a.GetWidth() > position_b.x && position_a.y < position_b.y + _collider_b.GetHeight() && position_a.y + _collider_a.GetHeight() > position_b.y;
+	return _collider_a.GetBounds().Overlaps(_collider_b.GetBounds());
 }
@@ -1,5 +1,7 @@
 #include "Engine.h"
 
+#include <chrono>
+
 Engine* Engine::instance = nullptr;
 
 Engine* Engine::GetInstance()
@@ -12,24 +14,41 @@ Engine* Engine::GetInstance()
 
 void Engine::Init() const
 {
-	moduleManager->CreateDefaultModules();
+	moduleManager->CreateDefaultModules(headless);
 	moduleManager->Awake();
 }
 
-void Engine::Run() const
+void Engine::Run()
 {
+	using Clock = std::chrono::steady_clock;
+
 	moduleManager->Start();
 	moduleManager->OnEnable();
 
 	while (!shouldQuit)
 	{
+		const Clock::time_point update_start = Clock::now();
+
 		moduleManager->Update();
+
+		const Clock::time_point update_end = Clock::now();
+		phaseTimes[static_cast<std::size_t>(FramePhase::Update)] = std::chrono::duration<float>(update_end - update_start).count();
+
+		if (headless)
+			continue;
+
 		moduleManager->PreRender();
 		moduleManager->Render();
 		moduleManager->OnGUI();
 		moduleManager->OnDebug();
 		moduleManager->PostRender();
+
+		const Clock::time_point render_end = Clock::now();
+
 		moduleManager->Present();
+
+		phaseTimes[static_cast<std::size_t>(FramePhase::Render)] = std::chrono::duration<float>(render_end - update_end).count();
+		phaseTimes[static_cast<std::size_t>(FramePhase::Present)] = std::chrono::duration<float>(Clock::now() - render_end).count();
 	}
 
 	moduleManager->OnDisable();
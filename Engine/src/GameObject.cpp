@@ -1,13 +1,51 @@
 #include "GameObject.h"
 
+#include <cmath>
+#include <numbers>
+
+#include "Scene.h"
+
 GameObject::~GameObject()
 {
+	// All detached first, components look up their siblings when detached
+	for (Component* const& component : components)
+		component->OnDetach();
+
+	// Pooled components are destroyed with their pool by the scene
 	for (Component*& component : components)
-		delete component;
+	{
+		if (!component->IsPooled())
+			delete component;
+	}
 
 	components.clear();
 }
 
+void GameObject::SetName(const std::string& _name)
+{
+	name = _name;
+	if (scene)
+		scene->OnGameObjectRenamed();
+}
+
+const Maths::Transform2D& GameObject::GetTransform() const
+{
+	if (!transformDirty)
+		return transform;
+
+	if (rotation != transformRotation)
+	{
+		const float radians = rotation * (std::numbers::pi_v<float> / 180.0f);
+		rotationCos = std::cos(radians);
+		rotationSin = std::sin(radians);
+		transformRotation = rotation;
+	}
+
+	transform = Maths::Transform2D::FromPositionRotationScale(position, rotationCos, rotationSin, scale);
+	transformDirty = false;
+	return transform;
+}
+
 std::vector<Component*>& GameObject::GetComponents()
 {
 	return components;
@@ -17,11 +55,17 @@ void GameObject::AddComponent(Component* _component)
 {
 	_component->SetOwner(this);
 	components.push_back(_component);
+	_component->OnAttach();
 }
 
 void GameObject::RemoveComponent(Component* _component)
 {
-	components.erase(std::remove(components.begin(), components.end(), _component), components.end());
+	const std::vector<Component*>::iterator it = std::remove(components.begin(), components.end(), _component);
+	if (it == components.end())
+		return;
+
+	components.erase(it, components.end());
+	_component->OnDetach();
 }
 
 #pragma region Events
@@ -138,4 +182,12 @@ void GameObject::Render(sf::RenderWindow* _window) const
 	}
 }
 
+void GameObject::OnCollision(SquareCollider& _collider, SquareCollider& _other) const
+{
+	for (Component* const& component : components)
+	{
+		component->OnCollision(_collider, _other);
+	}
+}
+
 #pragma endregion
@@ -0,0 +1,266 @@
+#include "Input/ActionMap.h"
+
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <iterator>
+#include <sstream>
+
+namespace
+{
+	/// Names of sf::Keyboard::Key, in the order of the enumeration.
+	constexpr const char* KeyNames[] = {
+		"A", "B", "C", "D", "E", "F", "G", "H", "I", "J", "K", "L", "M",
+		"N", "O", "P", "Q", "R", "S", "T", "U", "V", "W", "X", "Y", "Z",
+		"Num0", "Num1", "Num2", "Num3", "Num4", "Num5", "Num6", "Num7", "Num8", "Num9",
+		"Escape", "LControl", "LShift", "LAlt", "LSystem", "RControl", "RShift", "RAlt", "RSystem", "Menu",
+		"LBracket", "RBracket", "Semicolon", "Comma", "Period", "Apostrophe", "Slash", "Backslash", "Grave", "Equal", "Hyphen",
+		"Space", "Enter", "Backspace", "Tab", "PageUp", "PageDown", "End", "Home", "Insert", "Delete",
+		"Add", "Subtract", "Multiply", "Divide", "Left", "Right", "Up", "Down",
+		"Numpad0", "Numpad1", "Numpad2", "Numpad3", "Numpad4", "Numpad5", "Numpad6", "Numpad7", "Numpad8", "Numpad9",
+		"F1", "F2", "F3", "F4", "F5", "F6", "F7", "F8", "F9", "F10", "F11", "F12", "F13", "F14", "F15",
+		"Pause"
+	};
+
+	constexpr const char* MouseButtonNames[] = {"Left", "Right", "Middle", "XButton1", "XButton2"};
+
+	constexpr const char* JoystickAxisNames[] = {"X", "Y", "Z", "R", "U", "V", "PovX", "PovY"};
+
+	static_assert(std::size(KeyNames) == sf::Keyboard::Key::KeyCount, "KeyNames must list every sf::Keyboard::Key");
+	static_assert(std::size(MouseButtonNames) == sf::Mouse::Button::ButtonCount, "MouseButtonNames must list every sf::Mouse::Button");
+	static_assert(std::size(JoystickAxisNames) == sf::Joystick::AxisCount, "JoystickAxisNames must list every sf::Joystick::Axis");
+
+	constexpr const char* SourceNames[] = {"Key", "MouseButton", "JoystickAxis", "JoystickButton"};
+
+	constexpr const char* TypeNames[] = {"button", "axis", "axis2d"};
+
+	template<std::size_t N>
+	int FindName(const char* const (&_names)[N], const std::string& _name)
+	{
+		for (std::size_t i = 0; i < N; i++)
+		{
+			if (_name == _names[i])
+				return static_cast<int>(i);
+		}
+		return -1;
+	}
+
+	/**
+	 * \brief Checks that the code of a binding exists for its source.
+	 * \param _binding The binding.
+	 * \return True if the binding can be evaluated.
+	 */
+	bool IsValid(const ActionMap::Binding& _binding)
+	{
+		switch (_binding.source)
+		{
+		case ActionMap::BindingSource::Key: return _binding.code >= 0 && _binding.code < sf::Keyboard::Key::KeyCount;
+		case ActionMap::BindingSource::MouseButton: return _binding.code >= 0 && _binding.code < sf::Mouse::Button::ButtonCount;
+		case ActionMap::BindingSource::JoystickAxis: return _binding.code >= 0 && _binding.code < sf::Joystick::AxisCount;
+		case ActionMap::BindingSource::JoystickButton: return _binding.code >= 0 && _binding.code < static_cast<int>(sf::Joystick::ButtonCount);
+		}
+		return false;
+	}
+}
+
+ActionId ActionMap::AddAction(const std::string& _name, const ActionType _type)
+{
+	const ActionId existing = FindAction(_name);
+	if (existing != InvalidAction)
+		return existing;
+
+	actions.push_back({_name, _type, {}});
+	dirty = true;
+	return static_cast<ActionId>(actions.size() - 1);
+}
+
+ActionId ActionMap::FindAction(const std::string& _name) const
+{
+	for (std::size_t i = 0; i < actions.size(); i++)
+	{
+		if (actions[i].name == _name)
+			return static_cast<ActionId>(i);
+	}
+
+	return InvalidAction;
+}
+
+void ActionMap::AddBinding(const ActionId _action, const Binding& _binding)
+{
+	actions[_action].bindings.push_back(_binding);
+	dirty = true;
+}
+
+void ActionMap::ClearBindings(const ActionId _action)
+{
+	actions[_action].bindings.clear();
+	dirty = true;
+}
+
+bool ActionMap::LoadFromFile(const std::filesystem::path& _path)
+{
+	std::ifstream file(_path);
+	if (!file)
+		return false;
+
+	std::string line;
+	while (std::getline(file, line))
+	{
+		std::istringstream tokens(line);
+
+		std::string name;
+		std::string type_name;
+		if (!(tokens >> name >> type_name) || name[0] == '#')
+			continue;
+
+		const int type = FindName(TypeNames, type_name);
+		if (type < 0)
+			continue;
+
+		const ActionId action = AddAction(name, static_cast<ActionType>(type));
+		ClearBindings(action);
+
+		std::string binding_text;
+		while (tokens >> binding_text)
+		{
+			Binding binding;
+			if (ParseBinding(binding_text, binding))
+				AddBinding(action, binding);
+		}
+	}
+
+	return true;
+}
+
+bool ActionMap::SaveToFile(const std::filesystem::path& _path) const
+{
+	std::ofstream file(_path, std::ios::trunc);
+
+	for (const Action& action : actions)
+	{
+		file << action.name << ' ' << TypeNames[static_cast<int>(action.type)];
+		for (const Binding& binding : action.bindings)
+			file << ' ' << FormatBinding(binding);
+		file << '\n';
+	}
+
+	return static_cast<bool>(file);
+}
+
+void ActionMap::Evaluate(const std::bitset<sf::Keyboard::Key::KeyCount>& _keys, const std::bitset<sf::Mouse::Button::ButtonCount>& _mouse_buttons, const JoystickState& _joystick)
+{
+	if (dirty)
+		Compile();
+
+	std::fill(values.begin(), values.end(), Maths::Vector2f::Zero);
+
+	for (const CompiledBinding& binding : compiledBindings)
+	{
+		float input = 0.0f;
+		switch (binding.source)
+		{
+		case BindingSource::Key: input = _keys[binding.code] ? 1.0f : 0.0f; break;
+		case BindingSource::MouseButton: input = _mouse_buttons[binding.code] ? 1.0f : 0.0f; break;
+		case BindingSource::JoystickAxis: input = _joystick.axes[binding.code]; break;
+		case BindingSource::JoystickButton: input = _joystick.buttons[binding.code] ? 1.0f : 0.0f; break;
+		}
+
+		Maths::Vector2f& value = values[binding.action];
+		(binding.component == 0 ? value.x : value.y) += input * binding.scale;
+	}
+
+	for (std::size_t i = 0; i < values.size(); i++)
+	{
+		Maths::Vector2f& value = values[i];
+		value.x = std::clamp(value.x, -1.0f, 1.0f);
+		value.y = std::clamp(value.y, -1.0f, 1.0f);
+
+		const bool pressed = std::max(std::abs(value.x), std::abs(value.y)) >= PressThreshold;
+		states[i] = static_cast<std::uint8_t>((states[i] & Pressed ? PreviouslyPressed : 0) | (pressed ? Pressed : 0));
+	}
+}
+
+std::string ActionMap::FormatBinding(const Binding& _binding)
+{
+	std::string text = SourceNames[static_cast<int>(_binding.source)];
+	text += ':';
+
+	switch (_binding.source)
+	{
+	case BindingSource::Key: text += KeyNames[_binding.code]; break;
+	case BindingSource::MouseButton: text += MouseButtonNames[_binding.code]; break;
+	case BindingSource::JoystickAxis: text += JoystickAxisNames[_binding.code]; break;
+	case BindingSource::JoystickButton: text += std::to_string(_binding.code); break;
+	}
+
+	text += ':';
+	if (_binding.scale < 0.0f)
+		text += '-';
+	text += _binding.component == 0 ? 'x' : 'y';
+
+	return text;
+}
+
+bool ActionMap::ParseBinding(const std::string& _text, Binding& _binding)
+{
+	const std::size_t source_end = _text.find(':');
+	if (source_end == std::string::npos)
+		return false;
+
+	const std::size_t input_end = _text.find(':', source_end + 1);
+	const std::string source_name = _text.substr(0, source_end);
+	const std::string input_name = _text.substr(source_end + 1, input_end == std::string::npos ? std::string::npos : input_end - source_end - 1);
+	const std::string target = input_end == std::string::npos ? std::string() : _text.substr(input_end + 1);
+
+	const int source = FindName(SourceNames, source_name);
+	if (source < 0)
+		return false;
+
+	Binding binding;
+	binding.source = static_cast<BindingSource>(source);
+
+	switch (binding.source)
+	{
+	case BindingSource::Key: binding.code = FindName(KeyNames, input_name); break;
+	case BindingSource::MouseButton: binding.code = FindName(MouseButtonNames, input_name); break;
+	case BindingSource::JoystickAxis: binding.code = FindName(JoystickAxisNames, input_name); break;
+	case BindingSource::JoystickButton: binding.code = input_name.empty() || input_name.find_first_not_of("0123456789") != std::string::npos || input_name.size() > 2 ? -1 : std::stoi(input_name); break;
+	}
+
+	if (target == "-x" || target == "-y" || target == "-")
+		binding.scale = -1.0f;
+	else if (!target.empty() && target != "x" && target != "y" && target != "+x" && target != "+y" && target != "+")
+		return false;
+
+	binding.component = target.find('y') != std::string::npos ? 1 : 0;
+
+	if (!IsValid(binding))
+		return false;
+
+	_binding = binding;
+	return true;
+}
+
+void ActionMap::Compile()
+{
+	compiledBindings.clear();
+
+	for (std::size_t i = 0; i < actions.size(); i++)
+	{
+		const Action& action = actions[i];
+		for (const Binding& binding : action.bindings)
+		{
+			// Checked once here, the evaluation indexes the input state without checks
+			if (!IsValid(binding))
+				continue;
+
+			// Only Axis2D actions have a y axis
+			const std::uint8_t component = action.type == ActionType::Axis2D ? binding.component : 0;
+			compiledBindings.push_back({static_cast<ActionId>(i), binding.source, component, binding.code, binding.scale});
+		}
+	}
+
+	values.resize(actions.size(), Maths::Vector2f::Zero);
+	states.resize(actions.size(), 0);
+	dirty = false;
+}
@@ -0,0 +1,240 @@
+#include "Input/InputRecording.h"
+
+#include <algorithm>
+#include <cstring>
+#include <iterator>
+
+namespace
+{
+	/// Keys are numbered first, mouse buttons follow them.
+	constexpr std::size_t ButtonOffset = sf::Keyboard::Key::KeyCount;
+
+	static_assert(ButtonOffset + sf::Mouse::Button::ButtonCount <= 256, "Key and button indices must fit in a byte");
+	static_assert(sf::Joystick::ButtonCount <= 32, "Joystick buttons must fit in 32 bits");
+
+	/**
+	 * \struct JoystickRecord
+	 * \brief A joystick slot whose state changed, as written in recordings.
+	 */
+	struct JoystickRecord
+	{
+		std::uint8_t joystick = 0;
+		std::uint8_t connected = 0;
+		std::uint32_t buttons = 0;
+		float axes[sf::Joystick::AxisCount] = {};
+	};
+}
+
+bool InputRecording::OpenForWriting(const std::filesystem::path& _path)
+{
+	Close();
+
+	file.open(_path, std::ios::binary | std::ios::trunc);
+	if (!file)
+		return false;
+
+	const Header header;
+	file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+	return static_cast<bool>(file);
+}
+
+bool InputRecording::OpenForReading(const std::filesystem::path& _path)
+{
+	Close();
+
+	std::ifstream input(_path, std::ios::binary | std::ios::ate);
+	if (!input)
+		return false;
+
+	data.resize(static_cast<std::size_t>(input.tellg()));
+	input.seekg(0);
+
+	const Header expected;
+	Header header;
+	if (!input.read(reinterpret_cast<char*>(data.data()), static_cast<std::streamsize>(data.size())) || !Read(&header, sizeof(header))
+		|| header.magic != expected.magic || header.version != expected.version || header.keyCount != expected.keyCount
+		|| header.buttonCount != expected.buttonCount || header.eventSize != expected.eventSize)
+	{
+		Close();
+		return false;
+	}
+
+	return true;
+}
+
+void InputRecording::Close()
+{
+	if (file.is_open())
+		file.close();
+
+	data.clear();
+	data.shrink_to_fit();
+	position = 0;
+	previous = InputFrame();
+	frameCount = 0;
+}
+
+void InputRecording::WriteFrame(const InputFrame& _frame)
+{
+	std::uint8_t changed[ButtonOffset + sf::Mouse::Button::ButtonCount];
+	std::uint8_t changed_count = 0;
+
+	for (std::size_t i = 0; i < _frame.keys.size(); i++)
+	{
+		if (_frame.keys[i] != previous.keys[i])
+			changed[changed_count++] = static_cast<std::uint8_t>(i);
+	}
+
+	for (std::size_t i = 0; i < _frame.mouseButtons.size(); i++)
+	{
+		if (_frame.mouseButtons[i] != previous.mouseButtons[i])
+			changed[changed_count++] = static_cast<std::uint8_t>(ButtonOffset + i);
+	}
+
+	std::vector<sf::Event> events;
+	for (const sf::Event& event : _frame.events)
+	{
+		if (event.type != sf::Event::MouseMoved)
+			events.push_back(event);
+	}
+	events.resize(std::min<std::size_t>(events.size(), UINT16_MAX));
+
+	JoystickRecord joysticks[sf::Joystick::Count];
+	std::uint8_t joystick_count = 0;
+	for (unsigned int i = 0; i < sf::Joystick::Count; i++)
+	{
+		const JoystickState& state = _frame.joysticks[i];
+		if (state == previous.joysticks[i])
+			continue;
+
+		JoystickRecord& record = joysticks[joystick_count++];
+		record.joystick = static_cast<std::uint8_t>(i);
+		record.connected = state.connected ? 1 : 0;
+		record.buttons = static_cast<std::uint32_t>(state.buttons.to_ulong());
+		std::copy(state.axes.begin(), state.axes.end(), record.axes);
+	}
+
+	std::uint8_t flags = 0;
+	if (_frame.mousePosition != previous.mousePosition)
+		flags |= MouseMoved;
+	if (changed_count > 0)
+		flags |= ButtonsChanged;
+	if (!events.empty())
+		flags |= HasEvents;
+	if (joystick_count > 0)
+		flags |= JoysticksChanged;
+
+	file.write(reinterpret_cast<const char*>(&_frame.deltaTime), sizeof(_frame.deltaTime));
+	file.write(reinterpret_cast<const char*>(&flags), sizeof(flags));
+
+	if (flags & MouseMoved)
+	{
+		const std::int32_t position[2] = {_frame.mousePosition.x, _frame.mousePosition.y};
+		file.write(reinterpret_cast<const char*>(position), sizeof(position));
+	}
+
+	if (flags & ButtonsChanged)
+	{
+		file.write(reinterpret_cast<const char*>(&changed_count), sizeof(changed_count));
+		file.write(reinterpret_cast<const char*>(changed), changed_count);
+	}
+
+	if (flags & HasEvents)
+	{
+		const std::uint16_t event_count = static_cast<std::uint16_t>(events.size());
+		file.write(reinterpret_cast<const char*>(&event_count), sizeof(event_count));
+		file.write(reinterpret_cast<const char*>(events.data()), static_cast<std::streamsize>(events.size() * sizeof(sf::Event)));
+	}
+
+	if (flags & JoysticksChanged)
+	{
+		file.write(reinterpret_cast<const char*>(&joystick_count), sizeof(joystick_count));
+		file.write(reinterpret_cast<const char*>(joysticks), static_cast<std::streamsize>(joystick_count * sizeof(JoystickRecord)));
+	}
+
+	previous.mousePosition = _frame.mousePosition;
+	previous.keys = _frame.keys;
+	previous.mouseButtons = _frame.mouseButtons;
+	previous.joysticks = _frame.joysticks;
+	++frameCount;
+}
+
+bool InputRecording::ReadFrame(InputFrame& _frame)
+{
+	std::uint8_t flags = 0;
+	if (!Read(&_frame.deltaTime, sizeof(_frame.deltaTime)) || !Read(&flags, sizeof(flags)))
+		return false;
+
+	if (flags & MouseMoved)
+	{
+		std::int32_t mouse_position[2];
+		if (!Read(mouse_position, sizeof(mouse_position)))
+			return false;
+
+		previous.mousePosition = Maths::Vector2i(mouse_position[0], mouse_position[1]);
+	}
+
+	if (flags & ButtonsChanged)
+	{
+		std::uint8_t changed_count = 0;
+		std::uint8_t changed[256];
+		if (!Read(&changed_count, sizeof(changed_count)) || !Read(changed, changed_count))
+			return false;
+
+		for (std::uint8_t i = 0; i < changed_count; i++)
+		{
+			if (changed[i] < ButtonOffset)
+				previous.keys.flip(changed[i]);
+			else if (changed[i] - ButtonOffset < previous.mouseButtons.size())
+				previous.mouseButtons.flip(changed[i] - ButtonOffset);
+		}
+	}
+
+	_frame.events.clear();
+	if (flags & HasEvents)
+	{
+		std::uint16_t event_count = 0;
+		if (!Read(&event_count, sizeof(event_count)))
+			return false;
+
+		_frame.events.resize(event_count);
+		if (!Read(_frame.events.data(), event_count * sizeof(sf::Event)))
+			return false;
+	}
+
+	if (flags & JoysticksChanged)
+	{
+		std::uint8_t joystick_count = 0;
+		if (!Read(&joystick_count, sizeof(joystick_count)))
+			return false;
+
+		for (std::uint8_t i = 0; i < joystick_count; i++)
+		{
+			JoystickRecord record;
+			if (!Read(&record, sizeof(record)) || record.joystick >= sf::Joystick::Count)
+				return false;
+
+			JoystickState& state = previous.joysticks[record.joystick];
+			state.connected = record.connected != 0;
+			state.buttons = decltype(state.buttons)(record.buttons);
+			std::copy(std::begin(record.axes), std::end(record.axes), state.axes.begin());
+		}
+	}
+
+	_frame.mousePosition = previous.mousePosition;
+	_frame.keys = previous.keys;
+	_frame.mouseButtons = previous.mouseButtons;
+	_frame.joysticks = previous.joysticks;
+	++frameCount;
+	return true;
+}
+
+bool InputRecording::Read(void* _data, const std::size_t _size)
+{
+	if (_size > data.size() - position)
+		return false;
+
+	std::memcpy(_data, data.data() + position, _size);
+	position += _size;
+	return true;
+}
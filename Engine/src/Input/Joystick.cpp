@@ -0,0 +1,36 @@
+#include "Input/Joystick.h"
+
+#include <algorithm>
+#include <cmath>
+
+void SfmlJoystickSource::Poll(JoystickStates& _states)
+{
+	if (updateDevices)
+		sf::Joystick::update();
+
+	for (unsigned int joystick = 0; joystick < sf::Joystick::Count; joystick++)
+	{
+		JoystickState& state = _states[joystick];
+		state = JoystickState();
+
+		if (!sf::Joystick::isConnected(joystick))
+			continue;
+
+		state.connected = true;
+
+		const unsigned int button_count = std::min(sf::Joystick::getButtonCount(joystick), static_cast<unsigned int>(sf::Joystick::ButtonCount));
+		for (unsigned int button = 0; button < button_count; button++)
+			state.buttons[button] = sf::Joystick::isButtonPressed(joystick, button);
+
+		for (int axis = 0; axis < sf::Joystick::AxisCount; axis++)
+		{
+			if (!sf::Joystick::hasAxis(joystick, static_cast<sf::Joystick::Axis>(axis)))
+				continue;
+
+			const float position = sf::Joystick::getAxisPosition(joystick, static_cast<sf::Joystick::Axis>(axis)) / 100.0f;
+			const float magnitude = std::abs(position);
+			if (magnitude >= DeadZone)
+				state.axes[axis] = std::copysign(std::min((magnitude - DeadZone) / (1.0f - DeadZone), 1.0f), position);
+		}
+	}
+}
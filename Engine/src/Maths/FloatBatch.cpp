@@ -0,0 +1,11 @@
+#include "Maths/FloatBatch.h"
+
+#include "Maths/Vector2BatchKernels.h"
+
+namespace Maths::FloatBatch
+{
+	std::size_t AddScaledReaching(float* _values, const float* _rates, const float _scale, const float _limit, std::uint32_t* _out_indices, const std::size_t _count)
+	{
+		return Vector2Batch::GetActiveKernels().addScaledReaching(_values, _rates, _scale, _limit, 0, _out_indices, _count);
+	}
+}
@@ -0,0 +1,58 @@
+#include "Maths/RectBatch.h"
+
+#include <cmath>
+#include <limits>
+
+#include "Maths/Vector2BatchKernels.h"
+
+namespace Maths
+{
+	void RectArray::Resize(const std::size_t _size)
+	{
+		minX.resize(_size);
+		minY.resize(_size);
+		maxX.resize(_size);
+		maxY.resize(_size);
+	}
+
+	void RectArray::Clear()
+	{
+		minX.clear();
+		minY.clear();
+		maxX.clear();
+		maxY.clear();
+	}
+
+	void RectArray::Add(const Rectf& _rect)
+	{
+		minX.push_back(_rect.min.x);
+		minY.push_back(_rect.min.y);
+		maxX.push_back(_rect.max.x);
+		maxY.push_back(_rect.max.y);
+	}
+
+	void RectArray::Set(const std::size_t _index, const Rectf& _rect)
+	{
+		minX[_index] = _rect.min.x;
+		minY[_index] = _rect.min.y;
+		maxX[_index] = _rect.max.x;
+		maxY[_index] = _rect.max.y;
+	}
+
+	namespace RectBatch
+	{
+		std::size_t Overlapping(const Rectf& _query, const ConstRectSpan _rects, std::uint32_t* _out_indices)
+		{
+			const float query[4] = {_query.min.x, _query.min.y, _query.max.x, _query.max.y};
+			return Vector2Batch::GetActiveKernels().overlapping(_rects.minX, _rects.minY, _rects.maxX, _rects.maxY, query, 0, _out_indices, _rects.size);
+		}
+
+		std::size_t Containing(const Vector2f& _point, const ConstRectSpan _rects, std::uint32_t* _out_indices)
+		{
+			// min <= point is min < the next float after point, so containing is overlapping this thin rectangle
+			const float infinity = std::numeric_limits<float>::infinity();
+			const float query[4] = {_point.x, _point.y, std::nextafter(_point.x, infinity), std::nextafter(_point.y, infinity)};
+			return Vector2Batch::GetActiveKernels().overlapping(_rects.minX, _rects.minY, _rects.maxX, _rects.maxY, query, 0, _out_indices, _rects.size);
+		}
+	}
+}
@@ -0,0 +1,16 @@
+#include "Maths/Transform2D.h"
+
+#include <cmath>
+
+namespace Maths
+{
+	Transform2D Transform2D::Rotation(const float _angle)
+	{
+		return Rotation(std::cos(_angle), std::sin(_angle));
+	}
+
+	void Transform2D::TransformPoints(const ConstVector2Span _points, const Vector2Span _out) const
+	{
+		Vector2Batch::Transform(_points, *this, _out);
+	}
+}
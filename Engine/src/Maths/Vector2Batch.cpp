@@ -0,0 +1,305 @@
+#include "Maths/Vector2Batch.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include "Maths/Transform2D.h"
+#include "Maths/Vector2BatchKernels.h"
+
+#if defined(VECTOR2_BATCH_X86) && defined(_MSC_VER)
+#include <intrin.h>
+#include <immintrin.h>
+#endif
+
+namespace Maths::Vector2Batch
+{
+	namespace
+	{
+		// Same expressions as Vector2f, the SIMD kernels are checked against these
+
+		void AddScalar(const float* _ax, const float* _ay, const float* _bx, const float* _by, float* _out_x, float* _out_y, const std::size_t _count)
+		{
+			for (std::size_t i = 0; i < _count; i++)
+			{
+				_out_x[i] = _ax[i] + _bx[i];
+				_out_y[i] = _ay[i] + _by[i];
+			}
+		}
+
+		void AddScaledScalar(const float* _ax, const float* _ay, const float* _bx, const float* _by, const float _scale, float* _out_x, float* _out_y, const std::size_t _count)
+		{
+			for (std::size_t i = 0; i < _count; i++)
+			{
+				_out_x[i] = _ax[i] + _bx[i] * _scale;
+				_out_y[i] = _ay[i] + _by[i] * _scale;
+			}
+		}
+
+		void TranslateScalar(const float* _ax, const float* _ay, const float _offset_x, const float _offset_y, float* _out_x, float* _out_y, const std::size_t _count)
+		{
+			for (std::size_t i = 0; i < _count; i++)
+			{
+				_out_x[i] = _ax[i] + _offset_x;
+				_out_y[i] = _ay[i] + _offset_y;
+			}
+		}
+
+		void ScaleScalar(const float* _ax, const float* _ay, const float _scale, float* _out_x, float* _out_y, const std::size_t _count)
+		{
+			for (std::size_t i = 0; i < _count; i++)
+			{
+				_out_x[i] = _ax[i] * _scale;
+				_out_y[i] = _ay[i] * _scale;
+			}
+		}
+
+		void LerpScalar(const float* _ax, const float* _ay, const float* _bx, const float* _by, const float _alpha, float* _out_x, float* _out_y, const std::size_t _count)
+		{
+			const float inverse_alpha = 1 - _alpha;
+			for (std::size_t i = 0; i < _count; i++)
+			{
+				_out_x[i] = _ax[i] * inverse_alpha + _bx[i] * _alpha;
+				_out_y[i] = _ay[i] * inverse_alpha + _by[i] * _alpha;
+			}
+		}
+
+		void NormalizeScalar(const float* _ax, const float* _ay, float* _out_x, float* _out_y, const std::size_t _count)
+		{
+			for (std::size_t i = 0; i < _count; i++)
+			{
+				const float x = _ax[i];
+				const float y = _ay[i];
+				const float magnitude = std::sqrt(x * x + y * y);
+				_out_x[i] = magnitude != 0 ? x / magnitude : 0.0f;
+				_out_y[i] = magnitude != 0 ? y / magnitude : 0.0f;
+			}
+		}
+
+		void RotateScalar(const float* _ax, const float* _ay, const float _cos, const float _sin, float* _out_x, float* _out_y, const std::size_t _count)
+		{
+			for (std::size_t i = 0; i < _count; i++)
+			{
+				const float x = _ax[i];
+				const float y = _ay[i];
+				_out_x[i] = x * _cos - y * _sin;
+				_out_y[i] = x * _sin + y * _cos;
+			}
+		}
+
+		void LengthScalar(const float* _ax, const float* _ay, float* _out, const std::size_t _count)
+		{
+			for (std::size_t i = 0; i < _count; i++)
+				_out[i] = std::sqrt(_ax[i] * _ax[i] + _ay[i] * _ay[i]);
+		}
+
+		void DistanceScalar(const float* _ax, const float* _ay, const float* _bx, const float* _by, float* _out, const std::size_t _count)
+		{
+			for (std::size_t i = 0; i < _count; i++)
+			{
+				const float dx = _ax[i] - _bx[i];
+				const float dy = _ay[i] - _by[i];
+				_out[i] = std::sqrt(dx * dx + dy * dy);
+			}
+		}
+
+		void TransformScalar(const float* _ax, const float* _ay, const float* _matrix, float* _out_x, float* _out_y, const std::size_t _count)
+		{
+			for (std::size_t i = 0; i < _count; i++)
+			{
+				const float x = _ax[i];
+				const float y = _ay[i];
+				_out_x[i] = _matrix[0] * x + _matrix[2] * y + _matrix[4];
+				_out_y[i] = _matrix[1] * x + _matrix[3] * y + _matrix[5];
+			}
+		}
+
+		std::size_t OverlappingScalar(const float* _min_x, const float* _min_y, const float* _max_x, const float* _max_y, const float* _query, const std::uint32_t _first_index, std::uint32_t* _out, const std::size_t _count)
+		{
+			std::size_t found = 0;
+			for (std::size_t i = 0; i < _count; i++)
+			{
+				// Always written, kept by counting it, no branch to mispredict on random layouts
+				_out[found] = _first_index + static_cast<std::uint32_t>(i);
+				found += (_min_x[i] < _query[2]) & (_max_x[i] > _query[0]) & (_min_y[i] < _query[3]) & (_max_y[i] > _query[1]);
+			}
+			return found;
+		}
+
+		std::size_t AddScaledReachingScalar(float* _values, const float* _rates, const float _scale, const float _limit, const std::uint32_t _first_index, std::uint32_t* _out, const std::size_t _count)
+		{
+			std::size_t found = 0;
+			for (std::size_t i = 0; i < _count; i++)
+			{
+				_values[i] = _values[i] + _rates[i] * _scale;
+				_out[found] = _first_index + static_cast<std::uint32_t>(i);
+				found += _values[i] >= _limit;
+			}
+			return found;
+		}
+
+		SimdLevel DetectSimdLevel()
+		{
+#if defined(VECTOR2_BATCH_X86) && defined(_MSC_VER)
+			int registers[4] = {};
+			__cpuid(registers, 0);
+			const int max_leaf = registers[0];
+
+			__cpuid(registers, 1);
+			const bool sse2 = (registers[3] & (1 << 26)) != 0;
+			const bool osxsave = (registers[2] & (1 << 27)) != 0;
+			const bool avx = (registers[2] & (1 << 28)) != 0;
+
+			bool avx2 = false;
+			// The OS must save the AVX registers on context switches, checked through XCR0
+			if (max_leaf >= 7 && osxsave && avx && (_xgetbv(0) & 0x6) == 0x6)
+			{
+				__cpuidex(registers, 7, 0);
+				avx2 = (registers[1] & (1 << 5)) != 0;
+			}
+
+			return avx2 ? SimdLevel::Avx2 : sse2 ? SimdLevel::Sse2 : SimdLevel::Scalar;
+#elif defined(VECTOR2_BATCH_X86) && defined(__GNUC__)
+			__builtin_cpu_init();
+			return __builtin_cpu_supports("avx2") ? SimdLevel::Avx2 : __builtin_cpu_supports("sse2") ? SimdLevel::Sse2 : SimdLevel::Scalar;
+#else
+			return SimdLevel::Scalar;
+#endif
+		}
+
+		const Kernels& GetKernels(const SimdLevel _level)
+		{
+#ifdef VECTOR2_BATCH_X86
+			switch (_level)
+			{
+			case SimdLevel::Sse2: return Sse2Kernels;
+			case SimdLevel::Avx2: return Avx2Kernels;
+			default: break;
+			}
+#endif
+			return ScalarKernels;
+		}
+
+		struct Dispatch
+		{
+			SimdLevel supported = DetectSimdLevel();
+			SimdLevel level = supported;
+			const Kernels* kernels = &GetKernels(level);
+		};
+
+		Dispatch& GetDispatch()
+		{
+			static Dispatch dispatch;
+			return dispatch;
+		}
+
+		std::size_t Count(const ConstVector2Span& _lhs, const Vector2Span& _out)
+		{
+			return std::min(_lhs.size, _out.size);
+		}
+
+		std::size_t Count(const ConstVector2Span& _lhs, const ConstVector2Span& _rhs, const Vector2Span& _out)
+		{
+			return std::min({_lhs.size, _rhs.size, _out.size});
+		}
+	}
+
+	const Kernels ScalarKernels = {
+		AddScalar,
+		AddScaledScalar,
+		TranslateScalar,
+		ScaleScalar,
+		LerpScalar,
+		NormalizeScalar,
+		RotateScalar,
+		LengthScalar,
+		DistanceScalar,
+		TransformScalar,
+		OverlappingScalar,
+		AddScaledReachingScalar
+	};
+
+	const Kernels& GetActiveKernels()
+	{
+		return *GetDispatch().kernels;
+	}
+
+	SimdLevel GetSupportedSimdLevel()
+	{
+		return GetDispatch().supported;
+	}
+
+	SimdLevel GetSimdLevel()
+	{
+		return GetDispatch().level;
+	}
+
+	void SetSimdLevel(const SimdLevel _level)
+	{
+		Dispatch& dispatch = GetDispatch();
+		dispatch.level = std::min(_level, dispatch.supported);
+		dispatch.kernels = &GetKernels(dispatch.level);
+	}
+
+	const char* GetSimdLevelName(const SimdLevel _level)
+	{
+		switch (_level)
+		{
+		case SimdLevel::Scalar: return "scalar";
+		case SimdLevel::Sse2: return "sse2";
+		case SimdLevel::Avx2: return "avx2";
+		}
+		return "unknown";
+	}
+
+	void Add(const ConstVector2Span _lhs, const ConstVector2Span _rhs, const Vector2Span _out)
+	{
+		GetDispatch().kernels->add(_lhs.x, _lhs.y, _rhs.x, _rhs.y, _out.x, _out.y, Count(_lhs, _rhs, _out));
+	}
+
+	void AddScaled(const ConstVector2Span _lhs, const ConstVector2Span _rhs, const float _scale, const Vector2Span _out)
+	{
+		GetDispatch().kernels->addScaled(_lhs.x, _lhs.y, _rhs.x, _rhs.y, _scale, _out.x, _out.y, Count(_lhs, _rhs, _out));
+	}
+
+	void Translate(const ConstVector2Span _vectors, const Vector2f& _offset, const Vector2Span _out)
+	{
+		GetDispatch().kernels->translate(_vectors.x, _vectors.y, _offset.x, _offset.y, _out.x, _out.y, Count(_vectors, _out));
+	}
+
+	void Scale(const ConstVector2Span _vectors, const float _scale, const Vector2Span _out)
+	{
+		GetDispatch().kernels->scale(_vectors.x, _vectors.y, _scale, _out.x, _out.y, Count(_vectors, _out));
+	}
+
+	void Lerp(const ConstVector2Span _lhs, const ConstVector2Span _rhs, const float _alpha, const Vector2Span _out)
+	{
+		GetDispatch().kernels->lerp(_lhs.x, _lhs.y, _rhs.x, _rhs.y, _alpha, _out.x, _out.y, Count(_lhs, _rhs, _out));
+	}
+
+	void Normalize(const ConstVector2Span _vectors, const Vector2Span _out)
+	{
+		GetDispatch().kernels->normalize(_vectors.x, _vectors.y, _out.x, _out.y, Count(_vectors, _out));
+	}
+
+	void Rotate(const ConstVector2Span _vectors, const float _angle, const Vector2Span _out)
+	{
+		// Once for the whole batch, Vector2f::Rotate computes them for every vector
+		GetDispatch().kernels->rotate(_vectors.x, _vectors.y, std::cos(_angle), std::sin(_angle), _out.x, _out.y, Count(_vectors, _out));
+	}
+
+	void Length(const ConstVector2Span _vectors, float* _out)
+	{
+		GetDispatch().kernels->length(_vectors.x, _vectors.y, _out, _vectors.size);
+	}
+
+	void Distance(const ConstVector2Span _lhs, const ConstVector2Span _rhs, float* _out)
+	{
+		GetDispatch().kernels->distance(_lhs.x, _lhs.y, _rhs.x, _rhs.y, _out, std::min(_lhs.size, _rhs.size));
+	}
+
+	void Transform(const ConstVector2Span _points, const Transform2D& _transform, const Vector2Span _out)
+	{
+		const float matrix[6] = {_transform.a, _transform.b, _transform.c, _transform.d, _transform.tx, _transform.ty};
+		GetDispatch().kernels->transform(_points.x, _points.y, matrix, _out.x, _out.y, Count(_points, _out));
+	}
+}
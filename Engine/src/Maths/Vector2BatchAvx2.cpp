@@ -0,0 +1,225 @@
+#include "Maths/Vector2BatchKernels.h"
+
+#ifdef VECTOR2_BATCH_X86
+
+#include <immintrin.h>
+
+// GCC and Clang only emit AVX instructions in functions allowed to, MSVC always does
+#ifdef __GNUC__
+#define VECTOR2_BATCH_AVX2 __attribute__((target("avx2")))
+#else
+#define VECTOR2_BATCH_AVX2
+#endif
+
+namespace Maths::Vector2Batch
+{
+	namespace
+	{
+		// Unaligned loads and stores, spans point anywhere in the caller arrays
+		constexpr std::size_t Width = 8;
+
+		VECTOR2_BATCH_AVX2 void AddAvx2(const float* _ax, const float* _ay, const float* _bx, const float* _by, float* _out_x, float* _out_y, const std::size_t _count)
+		{
+			std::size_t i = 0;
+			for (; i + Width <= _count; i += Width)
+			{
+				_mm256_storeu_ps(_out_x + i, _mm256_add_ps(_mm256_loadu_ps(_ax + i), _mm256_loadu_ps(_bx + i)));
+				_mm256_storeu_ps(_out_y + i, _mm256_add_ps(_mm256_loadu_ps(_ay + i), _mm256_loadu_ps(_by + i)));
+			}
+			ScalarKernels.add(_ax + i, _ay + i, _bx + i, _by + i, _out_x + i, _out_y + i, _count - i);
+		}
+
+		VECTOR2_BATCH_AVX2 void AddScaledAvx2(const float* _ax, const float* _ay, const float* _bx, const float* _by, const float _scale, float* _out_x, float* _out_y, const std::size_t _count)
+		{
+			const __m256 scale = _mm256_set1_ps(_scale);
+			std::size_t i = 0;
+			for (; i + Width <= _count; i += Width)
+			{
+				_mm256_storeu_ps(_out_x + i, _mm256_add_ps(_mm256_loadu_ps(_ax + i), _mm256_mul_ps(_mm256_loadu_ps(_bx + i), scale)));
+				_mm256_storeu_ps(_out_y + i, _mm256_add_ps(_mm256_loadu_ps(_ay + i), _mm256_mul_ps(_mm256_loadu_ps(_by + i), scale)));
+			}
+			ScalarKernels.addScaled(_ax + i, _ay + i, _bx + i, _by + i, _scale, _out_x + i, _out_y + i, _count - i);
+		}
+
+		VECTOR2_BATCH_AVX2 void TranslateAvx2(const float* _ax, const float* _ay, const float _offset_x, const float _offset_y, float* _out_x, float* _out_y, const std::size_t _count)
+		{
+			const __m256 offset_x = _mm256_set1_ps(_offset_x);
+			const __m256 offset_y = _mm256_set1_ps(_offset_y);
+			std::size_t i = 0;
+			for (; i + Width <= _count; i += Width)
+			{
+				_mm256_storeu_ps(_out_x + i, _mm256_add_ps(_mm256_loadu_ps(_ax + i), offset_x));
+				_mm256_storeu_ps(_out_y + i, _mm256_add_ps(_mm256_loadu_ps(_ay + i), offset_y));
+			}
+			ScalarKernels.translate(_ax + i, _ay + i, _offset_x, _offset_y, _out_x + i, _out_y + i, _count - i);
+		}
+
+		VECTOR2_BATCH_AVX2 void ScaleAvx2(const float* _ax, const float* _ay, const float _scale, float* _out_x, float* _out_y, const std::size_t _count)
+		{
+			const __m256 scale = _mm256_set1_ps(_scale);
+			std::size_t i = 0;
+			for (; i + Width <= _count; i += Width)
+			{
+				_mm256_storeu_ps(_out_x + i, _mm256_mul_ps(_mm256_loadu_ps(_ax + i), scale));
+				_mm256_storeu_ps(_out_y + i, _mm256_mul_ps(_mm256_loadu_ps(_ay + i), scale));
+			}
+			ScalarKernels.scale(_ax + i, _ay + i, _scale, _out_x + i, _out_y + i, _count - i);
+		}
+
+		VECTOR2_BATCH_AVX2 void LerpAvx2(const float* _ax, const float* _ay, const float* _bx, const float* _by, const float _alpha, float* _out_x, float* _out_y, const std::size_t _count)
+		{
+			const __m256 alpha = _mm256_set1_ps(_alpha);
+			const __m256 inverse_alpha = _mm256_set1_ps(1 - _alpha);
+			std::size_t i = 0;
+			for (; i + Width <= _count; i += Width)
+			{
+				_mm256_storeu_ps(_out_x + i, _mm256_add_ps(_mm256_mul_ps(_mm256_loadu_ps(_ax + i), inverse_alpha), _mm256_mul_ps(_mm256_loadu_ps(_bx + i), alpha)));
+				_mm256_storeu_ps(_out_y + i, _mm256_add_ps(_mm256_mul_ps(_mm256_loadu_ps(_ay + i), inverse_alpha), _mm256_mul_ps(_mm256_loadu_ps(_by + i), alpha)));
+			}
+			ScalarKernels.lerp(_ax + i, _ay + i, _bx + i, _by + i, _alpha, _out_x + i, _out_y + i, _count - i);
+		}
+
+		VECTOR2_BATCH_AVX2 void NormalizeAvx2(const float* _ax, const float* _ay, float* _out_x, float* _out_y, const std::size_t _count)
+		{
+			const __m256 zero = _mm256_setzero_ps();
+			std::size_t i = 0;
+			for (; i + Width <= _count; i += Width)
+			{
+				const __m256 x = _mm256_loadu_ps(_ax + i);
+				const __m256 y = _mm256_loadu_ps(_ay + i);
+				// Exact square root and division, the approximations would differ from Vector2f
+				const __m256 magnitude = _mm256_sqrt_ps(_mm256_add_ps(_mm256_mul_ps(x, x), _mm256_mul_ps(y, y)));
+				// Zero vectors divide 0 by 0, the NaN is masked out
+				const __m256 non_zero = _mm256_cmp_ps(magnitude, zero, _CMP_NEQ_UQ);
+				_mm256_storeu_ps(_out_x + i, _mm256_and_ps(non_zero, _mm256_div_ps(x, magnitude)));
+				_mm256_storeu_ps(_out_y + i, _mm256_and_ps(non_zero, _mm256_div_ps(y, magnitude)));
+			}
+			ScalarKernels.normalize(_ax + i, _ay + i, _out_x + i, _out_y + i, _count - i);
+		}
+
+		VECTOR2_BATCH_AVX2 void RotateAvx2(const float* _ax, const float* _ay, const float _cos, const float _sin, float* _out_x, float* _out_y, const std::size_t _count)
+		{
+			const __m256 cos = _mm256_set1_ps(_cos);
+			const __m256 sin = _mm256_set1_ps(_sin);
+			std::size_t i = 0;
+			for (; i + Width <= _count; i += Width)
+			{
+				const __m256 x = _mm256_loadu_ps(_ax + i);
+				const __m256 y = _mm256_loadu_ps(_ay + i);
+				_mm256_storeu_ps(_out_x + i, _mm256_sub_ps(_mm256_mul_ps(x, cos), _mm256_mul_ps(y, sin)));
+				_mm256_storeu_ps(_out_y + i, _mm256_add_ps(_mm256_mul_ps(x, sin), _mm256_mul_ps(y, cos)));
+			}
+			ScalarKernels.rotate(_ax + i, _ay + i, _cos, _sin, _out_x + i, _out_y + i, _count - i);
+		}
+
+		VECTOR2_BATCH_AVX2 void LengthAvx2(const float* _ax, const float* _ay, float* _out, const std::size_t _count)
+		{
+			std::size_t i = 0;
+			for (; i + Width <= _count; i += Width)
+			{
+				const __m256 x = _mm256_loadu_ps(_ax + i);
+				const __m256 y = _mm256_loadu_ps(_ay + i);
+				_mm256_storeu_ps(_out + i, _mm256_sqrt_ps(_mm256_add_ps(_mm256_mul_ps(x, x), _mm256_mul_ps(y, y))));
+			}
+			ScalarKernels.length(_ax + i, _ay + i, _out + i, _count - i);
+		}
+
+		VECTOR2_BATCH_AVX2 void DistanceAvx2(const float* _ax, const float* _ay, const float* _bx, const float* _by, float* _out, const std::size_t _count)
+		{
+			std::size_t i = 0;
+			for (; i + Width <= _count; i += Width)
+			{
+				const __m256 dx = _mm256_sub_ps(_mm256_loadu_ps(_ax + i), _mm256_loadu_ps(_bx + i));
+				const __m256 dy = _mm256_sub_ps(_mm256_loadu_ps(_ay + i), _mm256_loadu_ps(_by + i));
+				_mm256_storeu_ps(_out + i, _mm256_sqrt_ps(_mm256_add_ps(_mm256_mul_ps(dx, dx), _mm256_mul_ps(dy, dy))));
+			}
+			ScalarKernels.distance(_ax + i, _ay + i, _bx + i, _by + i, _out + i, _count - i);
+		}
+		VECTOR2_BATCH_AVX2 void TransformAvx2(const float* _ax, const float* _ay, const float* _matrix, float* _out_x, float* _out_y, const std::size_t _count)
+		{
+			const __m256 a = _mm256_set1_ps(_matrix[0]);
+			const __m256 b = _mm256_set1_ps(_matrix[1]);
+			const __m256 c = _mm256_set1_ps(_matrix[2]);
+			const __m256 d = _mm256_set1_ps(_matrix[3]);
+			const __m256 tx = _mm256_set1_ps(_matrix[4]);
+			const __m256 ty = _mm256_set1_ps(_matrix[5]);
+			std::size_t i = 0;
+			for (; i + Width <= _count; i += Width)
+			{
+				const __m256 x = _mm256_loadu_ps(_ax + i);
+				const __m256 y = _mm256_loadu_ps(_ay + i);
+				_mm256_storeu_ps(_out_x + i, _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(a, x), _mm256_mul_ps(c, y)), tx));
+				_mm256_storeu_ps(_out_y + i, _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(b, x), _mm256_mul_ps(d, y)), ty));
+			}
+			ScalarKernels.transform(_ax + i, _ay + i, _matrix, _out_x + i, _out_y + i, _count - i);
+		}
+		VECTOR2_BATCH_AVX2 std::size_t OverlappingAvx2(const float* _min_x, const float* _min_y, const float* _max_x, const float* _max_y, const float* _query, const std::uint32_t _first_index, std::uint32_t* _out, const std::size_t _count)
+		{
+			const __m256 query_min_x = _mm256_set1_ps(_query[0]);
+			const __m256 query_min_y = _mm256_set1_ps(_query[1]);
+			const __m256 query_max_x = _mm256_set1_ps(_query[2]);
+			const __m256 query_max_y = _mm256_set1_ps(_query[3]);
+			std::size_t found = 0;
+			std::size_t i = 0;
+			for (; i + Width <= _count; i += Width)
+			{
+				const __m256 overlap_x = _mm256_and_ps(_mm256_cmp_ps(_mm256_loadu_ps(_min_x + i), query_max_x, _CMP_LT_OQ), _mm256_cmp_ps(_mm256_loadu_ps(_max_x + i), query_min_x, _CMP_GT_OQ));
+				const __m256 overlap_y = _mm256_and_ps(_mm256_cmp_ps(_mm256_loadu_ps(_min_y + i), query_max_y, _CMP_LT_OQ), _mm256_cmp_ps(_mm256_loadu_ps(_max_y + i), query_min_y, _CMP_GT_OQ));
+				const int mask = _mm256_movemask_ps(_mm256_and_ps(overlap_x, overlap_y));
+
+				// Queries usually match few rectangles, most groups are skipped here
+				if (mask == 0)
+					continue;
+
+				for (std::size_t lane = 0; lane < Width; lane++)
+				{
+					_out[found] = _first_index + static_cast<std::uint32_t>(i + lane);
+					found += (mask >> lane) & 1;
+				}
+			}
+			return found + ScalarKernels.overlapping(_min_x + i, _min_y + i, _max_x + i, _max_y + i, _query, _first_index + static_cast<std::uint32_t>(i), _out + found, _count - i);
+		}
+
+		VECTOR2_BATCH_AVX2 std::size_t AddScaledReachingAvx2(float* _values, const float* _rates, const float _scale, const float _limit, const std::uint32_t _first_index, std::uint32_t* _out, const std::size_t _count)
+		{
+			const __m256 scale = _mm256_set1_ps(_scale);
+			const __m256 limit = _mm256_set1_ps(_limit);
+			std::size_t found = 0;
+			std::size_t i = 0;
+			for (; i + Width <= _count; i += Width)
+			{
+				const __m256 values = _mm256_add_ps(_mm256_loadu_ps(_values + i), _mm256_mul_ps(_mm256_loadu_ps(_rates + i), scale));
+				_mm256_storeu_ps(_values + i, values);
+				const int mask = _mm256_movemask_ps(_mm256_cmp_ps(values, limit, _CMP_GE_OQ));
+
+				// Few values reach the limit at once, most groups are skipped here
+				if (mask == 0)
+					continue;
+
+				for (std::size_t lane = 0; lane < Width; lane++)
+				{
+					_out[found] = _first_index + static_cast<std::uint32_t>(i + lane);
+					found += (mask >> lane) & 1;
+				}
+			}
+			return found + ScalarKernels.addScaledReaching(_values + i, _rates + i, _scale, _limit, _first_index + static_cast<std::uint32_t>(i), _out + found, _count - i);
+		}
+	}
+
+	const Kernels Avx2Kernels = {
+		AddAvx2,
+		AddScaledAvx2,
+		TranslateAvx2,
+		ScaleAvx2,
+		LerpAvx2,
+		NormalizeAvx2,
+		RotateAvx2,
+		LengthAvx2,
+		DistanceAvx2,
+		TransformAvx2,
+		OverlappingAvx2,
+		AddScaledReachingAvx2
+	};
+}
+
+#endif
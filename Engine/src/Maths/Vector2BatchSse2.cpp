@@ -0,0 +1,218 @@
+#include "Maths/Vector2BatchKernels.h"
+
+#ifdef VECTOR2_BATCH_X86
+
+#include <emmintrin.h>
+
+namespace Maths::Vector2Batch
+{
+	namespace
+	{
+		// Unaligned loads and stores, spans point anywhere in the caller arrays
+		constexpr std::size_t Width = 4;
+
+		void AddSse2(const float* _ax, const float* _ay, const float* _bx, const float* _by, float* _out_x, float* _out_y, const std::size_t _count)
+		{
+			std::size_t i = 0;
+			for (; i + Width <= _count; i += Width)
+			{
+				_mm_storeu_ps(_out_x + i, _mm_add_ps(_mm_loadu_ps(_ax + i), _mm_loadu_ps(_bx + i)));
+				_mm_storeu_ps(_out_y + i, _mm_add_ps(_mm_loadu_ps(_ay + i), _mm_loadu_ps(_by + i)));
+			}
+			ScalarKernels.add(_ax + i, _ay + i, _bx + i, _by + i, _out_x + i, _out_y + i, _count - i);
+		}
+
+		void AddScaledSse2(const float* _ax, const float* _ay, const float* _bx, const float* _by, const float _scale, float* _out_x, float* _out_y, const std::size_t _count)
+		{
+			const __m128 scale = _mm_set1_ps(_scale);
+			std::size_t i = 0;
+			for (; i + Width <= _count; i += Width)
+			{
+				_mm_storeu_ps(_out_x + i, _mm_add_ps(_mm_loadu_ps(_ax + i), _mm_mul_ps(_mm_loadu_ps(_bx + i), scale)));
+				_mm_storeu_ps(_out_y + i, _mm_add_ps(_mm_loadu_ps(_ay + i), _mm_mul_ps(_mm_loadu_ps(_by + i), scale)));
+			}
+			ScalarKernels.addScaled(_ax + i, _ay + i, _bx + i, _by + i, _scale, _out_x + i, _out_y + i, _count - i);
+		}
+
+		void TranslateSse2(const float* _ax, const float* _ay, const float _offset_x, const float _offset_y, float* _out_x, float* _out_y, const std::size_t _count)
+		{
+			const __m128 offset_x = _mm_set1_ps(_offset_x);
+			const __m128 offset_y = _mm_set1_ps(_offset_y);
+			std::size_t i = 0;
+			for (; i + Width <= _count; i += Width)
+			{
+				_mm_storeu_ps(_out_x + i, _mm_add_ps(_mm_loadu_ps(_ax + i), offset_x));
+				_mm_storeu_ps(_out_y + i, _mm_add_ps(_mm_loadu_ps(_ay + i), offset_y));
+			}
+			ScalarKernels.translate(_ax + i, _ay + i, _offset_x, _offset_y, _out_x + i, _out_y + i, _count - i);
+		}
+
+		void ScaleSse2(const float* _ax, const float* _ay, const float _scale, float* _out_x, float* _out_y, const std::size_t _count)
+		{
+			const __m128 scale = _mm_set1_ps(_scale);
+			std::size_t i = 0;
+			for (; i + Width <= _count; i += Width)
+			{
+				_mm_storeu_ps(_out_x + i, _mm_mul_ps(_mm_loadu_ps(_ax + i), scale));
+				_mm_storeu_ps(_out_y + i, _mm_mul_ps(_mm_loadu_ps(_ay + i), scale));
+			}
+			ScalarKernels.scale(_ax + i, _ay + i, _scale, _out_x + i, _out_y + i, _count - i);
+		}
+
+		void LerpSse2(const float* _ax, const float* _ay, const float* _bx, const float* _by, const float _alpha, float* _out_x, float* _out_y, const std::size_t _count)
+		{
+			const __m128 alpha = _mm_set1_ps(_alpha);
+			const __m128 inverse_alpha = _mm_set1_ps(1 - _alpha);
+			std::size_t i = 0;
+			for (; i + Width <= _count; i += Width)
+			{
+				_mm_storeu_ps(_out_x + i, _mm_add_ps(_mm_mul_ps(_mm_loadu_ps(_ax + i), inverse_alpha), _mm_mul_ps(_mm_loadu_ps(_bx + i), alpha)));
+				_mm_storeu_ps(_out_y + i, _mm_add_ps(_mm_mul_ps(_mm_loadu_ps(_ay + i), inverse_alpha), _mm_mul_ps(_mm_loadu_ps(_by + i), alpha)));
+			}
+			ScalarKernels.lerp(_ax + i, _ay + i, _bx + i, _by + i, _alpha, _out_x + i, _out_y + i, _count - i);
+		}
+
+		void NormalizeSse2(const float* _ax, const float* _ay, float* _out_x, float* _out_y, const std::size_t _count)
+		{
+			const __m128 zero = _mm_setzero_ps();
+			std::size_t i = 0;
+			for (; i + Width <= _count; i += Width)
+			{
+				const __m128 x = _mm_loadu_ps(_ax + i);
+				const __m128 y = _mm_loadu_ps(_ay + i);
+				// Exact square root and division, the approximations would differ from Vector2f
+				const __m128 magnitude = _mm_sqrt_ps(_mm_add_ps(_mm_mul_ps(x, x), _mm_mul_ps(y, y)));
+				// Zero vectors divide 0 by 0, the NaN is masked out
+				const __m128 non_zero = _mm_cmpneq_ps(magnitude, zero);
+				_mm_storeu_ps(_out_x + i, _mm_and_ps(non_zero, _mm_div_ps(x, magnitude)));
+				_mm_storeu_ps(_out_y + i, _mm_and_ps(non_zero, _mm_div_ps(y, magnitude)));
+			}
+			ScalarKernels.normalize(_ax + i, _ay + i, _out_x + i, _out_y + i, _count - i);
+		}
+
+		void RotateSse2(const float* _ax, const float* _ay, const float _cos, const float _sin, float* _out_x, float* _out_y, const std::size_t _count)
+		{
+			const __m128 cos = _mm_set1_ps(_cos);
+			const __m128 sin = _mm_set1_ps(_sin);
+			std::size_t i = 0;
+			for (; i + Width <= _count; i += Width)
+			{
+				const __m128 x = _mm_loadu_ps(_ax + i);
+				const __m128 y = _mm_loadu_ps(_ay + i);
+				_mm_storeu_ps(_out_x + i, _mm_sub_ps(_mm_mul_ps(x, cos), _mm_mul_ps(y, sin)));
+				_mm_storeu_ps(_out_y + i, _mm_add_ps(_mm_mul_ps(x, sin), _mm_mul_ps(y, cos)));
+			}
+			ScalarKernels.rotate(_ax + i, _ay + i, _cos, _sin, _out_x + i, _out_y + i, _count - i);
+		}
+
+		void LengthSse2(const float* _ax, const float* _ay, float* _out, const std::size_t _count)
+		{
+			std::size_t i = 0;
+			for (; i + Width <= _count; i += Width)
+			{
+				const __m128 x = _mm_loadu_ps(_ax + i);
+				const __m128 y = _mm_loadu_ps(_ay + i);
+				_mm_storeu_ps(_out + i, _mm_sqrt_ps(_mm_add_ps(_mm_mul_ps(x, x), _mm_mul_ps(y, y))));
+			}
+			ScalarKernels.length(_ax + i, _ay + i, _out + i, _count - i);
+		}
+
+		void DistanceSse2(const float* _ax, const float* _ay, const float* _bx, const float* _by, float* _out, const std::size_t _count)
+		{
+			std::size_t i = 0;
+			for (; i + Width <= _count; i += Width)
+			{
+				const __m128 dx = _mm_sub_ps(_mm_loadu_ps(_ax + i), _mm_loadu_ps(_bx + i));
+				const __m128 dy = _mm_sub_ps(_mm_loadu_ps(_ay + i), _mm_loadu_ps(_by + i));
+				_mm_storeu_ps(_out + i, _mm_sqrt_ps(_mm_add_ps(_mm_mul_ps(dx, dx), _mm_mul_ps(dy, dy))));
+			}
+			ScalarKernels.distance(_ax + i, _ay + i, _bx + i, _by + i, _out + i, _count - i);
+		}
+		void TransformSse2(const float* _ax, const float* _ay, const float* _matrix, float* _out_x, float* _out_y, const std::size_t _count)
+		{
+			const __m128 a = _mm_set1_ps(_matrix[0]);
+			const __m128 b = _mm_set1_ps(_matrix[1]);
+			const __m128 c = _mm_set1_ps(_matrix[2]);
+			const __m128 d = _mm_set1_ps(_matrix[3]);
+			const __m128 tx = _mm_set1_ps(_matrix[4]);
+			const __m128 ty = _mm_set1_ps(_matrix[5]);
+			std::size_t i = 0;
+			for (; i + Width <= _count; i += Width)
+			{
+				const __m128 x = _mm_loadu_ps(_ax + i);
+				const __m128 y = _mm_loadu_ps(_ay + i);
+				_mm_storeu_ps(_out_x + i, _mm_add_ps(_mm_add_ps(_mm_mul_ps(a, x), _mm_mul_ps(c, y)), tx));
+				_mm_storeu_ps(_out_y + i, _mm_add_ps(_mm_add_ps(_mm_mul_ps(b, x), _mm_mul_ps(d, y)), ty));
+			}
+			ScalarKernels.transform(_ax + i, _ay + i, _matrix, _out_x + i, _out_y + i, _count - i);
+		}
+		std::size_t OverlappingSse2(const float* _min_x, const float* _min_y, const float* _max_x, const float* _max_y, const float* _query, const std::uint32_t _first_index, std::uint32_t* _out, const std::size_t _count)
+		{
+			const __m128 query_min_x = _mm_set1_ps(_query[0]);
+			const __m128 query_min_y = _mm_set1_ps(_query[1]);
+			const __m128 query_max_x = _mm_set1_ps(_query[2]);
+			const __m128 query_max_y = _mm_set1_ps(_query[3]);
+			std::size_t found = 0;
+			std::size_t i = 0;
+			for (; i + Width <= _count; i += Width)
+			{
+				const __m128 overlap_x = _mm_and_ps(_mm_cmplt_ps(_mm_loadu_ps(_min_x + i), query_max_x), _mm_cmpgt_ps(_mm_loadu_ps(_max_x + i), query_min_x));
+				const __m128 overlap_y = _mm_and_ps(_mm_cmplt_ps(_mm_loadu_ps(_min_y + i), query_max_y), _mm_cmpgt_ps(_mm_loadu_ps(_max_y + i), query_min_y));
+				const int mask = _mm_movemask_ps(_mm_and_ps(overlap_x, overlap_y));
+
+				// Queries usually match few rectangles, most groups are skipped here
+				if (mask == 0)
+					continue;
+
+				for (std::size_t lane = 0; lane < Width; lane++)
+				{
+					_out[found] = _first_index + static_cast<std::uint32_t>(i + lane);
+					found += (mask >> lane) & 1;
+				}
+			}
+			return found + ScalarKernels.overlapping(_min_x + i, _min_y + i, _max_x + i, _max_y + i, _query, _first_index + static_cast<std::uint32_t>(i), _out + found, _count - i);
+		}
+
+		std::size_t AddScaledReachingSse2(float* _values, const float* _rates, const float _scale, const float _limit, const std::uint32_t _first_index, std::uint32_t* _out, const std::size_t _count)
+		{
+			const __m128 scale = _mm_set1_ps(_scale);
+			const __m128 limit = _mm_set1_ps(_limit);
+			std::size_t found = 0;
+			std::size_t i = 0;
+			for (; i + Width <= _count; i += Width)
+			{
+				const __m128 values = _mm_add_ps(_mm_loadu_ps(_values + i), _mm_mul_ps(_mm_loadu_ps(_rates + i), scale));
+				_mm_storeu_ps(_values + i, values);
+				const int mask = _mm_movemask_ps(_mm_cmpge_ps(values, limit));
+
+				// Few values reach the limit at once, most groups are skipped here
+				if (mask == 0)
+					continue;
+
+				for (std::size_t lane = 0; lane < Width; lane++)
+				{
+					_out[found] = _first_index + static_cast<std::uint32_t>(i + lane);
+					found += (mask >> lane) & 1;
+				}
+			}
+			return found + ScalarKernels.addScaledReaching(_values + i, _rates + i, _scale, _limit, _first_index + static_cast<std::uint32_t>(i), _out + found, _count - i);
+		}
+	}
+
+	const Kernels Sse2Kernels = {
+		AddSse2,
+		AddScaledSse2,
+		TranslateSse2,
+		ScaleSse2,
+		LerpSse2,
+		NormalizeSse2,
+		RotateSse2,
+		LengthSse2,
+		DistanceSse2,
+		TransformSse2,
+		OverlappingSse2,
+		AddScaledReachingSse2
+	};
+}
+
+#endif
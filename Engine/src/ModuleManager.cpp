@@ -2,6 +2,10 @@
 
 #include "Modules/ImGuiModule.h"
 #include "Modules/InputModule.h"
+#include "Modules/PerformanceModule.h"
+#include "Modules/PhysicsModule.h"
+#include "Modules/ReplayModule.h"
+#include "Modules/ResourcesModule.h"
 #include "Modules/SceneModule.h"
 #include "Modules/TimeModule.h"
 #include "Modules/WindowModule.h"
@@ -12,13 +16,24 @@ ModuleManager::~ModuleManager()
 	modules.clear();
 }
 
-void ModuleManager::CreateDefaultModules()
+void ModuleManager::CreateDefaultModules(const bool _headless)
 {
+	CreateModule<ReplayModule>();
 	CreateModule<TimeModule>();
 	CreateModule<InputModule>();
-	CreateModule<ImGuiModule>();
-	CreateModule<WindowModule>();
+
+	if (!_headless)
+	{
+#ifdef ENGINE_DEBUG_UI
+		CreateModule<ImGuiModule>();
+#endif
+		CreateModule<WindowModule>();
+	}
+
+	CreateModule<ResourcesModule>();
 	CreateModule<SceneModule>();
+	CreateModule<PhysicsModule>();
+	CreateModule<PerformanceModule>();
 }
 
 void ModuleManager::AddModule(Module* _module)
@@ -1,5 +1,9 @@
 #include "Modules/ImGuiModule.h"
 
+#include <algorithm>
+#include <cctype>
+#include <typeinfo>
+
 #include <imgui-SFML.h>
 #include <imgui.h>
 
@@ -9,6 +13,20 @@
 
 #include "Modules/InputModule.h"
 #include "Modules/WindowModule.h"
+#include "Serialization/ImGuiArchive.h"
+
+namespace
+{
+	/// Rows of a scene hierarchy shown before it scrolls.
+	constexpr int HierarchyRows = 16;
+
+	void ToLower(std::string& _text)
+	{
+		std::transform(_text.begin(), _text.end(), _text.begin(), [](const unsigned char _character) { return static_cast<char>(std::tolower(_character)); });
+	}
+}
+
+bool ImGuiModule::frameActive = false;
 
 void ImGuiModule::Start()
 {
@@ -17,6 +35,7 @@ void ImGuiModule::Start()
 	windowModule = moduleManager->GetModule<WindowModule>();
 	timeModule = moduleManager->GetModule<TimeModule>();
 	sceneModule = moduleManager->GetModule<SceneModule>();
+	resourcesModule = moduleManager->GetModule<ResourcesModule>();
 
 	ImGui::SFML::Init(*windowModule->GetWindow());
 }
@@ -25,31 +44,49 @@ void ImGuiModule::Update()
 {
 	Module::Update();
 
-	std::vector<sf::Event> events = InputModule::GetEvents();
-
-	for (sf::Event& event : events)
-		ImGui::SFML::ProcessEvent(*windowModule->GetWindow(), event);
-
-	ImGui::SFML::Update(*windowModule->GetWindow(), timeModule->GetDeltaClock().getElapsedTime());
-
 	if (InputModule::GetKeyDown(sf::Keyboard::Key::F1))
 	{
 		displayDebugWindow = !displayDebugWindow;
 	}
 
-	if (displayDebugWindow)
+	// The selected game object may have been deleted with its scene
+	if (sceneModule->GetScenesVersion() != selectedScenesVersion)
 	{
-		DisplayDebugWindow();
+		selectedGameObject = nullptr;
+		selectedScenesVersion = sceneModule->GetScenesVersion();
 	}
 
-	ImGui::ShowDemoWindow();
+	// Or destroyed alone, its scene is then searched without touching it
+	if (selectedGameObject && selectedScene->GetGameObjectsVersion() != selectedGameObjectsVersion)
+	{
+		const std::vector<GameObject*>& game_objects = selectedScene->GetGameObjects();
+		if (std::find(game_objects.begin(), game_objects.end(), selectedGameObject) == game_objects.end())
+			selectedGameObject = nullptr;
+		selectedGameObjectsVersion = selectedScene->GetGameObjectsVersion();
+	}
+
+	// Nothing is shown, the events of the frame are not needed either
+	frameActive = displayDebugWindow;
+	if (!frameActive)
+		return;
+
+	for (const sf::Event& event : InputModule::GetEvents())
+		ImGui::SFML::ProcessEvent(*windowModule->GetWindow(), event);
+
+	ImGui::SFML::Update(*windowModule->GetWindow(), timeModule->GetDeltaClock().getElapsedTime());
+
+	DisplayDebugWindow();
 }
 
 void ImGuiModule::PostRender()
 {
 	Module::PostRender();
 
+	if (!frameActive)
+		return;
+
 	ImGui::SFML::Render(*windowModule->GetWindow());
+	frameActive = false;
 }
 
 void ImGuiModule::Finalize()
@@ -65,54 +102,186 @@ void ImGuiModule::DisplayDebugWindow()
 
 	ImGui::SeparatorText("Scenes");
 
+	DisplayTransitionStats();
 	DisplayScenesList();
 
 	ImGui::SeparatorText("Selected GameObject");
 
 	DisplayGameObjectAsSelected(selectedGameObject);
 
+	ImGui::SeparatorText("Resources");
+
+	DisplayResourcesStats();
+
 	ImGui::End();
 }
 
 void ImGuiModule::DisplayScenesList()
 {
-	const std::vector<Scene*> scenes = sceneModule->GetScenes();
+	const std::vector<Scene*>& scenes = sceneModule->GetScenes();
+
+	ImGui::InputTextWithHint("##Search", "Search game objects", searchFilter, sizeof(searchFilter));
 
-	for (const Scene* scene : scenes)
+	const bool filtering = searchFilter[0] != '\0';
+	if (filtering)
+		UpdateSearchIndex(scenes);
+
+	for (std::size_t i = 0; i < scenes.size(); i++)
 	{
-		DisplayGameObjectsList(scene);
+		DisplayGameObjectsList(scenes[i], filtering ? &searchIndex[i].matches : nullptr);
 	}
 }
 
-void ImGuiModule::DisplayGameObjectsList(const Scene* _scene)
+void ImGuiModule::DisplayGameObjectsList(const Scene* _scene, const std::vector<std::uint32_t>* _matches)
 {
 	constexpr ImGuiTreeNodeFlags base_flags = ImGuiTreeNodeFlags_OpenOnArrow | ImGuiTreeNodeFlags_SpanAvailWidth;
 
+	ImGui::PushID(_scene);
+
 	if (ImGui::CollapsingHeader(_scene->GetName().c_str(), base_flags))
 	{
 		const std::vector<GameObject*>& game_objects = _scene->GetGameObjects();
-		for (const GameObject* game_object : game_objects)
+		const int count = static_cast<int>(_matches ? _matches->size() : game_objects.size());
+
+		const float height = static_cast<float>(std::clamp(count, 1, HierarchyRows)) * ImGui::GetTextLineHeightWithSpacing() + ImGui::GetStyle().WindowPadding.y * 2.0f;
+		if (ImGui::BeginChild("Hierarchy", ImVec2(0.0f, height), true))
 		{
-			DisplayGameObjectItem(game_object);
+			// Only the rows in view are submitted
+			ImGuiListClipper clipper;
+			clipper.Begin(count);
+			while (clipper.Step())
+			{
+				for (int i = clipper.DisplayStart; i < clipper.DisplayEnd; i++)
+				{
+					const std::uint32_t index = _matches ? (*_matches)[i] : static_cast<std::uint32_t>(i);
+					DisplayGameObjectItem(game_objects[index], index);
+				}
+			}
 		}
+		ImGui::EndChild();
 	}
+
+	ImGui::PopID();
 }
 
-void ImGuiModule::DisplayGameObjectItem(const GameObject* _game_object)
+void ImGuiModule::DisplayGameObjectItem(const GameObject* _game_object, const std::uint32_t _index)
 {
+	// Game objects may share a name, the index tells them apart
+	ImGui::PushID(static_cast<int>(_index));
+
 	if (ImGui::Selectable(_game_object->GetName().c_str(), selectedGameObject == _game_object))
 	{
 		selectedGameObject = const_cast<GameObject*>(_game_object);
+		selectedScene = _game_object->GetScene();
+		selectedGameObjectsVersion = selectedScene->GetGameObjectsVersion();
 	}
+
+	ImGui::PopID();
 }
 
-void ImGuiModule::DisplayGameObjectAsSelected(const GameObject* _game_object)
+void ImGuiModule::DisplayGameObjectAsSelected(GameObject* _game_object)
 {
-	if (selectedGameObject == nullptr)
+	if (_game_object == nullptr)
 	{
 		ImGui::Text("No GameObject selected");
 		return;
 	}
 
 	ImGui::Text("%s", _game_object->GetName().c_str());
+
+	Maths::Vector2f position = _game_object->GetPosition();
+	if (ImGui::DragFloat2("Position", &position.x))
+		_game_object->SetPosition(position);
+
+	float rotation = _game_object->GetRotation();
+	if (ImGui::DragFloat("Rotation", &rotation))
+		_game_object->SetRotation(rotation);
+
+	Maths::Vector2f scale = _game_object->GetScale();
+	if (ImGui::DragFloat2("Scale", &scale.x, 0.01f))
+		_game_object->SetScale(scale);
+
+	for (Component* component : _game_object->GetComponents())
+	{
+		const ComponentRegistry::ComponentType* type = ComponentRegistry::Find(component);
+
+		ImGui::PushID(component);
+
+		if (ImGui::CollapsingHeader(type ? type->name.c_str() : typeid(*component).name(), ImGuiTreeNodeFlags_DefaultOpen))
+		{
+			ImGuiArchive archive;
+			archive.SetVersion(type ? type->version : 1);
+			component->Serialize(archive);
+		}
+
+		ImGui::PopID();
+	}
+}
+
+void ImGuiModule::UpdateSearchIndex(const std::vector<Scene*>& _scenes)
+{
+	if (searchIndex.size() != _scenes.size() || indexedScenesVersion != sceneModule->GetScenesVersion())
+	{
+		searchIndex.assign(_scenes.size(), SceneIndex());
+		indexedScenesVersion = sceneModule->GetScenesVersion();
+	}
+
+	std::string filter = searchFilter;
+	ToLower(filter);
+
+	const bool filter_changed = filter != indexedFilter;
+	indexedFilter = filter;
+
+	for (std::size_t i = 0; i < _scenes.size(); i++)
+	{
+		SceneIndex& index = searchIndex[i];
+		const std::vector<GameObject*>& game_objects = _scenes[i]->GetGameObjects();
+
+		const bool names_changed = index.scene != _scenes[i] || index.version != _scenes[i]->GetGameObjectsVersion();
+		if (names_changed)
+		{
+			index.scene = _scenes[i];
+			index.version = _scenes[i]->GetGameObjectsVersion();
+			index.names.resize(game_objects.size());
+			for (std::size_t j = 0; j < game_objects.size(); j++)
+			{
+				index.names[j] = game_objects[j]->GetName();
+				ToLower(index.names[j]);
+			}
+		}
+
+		if (names_changed || filter_changed)
+		{
+			index.matches.clear();
+			for (std::size_t j = 0; j < index.names.size(); j++)
+			{
+				if (index.names[j].find(filter) != std::string::npos)
+					index.matches.push_back(static_cast<std::uint32_t>(j));
+			}
+		}
+	}
+}
+
+void ImGuiModule::DisplayTransitionStats() const
+{
+	const SceneModule::TransitionStats& stats = sceneModule->GetTransitionStats();
+
+	ImGui::Text("Loading: %u scene(s)", stats.pendingLoads);
+	ImGui::Text("Worst transition frame: %.2f ms (last) / %.2f ms (all %u)", stats.worstFrameTime * 1000.0f, stats.worstFrameTimeEver * 1000.0f, stats.transitions);
+}
+
+void ImGuiModule::DisplayResourcesStats() const
+{
+	if (resourcesModule == nullptr)
+		return;
+
+	const ResourcesModule::CacheStats& stats = resourcesModule->GetStats();
+	const std::uint64_t requests = stats.hits + stats.misses;
+
+	ImGui::Text("Resident: %zu resources (%zu unreferenced)", stats.residentCount, stats.unreferencedCount);
+	ImGui::Text("Memory: %.2f / %.2f MB", static_cast<double>(stats.residentBytes) / (1024.0 * 1024.0), static_cast<double>(stats.budgetBytes) / (1024.0 * 1024.0));
+	ImGui::ProgressBar(stats.budgetBytes > 0 ? static_cast<float>(stats.residentBytes) / static_cast<float>(stats.budgetBytes) : 0.0f);
+	ImGui::Text("Hits: %llu  Misses: %llu  (%.1f%% hit rate)", static_cast<unsigned long long>(stats.hits), static_cast<unsigned long long>(stats.misses), requests > 0 ? 100.0 * static_cast<double>(stats.hits) / static_cast<double>(requests) : 0.0);
+	ImGui::Text("Evictions: %llu", static_cast<unsigned long long>(stats.evictions));
+	ImGui::Text("Hot-reload: %s  Reloads: %llu", resourcesModule->IsHotReloadEnabled() ? "on" : "off", static_cast<unsigned long long>(stats.reloads));
 }
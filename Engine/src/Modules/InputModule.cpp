@@ -1,7 +1,6 @@
 #include "Modules/InputModule.h"
 
-#include <imgui-SFML.h>
-#include <SFML/Window/Event.hpp>
+#include <algorithm>
 
 #include "Engine.h"
 #include "ModuleManager.h"
@@ -11,89 +10,230 @@ void InputModule::Start()
 {
 	Module::Start();
 
-	window = moduleManager->GetModule<WindowModule>()->GetWindow();
+	if (const WindowModule* window_module = moduleManager->GetModule<WindowModule>())
+		window = window_module->GetWindow();
+
+	// Without a window polling events SFML does not refresh the joysticks
+	sfmlJoystickSource.SetUpdateDevices(!window);
 }
 
 void InputModule::Update()
 {
 	Module::Update();
 
-	events.clear();
-	keyUp.reset();
-	keyDown.reset();
-	mouseDown.reset();
-	mouseUp.reset();
+	keysDown.reset();
+	keysUp.reset();
+	mouseButtonsDown.reset();
+	mouseButtonsUp.reset();
+	previousJoysticks = joysticks;
+	eventCount = 0;
 
-	sf::Event event;
-	while (window->pollEvent(event))
-	{
-		events.push_back(event);
+	const Maths::Vector2i previous_mouse_position = mousePosition;
 
-		if (event.type == sf::Event::Closed)
-		{
-			Engine::GetInstance()->Quit();
-		}
-		else if (event.type == sf::Event::KeyPressed)
+	if (replayedFrame)
+	{
+		// The events give the pressed and released states, the recorded held state has the last word
+		for (const sf::Event& event : replayedFrame->events)
+			ProcessEvent(event);
+
+		keys = replayedFrame->keys;
+		mouseButtons = replayedFrame->mouseButtons;
+		mousePosition = replayedFrame->mousePosition;
+		joysticks = replayedFrame->joysticks;
+		replayedFrame = nullptr;
+	}
+	else
+	{
+		if (window)
 		{
-			keyDown.set(event.key.code);
+			sf::Event event;
+			while (window->pollEvent(event))
+				ProcessEvent(event);
 		}
-		else if (event.type == sf::Event::KeyReleased)
+
+		(joystickSource ? joystickSource : &sfmlJoystickSource)->Poll(joysticks);
+	}
+
+	mouseDelta = mousePosition - previous_mouse_position;
+
+	const JoystickState* action_joystick = &joysticks[0];
+	for (const JoystickState& joystick : joysticks)
+	{
+		if (joystick.connected)
 		{
-			keyUp.set(event.key.code);
+			action_joystick = &joystick;
+			break;
 		}
-		else if (event.type == sf::Event::MouseButtonPressed)
+	}
+
+	actions.Evaluate(keys, mouseButtons, *action_joystick);
+}
+
+std::size_t InputModule::ReadText(std::uint64_t& _cursor, char32_t* _output, const std::size_t _capacity)
+{
+	_cursor = std::clamp(_cursor, textWritten > TextCapacity ? textWritten - TextCapacity : 0, textWritten);
+
+	const std::size_t count = static_cast<std::size_t>(std::min<std::uint64_t>(textWritten - _cursor, _capacity));
+	for (std::size_t i = 0; i < count; i++)
+		_output[i] = text[(_cursor + i) % TextCapacity];
+
+	_cursor += count;
+	return count;
+}
+
+void InputModule::GetFrame(InputFrame& _frame)
+{
+	_frame.mousePosition = mousePosition;
+	_frame.keys = keys;
+	_frame.mouseButtons = mouseButtons;
+	_frame.joysticks = joysticks;
+	_frame.events.assign(events.begin(), events.begin() + static_cast<std::ptrdiff_t>(eventCount));
+}
+
+void InputModule::ProcessEvent(const sf::Event& _event)
+{
+	if (eventCount < MaxEvents)
+		events[eventCount++] = _event;
+
+	switch (_event.type)
+	{
+	case sf::Event::Closed:
+		Engine::GetInstance()->Quit();
+		break;
+
+	case sf::Event::TextEntered:
+		text[textWritten % TextCapacity] = static_cast<char32_t>(_event.text.unicode);
+		++textWritten;
+		break;
+
+	default:
+		break;
+	}
+
+	switch (_event.type)
+	{
+	case sf::Event::KeyPressed:
+	case sf::Event::KeyReleased:
+		// Keys unknown to SFML are reported as -1
+		if (_event.key.code >= 0 && _event.key.code < sf::Keyboard::Key::KeyCount)
 		{
-			mouseDown.set(event.mouseButton.button);
+			// Repeated presses of a held key are not new presses
+			const bool pressed = _event.type == sf::Event::KeyPressed;
+			if (keys[_event.key.code] != pressed)
+				(pressed ? keysDown : keysUp).set(_event.key.code);
+			keys[_event.key.code] = pressed;
 		}
-		else if (event.type == sf::Event::MouseButtonReleased)
+		break;
+
+	case sf::Event::MouseButtonPressed:
+	case sf::Event::MouseButtonReleased:
+		if (_event.mouseButton.button >= 0 && _event.mouseButton.button < sf::Mouse::Button::ButtonCount)
 		{
-			mouseUp.set(event.mouseButton.button);
+			const bool pressed = _event.type == sf::Event::MouseButtonPressed;
+			if (mouseButtons[_event.mouseButton.button] != pressed)
+				(pressed ? mouseButtonsDown : mouseButtonsUp).set(_event.mouseButton.button);
+			mouseButtons[_event.mouseButton.button] = pressed;
 		}
+		mousePosition = Maths::Vector2i(_event.mouseButton.x, _event.mouseButton.y);
+		break;
+
+	case sf::Event::MouseMoved:
+		mousePosition = Maths::Vector2i(_event.mouseMove.x, _event.mouseMove.y);
+		break;
+
+	case sf::Event::LostFocus:
+		// Releases are not received while the window is not focused, the held keys are released now
+		keysUp |= keys;
+		mouseButtonsUp |= mouseButtons;
+		keys.reset();
+		mouseButtons.reset();
+		break;
+
+	default:
+		break;
 	}
-
-	const sf::Vector2i previous_mouse_position = sf::Vector2i(mousePosition);
-	const sf::Vector2i new_mouse_position = sf::Mouse::getPosition(*window);
-
-	mouseDelta = new_mouse_position - previous_mouse_position;
-	mousePosition = new_mouse_position;
 }
 
 bool InputModule::GetMouseButton(const sf::Mouse::Button _button)
 {
-	return sf::Mouse::isButtonPressed(_button);
+	return _button >= 0 && _button < sf::Mouse::Button::ButtonCount && mouseButtons[_button];
 }
 
 bool InputModule::GetKey(const sf::Keyboard::Key _key)
 {
-	return sf::Keyboard::isKeyPressed(_key);
+	return _key >= 0 && _key < sf::Keyboard::Key::KeyCount && keys[_key];
 }
 
 bool InputModule::GetMouseButtonDown(const sf::Mouse::Button _button)
 {
-	return mouseDown[_button];
+	return _button >= 0 && _button < sf::Mouse::Button::ButtonCount && mouseButtonsDown[_button];
 }
 
 bool InputModule::GetKeyDown(const sf::Keyboard::Key _key)
 {
-	return keyDown[_key];
+	return _key >= 0 && _key < sf::Keyboard::Key::KeyCount && keysDown[_key];
 }
 
 bool InputModule::GetMouseButtonUp(const sf::Mouse::Button _button)
 {
-	return mouseUp[_button];
+	return _button >= 0 && _button < sf::Mouse::Button::ButtonCount && mouseButtonsUp[_button];
 }
 
 bool InputModule::GetKeyUp(const sf::Keyboard::Key _key)
 {
-	return keyUp[_key];
+	return _key >= 0 && _key < sf::Keyboard::Key::KeyCount && keysUp[_key];
+}
+
+bool InputModule::WasJoystickConnected(const unsigned int _joystick)
+{
+	return IsJoystickConnected(_joystick) && !previousJoysticks[_joystick].connected;
+}
+
+bool InputModule::WasJoystickDisconnected(const unsigned int _joystick)
+{
+	return _joystick < sf::Joystick::Count && !joysticks[_joystick].connected && previousJoysticks[_joystick].connected;
+}
+
+bool InputModule::GetJoystickButton(const unsigned int _joystick, const unsigned int _button)
+{
+	return _joystick < sf::Joystick::Count && _button < sf::Joystick::ButtonCount && joysticks[_joystick].buttons[_button];
+}
+
+bool InputModule::GetJoystickButtonDown(const unsigned int _joystick, const unsigned int _button)
+{
+	return GetJoystickButton(_joystick, _button) && !previousJoysticks[_joystick].buttons[_button];
+}
+
+bool InputModule::GetJoystickButtonUp(const unsigned int _joystick, const unsigned int _button)
+{
+	return _joystick < sf::Joystick::Count && _button < sf::Joystick::ButtonCount && !joysticks[_joystick].buttons[_button] && previousJoysticks[_joystick].buttons[_button];
+}
+
+float InputModule::GetJoystickAxis(const unsigned int _joystick, const sf::Joystick::Axis _axis)
+{
+	// AxisCount is not an sf::Joystick::Axis, both are compared as integers
+	const int axis = static_cast<int>(_axis);
+	return _joystick < sf::Joystick::Count && axis >= 0 && axis < static_cast<int>(sf::Joystick::AxisCount) ? joysticks[_joystick].axes[axis] : 0.0f;
 }
 
 Maths::Vector2i InputModule::mousePosition = Maths::Vector2i::Zero;
 Maths::Vector2i InputModule::mouseDelta = Maths::Vector2i::Zero;
 
-std::vector<sf::Event> InputModule::events;
+std::bitset<sf::Keyboard::Key::KeyCount> InputModule::keys;
+std::bitset<sf::Mouse::Button::ButtonCount> InputModule::mouseButtons;
+
+std::bitset<sf::Keyboard::Key::KeyCount> InputModule::keysDown;
+std::bitset<sf::Keyboard::Key::KeyCount> InputModule::keysUp;
+std::bitset<sf::Mouse::Button::ButtonCount> InputModule::mouseButtonsDown;
+std::bitset<sf::Mouse::Button::ButtonCount> InputModule::mouseButtonsUp;
+
+std::array<sf::Event, InputModule::MaxEvents> InputModule::events;
+std::size_t InputModule::eventCount = 0;
+
+JoystickStates InputModule::joysticks;
+JoystickStates InputModule::previousJoysticks;
+
+ActionMap InputModule::actions;
 
-std::bitset<sf::Mouse::Button::ButtonCount> InputModule::mouseDown;
-std::bitset<sf::Mouse::Button::ButtonCount> InputModule::mouseUp;
-std::bitset<sf::Keyboard::Key::KeyCount> InputModule::keyDown;
-std::bitset<sf::Keyboard::Key::KeyCount> InputModule::keyUp;
+std::array<char32_t, InputModule::TextCapacity> InputModule::text;
+std::uint64_t InputModule::textWritten = 0;
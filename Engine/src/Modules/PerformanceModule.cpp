@@ -0,0 +1,349 @@
+#include "Modules/PerformanceModule.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <fstream>
+
+#include "ModuleManager.h"
+#include "Modules/InputModule.h"
+#include "Modules/ResourcesModule.h"
+#include "Modules/SceneModule.h"
+#include "Modules/WindowModule.h"
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <windows.h>
+#include <psapi.h>
+#elif defined(__linux__)
+#include <unistd.h>
+#endif
+
+namespace
+{
+	/// Size of a pixel of the HUD font, in window pixels.
+	constexpr float FontScale = 2.0f;
+
+	constexpr float LineHeight = 7.0f * FontScale;
+	constexpr float CharacterAdvance = 4.0f * FontScale;
+
+	constexpr float HudMargin = 8.0f;
+	constexpr float HudPadding = 6.0f;
+	constexpr float GraphHeight = 60.0f;
+	constexpr float BarWidth = 2.0f;
+	constexpr std::size_t GraphBars = 128;
+
+	/// Frame time reaching the top of the graph, in seconds.
+	constexpr float GraphMaxTime = 1.0f / 30.0f;
+
+	constexpr float TargetFrameTime = 1.0f / 60.0f;
+
+	constexpr float HudRefreshInterval = 0.25f;
+
+	/**
+	 * \brief Packs the rows of a 3x5 glyph, the leftmost pixel in the highest bit.
+	 */
+	constexpr std::uint16_t Glyph(const std::uint16_t _r0, const std::uint16_t _r1, const std::uint16_t _r2, const std::uint16_t _r3, const std::uint16_t _r4)
+	{
+		return static_cast<std::uint16_t>(_r0 << 12 | _r1 << 9 | _r2 << 6 | _r3 << 3 | _r4);
+	}
+
+	constexpr std::uint16_t DigitGlyphs[] = {
+		Glyph(0b111, 0b101, 0b101, 0b101, 0b111), Glyph(0b010, 0b110, 0b010, 0b010, 0b111),
+		Glyph(0b111, 0b001, 0b111, 0b100, 0b111), Glyph(0b111, 0b001, 0b111, 0b001, 0b111),
+		Glyph(0b101, 0b101, 0b111, 0b001, 0b001), Glyph(0b111, 0b100, 0b111, 0b001, 0b111),
+		Glyph(0b111, 0b100, 0b111, 0b101, 0b111), Glyph(0b111, 0b001, 0b001, 0b001, 0b001),
+		Glyph(0b111, 0b101, 0b111, 0b101, 0b111), Glyph(0b111, 0b101, 0b111, 0b001, 0b111)
+	};
+
+	constexpr std::uint16_t LetterGlyphs[] = {
+		Glyph(0b010, 0b101, 0b111, 0b101, 0b101), Glyph(0b110, 0b101, 0b110, 0b101, 0b110),
+		Glyph(0b011, 0b100, 0b100, 0b100, 0b011), Glyph(0b110, 0b101, 0b101, 0b101, 0b110),
+		Glyph(0b111, 0b100, 0b110, 0b100, 0b111), Glyph(0b111, 0b100, 0b110, 0b100, 0b100),
+		Glyph(0b011, 0b100, 0b101, 0b101, 0b011), Glyph(0b101, 0b101, 0b111, 0b101, 0b101),
+		Glyph(0b111, 0b010, 0b010, 0b010, 0b111), Glyph(0b001, 0b001, 0b001, 0b101, 0b010),
+		Glyph(0b101, 0b101, 0b110, 0b101, 0b101), Glyph(0b100, 0b100, 0b100, 0b100, 0b111),
+		Glyph(0b101, 0b111, 0b111, 0b101, 0b101), Glyph(0b110, 0b101, 0b101, 0b101, 0b101),
+		Glyph(0b010, 0b101, 0b101, 0b101, 0b010), Glyph(0b110, 0b101, 0b110, 0b100, 0b100),
+		Glyph(0b010, 0b101, 0b101, 0b110, 0b011), Glyph(0b110, 0b101, 0b110, 0b101, 0b101),
+		Glyph(0b011, 0b100, 0b010, 0b001, 0b110), Glyph(0b111, 0b010, 0b010, 0b010, 0b010),
+		Glyph(0b101, 0b101, 0b101, 0b101, 0b111), Glyph(0b101, 0b101, 0b101, 0b101, 0b010),
+		Glyph(0b101, 0b101, 0b111, 0b111, 0b101), Glyph(0b101, 0b101, 0b010, 0b101, 0b101),
+		Glyph(0b101, 0b101, 0b010, 0b010, 0b010), Glyph(0b111, 0b001, 0b010, 0b100, 0b111)
+	};
+
+	static_assert(std::size(LetterGlyphs) == 26, "LetterGlyphs must list every letter");
+
+	std::uint16_t FindGlyph(const char _character)
+	{
+		if (_character >= '0' && _character <= '9')
+			return DigitGlyphs[_character - '0'];
+		if (_character >= 'A' && _character <= 'Z')
+			return LetterGlyphs[_character - 'A'];
+		if (_character >= 'a' && _character <= 'z')
+			return LetterGlyphs[_character - 'a'];
+
+		switch (_character)
+		{
+		case '.': return Glyph(0b000, 0b000, 0b000, 0b000, 0b010);
+		case ':': return Glyph(0b000, 0b010, 0b000, 0b010, 0b000);
+		case '%': return Glyph(0b101, 0b001, 0b010, 0b100, 0b101);
+		case '/': return Glyph(0b001, 0b001, 0b010, 0b100, 0b100);
+		case '-': return Glyph(0b000, 0b000, 0b111, 0b000, 0b000);
+		default: return 0;
+		}
+	}
+
+	void AddQuad(sf::VertexArray& _vertices, const float _x, const float _y, const float _width, const float _height, const sf::Color& _color)
+	{
+		const sf::Vector2f top_left(_x, _y);
+		const sf::Vector2f top_right(_x + _width, _y);
+		const sf::Vector2f bottom_left(_x, _y + _height);
+		const sf::Vector2f bottom_right(_x + _width, _y + _height);
+
+		_vertices.append(sf::Vertex(top_left, _color));
+		_vertices.append(sf::Vertex(top_right, _color));
+		_vertices.append(sf::Vertex(bottom_left, _color));
+		_vertices.append(sf::Vertex(top_right, _color));
+		_vertices.append(sf::Vertex(bottom_right, _color));
+		_vertices.append(sf::Vertex(bottom_left, _color));
+	}
+
+	void AddText(sf::VertexArray& _vertices, float _x, const float _y, const char* _text, const sf::Color& _color)
+	{
+		for (; *_text != '\0'; ++_text, _x += CharacterAdvance)
+		{
+			const std::uint16_t glyph = FindGlyph(*_text);
+
+			// One quad per run of lit pixels in a row
+			for (int row = 0; row < 5; row++)
+			{
+				const int bits = glyph >> (12 - row * 3) & 0b111;
+				for (int column = 0; column < 3;)
+				{
+					if (!(bits & 0b100 >> column))
+					{
+						++column;
+						continue;
+					}
+
+					int end = column + 1;
+					while (end < 3 && bits & 0b100 >> end)
+						++end;
+
+					AddQuad(_vertices, _x + column * FontScale, _y + row * FontScale, (end - column) * FontScale, FontScale, _color);
+					column = end;
+				}
+			}
+		}
+	}
+
+	std::size_t GetProcessMemory()
+	{
+#ifdef _WIN32
+		PROCESS_MEMORY_COUNTERS counters;
+		if (GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters)))
+			return counters.WorkingSetSize;
+#elif defined(__linux__)
+		std::ifstream statm("/proc/self/statm");
+		std::size_t pages = 0;
+		std::size_t resident = 0;
+		if (statm >> pages >> resident)
+			return resident * static_cast<std::size_t>(sysconf(_SC_PAGESIZE));
+#endif
+		return 0;
+	}
+
+	double ToMegabytes(const std::size_t _bytes)
+	{
+		return static_cast<double>(_bytes) / (1024.0 * 1024.0);
+	}
+}
+
+void PerformanceModule::Start()
+{
+	Module::Start();
+
+	windowModule = moduleManager->GetModule<WindowModule>();
+	sceneModule = moduleManager->GetModule<SceneModule>();
+	resourcesModule = moduleManager->GetModule<ResourcesModule>();
+
+	sortedTimes.reserve(MaxSamples);
+	hud.setPrimitiveType(sf::Triangles);
+}
+
+void PerformanceModule::Update()
+{
+	Module::Update();
+
+	// The phases of the previous frame are all measured now
+	if (hasFrame)
+	{
+		const Engine* engine = Engine::GetInstance();
+
+		FrameSample& sample = samples[nextSample];
+		sample.frameTime = 0.0f;
+		for (std::size_t i = 0; i < PhaseCount; i++)
+		{
+			sample.phaseTimes[i] = engine->GetPhaseTime(static_cast<Engine::FramePhase>(i));
+			sample.frameTime += sample.phaseTimes[i];
+		}
+		sample.drawCalls = WindowModule::GetDrawCallCount();
+
+		nextSample = (nextSample + 1) % MaxSamples;
+		sampleCount = std::min(sampleCount + 1, MaxSamples);
+	}
+	hasFrame = true;
+
+	if (InputModule::GetKeyDown(sf::Keyboard::Key::F2))
+		visible = !visible;
+
+	if (InputModule::GetKeyDown(sf::Keyboard::Key::F3))
+		DumpCsv(csvPath);
+}
+
+void PerformanceModule::PostRender()
+{
+	Module::PostRender();
+
+	if (!visible || windowModule == nullptr)
+		return;
+
+	BuildHud();
+
+	// The HUD is placed in window pixels, whatever the camera of the game
+	sf::RenderWindow* window = windowModule->GetWindow();
+	const sf::View view = window->getView();
+	window->setView(window->getDefaultView());
+	window->draw(hud);
+	window->setView(view);
+}
+
+const PerformanceModule::Stats& PerformanceModule::ComputeStats()
+{
+	stats = Stats();
+	sortedTimes.clear();
+
+	for (std::size_t age = 0; age < sampleCount && stats.duration < statsWindow; age++)
+	{
+		const FrameSample& sample = GetSample(age);
+		sortedTimes.push_back(sample.frameTime);
+		stats.duration += sample.frameTime;
+		stats.drawCalls += static_cast<float>(sample.drawCalls);
+		for (std::size_t i = 0; i < PhaseCount; i++)
+			stats.phaseTimes[i] += sample.phaseTimes[i];
+	}
+
+	stats.frames = static_cast<std::uint32_t>(sortedTimes.size());
+	if (stats.frames > 0)
+	{
+		const float frames = static_cast<float>(stats.frames);
+		stats.drawCalls /= frames;
+		for (float& phase_time : stats.phaseTimes)
+			phase_time /= frames;
+
+		// Nearest rank, each selection only partially sorts the times above the previous one
+		const auto percentile = [this](const float _percent, const std::size_t _from) {
+			const std::size_t rank = std::max<std::size_t>(static_cast<std::size_t>(std::ceil(_percent * static_cast<float>(sortedTimes.size()))), 1) - 1;
+			std::nth_element(sortedTimes.begin() + static_cast<std::ptrdiff_t>(std::min(_from, rank)), sortedTimes.begin() + static_cast<std::ptrdiff_t>(rank), sortedTimes.end());
+			return rank;
+		};
+
+		const std::size_t p50 = percentile(0.50f, 0);
+		stats.p50 = sortedTimes[p50];
+		const std::size_t p95 = percentile(0.95f, p50);
+		stats.p95 = sortedTimes[p95];
+		const std::size_t p99 = percentile(0.99f, p95);
+		stats.p99 = sortedTimes[p99];
+		stats.max = *std::max_element(sortedTimes.begin() + static_cast<std::ptrdiff_t>(p99), sortedTimes.end());
+	}
+
+	if (sceneModule != nullptr)
+	{
+		for (const Scene* scene : sceneModule->GetScenes())
+			stats.gameObjects += scene->GetGameObjects().size();
+	}
+
+	if (resourcesModule != nullptr)
+		stats.resourceBytes = resourcesModule->GetStats().residentBytes;
+
+	stats.processBytes = GetProcessMemory();
+
+	return stats;
+}
+
+bool PerformanceModule::DumpCsv(const std::filesystem::path& _path)
+{
+	const Stats& current = ComputeStats();
+
+	std::error_code error;
+	const bool write_header = !std::filesystem::exists(_path, error) || std::filesystem::file_size(_path, error) == 0;
+
+	std::ofstream file(_path, std::ios::app);
+	if (!file)
+		return false;
+
+	if (write_header)
+		file << "time,frames,fps,p50_ms,p95_ms,p99_ms,max_ms,update_ms,render_ms,present_ms,draw_calls,game_objects,resource_bytes,process_bytes\n";
+
+	char row[512];
+	std::snprintf(row, sizeof(row), "%.3f,%u,%.2f,%.3f,%.3f,%.3f,%.3f,%.3f,%.3f,%.3f,%.1f,%zu,%zu,%zu\n",
+		std::chrono::duration<double>(std::chrono::system_clock::now().time_since_epoch()).count(), current.frames,
+		current.duration > 0.0f ? static_cast<float>(current.frames) / current.duration : 0.0f,
+		current.p50 * 1000.0f, current.p95 * 1000.0f, current.p99 * 1000.0f, current.max * 1000.0f,
+		current.phaseTimes[0] * 1000.0f, current.phaseTimes[1] * 1000.0f, current.phaseTimes[2] * 1000.0f,
+		current.drawCalls, current.gameObjects, current.resourceBytes, current.processBytes);
+	file << row;
+
+	return static_cast<bool>(file);
+}
+
+void PerformanceModule::BuildHud()
+{
+	constexpr std::size_t line_count = 5;
+	constexpr float width = static_cast<float>(GraphBars) * BarWidth;
+	constexpr float text_height = static_cast<float>(line_count) * LineHeight;
+	constexpr float left = HudMargin + HudPadding;
+	constexpr float top = HudMargin + HudPadding;
+
+	// Statistics and text are rebuilt a few times per second, the graph every frame
+	hudRefreshTime -= sampleCount > 0 ? GetSample(0).frameTime : 0.0f;
+	if (hudRefreshTime <= 0.0f || hudTextVertexCount == 0)
+	{
+		hudRefreshTime = HudRefreshInterval;
+
+		const Stats& current = ComputeStats();
+		const float fps = current.duration > 0.0f ? static_cast<float>(current.frames) / current.duration : 0.0f;
+
+		char lines[line_count][64];
+		std::snprintf(lines[0], sizeof(lines[0]), "FPS %.1f  P50 %.2f MS", fps, current.p50 * 1000.0f);
+		std::snprintf(lines[1], sizeof(lines[1]), "P95 %.2f  P99 %.2f  MAX %.2f", current.p95 * 1000.0f, current.p99 * 1000.0f, current.max * 1000.0f);
+		std::snprintf(lines[2], sizeof(lines[2]), "UPD %.2f  REN %.2f  PRE %.2f", current.phaseTimes[0] * 1000.0f, current.phaseTimes[1] * 1000.0f, current.phaseTimes[2] * 1000.0f);
+		std::snprintf(lines[3], sizeof(lines[3]), "DRAW %.0f  OBJ %zu", current.drawCalls, current.gameObjects);
+		std::snprintf(lines[4], sizeof(lines[4]), "RES %.1f MB  MEM %.1f MB", ToMegabytes(current.resourceBytes), ToMegabytes(current.processBytes));
+
+		hud.clear();
+		AddQuad(hud, HudMargin, HudMargin, width + HudPadding * 2.0f, text_height + GraphHeight + HudPadding * 3.0f, sf::Color(0, 0, 0, 160));
+		for (std::size_t i = 0; i < line_count; i++)
+			AddText(hud, left, top + static_cast<float>(i) * LineHeight, lines[i], sf::Color::White);
+
+		hudTextVertexCount = hud.getVertexCount();
+	}
+
+	hud.resize(hudTextVertexCount);
+
+	// Oldest frame on the left, bars are clamped to the top of the graph
+	const float graph_bottom = top + text_height + HudPadding + GraphHeight;
+	const std::size_t bars = std::min(sampleCount, GraphBars);
+	for (std::size_t age = 0; age < bars; age++)
+	{
+		const float frame_time = GetSample(age).frameTime;
+		const float height = std::min(frame_time / GraphMaxTime, 1.0f) * GraphHeight;
+		const sf::Color color = frame_time <= TargetFrameTime ? sf::Color(80, 220, 80) : frame_time <= GraphMaxTime ? sf::Color(230, 200, 60) : sf::Color(230, 70, 60);
+		AddQuad(hud, left + width - static_cast<float>(age + 1) * BarWidth, graph_bottom - height, BarWidth, height, color);
+	}
+
+	AddQuad(hud, left, graph_bottom - TargetFrameTime / GraphMaxTime * GraphHeight, width, 1.0f, sf::Color(255, 255, 255, 120));
+}
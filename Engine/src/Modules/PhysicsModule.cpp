@@ -0,0 +1,51 @@
+#include "Modules/PhysicsModule.h"
+
+#include <algorithm>
+#include <thread>
+
+#include "ModuleManager.h"
+#include "Modules/SceneModule.h"
+#include "Modules/TimeModule.h"
+
+void PhysicsModule::Start()
+{
+	Module::Start();
+
+	sceneModule = moduleManager->GetModule<SceneModule>();
+	timeModule = moduleManager->GetModule<TimeModule>();
+
+	if (!workers)
+		SetThreadCount(std::clamp<std::size_t>(std::thread::hardware_concurrency(), 1, 4));
+}
+
+void PhysicsModule::Update()
+{
+	Module::Update();
+
+	accumulator += timeModule->GetDeltaTime();
+
+	int steps = 0;
+	while (accumulator >= fixedDeltaTime && steps < maxStepsPerFrame)
+	{
+		for (Scene* scene : sceneModule->GetScenes())
+			scene->GetPhysicsWorld().Step(fixedDeltaTime, workers.get());
+
+		accumulator -= fixedDeltaTime;
+		++steps;
+	}
+
+	// Behind by more than the steps allowed, the time left is dropped
+	if (accumulator >= fixedDeltaTime)
+		accumulator = 0.0f;
+
+	for (Scene* scene : sceneModule->GetScenes())
+	{
+		scene->GetCollisionWorld().Update();
+		scene->GetCollisionWorld().DispatchCollisions();
+	}
+}
+
+void PhysicsModule::SetThreadCount(const std::size_t _thread_count)
+{
+	workers = std::make_unique<WorkerPool>(std::max<std::size_t>(_thread_count, 1));
+}
@@ -0,0 +1,105 @@
+#include "Modules/ReplayModule.h"
+
+#include "Engine.h"
+#include "ModuleManager.h"
+#include "Modules/InputModule.h"
+#include "Modules/TimeModule.h"
+
+void ReplayModule::Start()
+{
+	Module::Start();
+
+	timeModule = moduleManager->GetModule<TimeModule>();
+	inputModule = moduleManager->GetModule<InputModule>();
+}
+
+void ReplayModule::Update()
+{
+	Module::Update();
+
+	if (IsRecording())
+	{
+		RecordFrame();
+		hasFrameToRecord = true;
+	}
+	else if (IsReplaying())
+	{
+		// Measured from the first replayed frame, not from StartReplay() which may be called before the engine starts
+		if (replayStats.frames == 0)
+			replayStart = Clock::now();
+
+		if (recording.ReadFrame(frame))
+		{
+			timeModule->SetNextDeltaTime(frame.deltaTime);
+			inputModule->SetReplayedFrame(&frame);
+
+			replayStats.frames = recording.GetFrameCount();
+			replayStats.simulatedTime += frame.deltaTime;
+			replayStats.realTime = std::chrono::duration<float>(Clock::now() - replayStart).count();
+
+			// Without a window nothing else can happen after the last recorded frame
+			if (recording.IsAtEnd() && Engine::GetInstance()->IsHeadless())
+				Engine::GetInstance()->Quit();
+		}
+		else
+		{
+			StopReplay();
+		}
+	}
+}
+
+void ReplayModule::Finalize()
+{
+	Module::Finalize();
+
+	StopRecording();
+	StopReplay();
+}
+
+bool ReplayModule::StartRecording(const std::filesystem::path& _path)
+{
+	StopReplay();
+	StopRecording();
+
+	hasFrameToRecord = false;
+	return recording.OpenForWriting(_path);
+}
+
+void ReplayModule::StopRecording()
+{
+	if (!IsRecording())
+		return;
+
+	RecordFrame();
+	recording.Close();
+}
+
+bool ReplayModule::StartReplay(const std::filesystem::path& _path)
+{
+	StopRecording();
+
+	replayStats = ReplayStats();
+	return recording.OpenForReading(_path);
+}
+
+void ReplayModule::StopReplay()
+{
+	if (!IsReplaying())
+		return;
+
+	replayStats.realTime = std::chrono::duration<float>(Clock::now() - replayStart).count();
+	recording.Close();
+
+	if (inputModule)
+		inputModule->SetReplayedFrame(nullptr);
+}
+
+void ReplayModule::RecordFrame()
+{
+	if (!hasFrameToRecord || !timeModule)
+		return;
+
+	InputModule::GetFrame(frame);
+	frame.deltaTime = timeModule->GetDeltaTime();
+	recording.WriteFrame(frame);
+}
@@ -1 +1,336 @@
 #include "Modules/ResourcesModule.h"
+
+#include <algorithm>
+
+void ResourcesModule::Start()
+{
+	Module::Start();
+
+#ifdef _DEBUG
+	SetHotReload(true);
+#endif
+}
+
+void ResourcesModule::Update()
+{
+	Module::Update();
+
+	if (IsHotReloadEnabled())
+	{
+		ApplyReloads();
+		QueueReloads();
+	}
+
+	Trim(stats.budgetBytes);
+}
+
+void ResourcesModule::Finalize()
+{
+	Module::Finalize();
+
+	SetHotReload(false);
+
+	{
+		// Under the lock, a thread releasing a resource meanwhile finds out whether it was evicted here or left to it
+		const std::lock_guard<std::mutex> lock(releaseQueueMutex);
+		finalized = true;
+		releaseQueue.clear();
+
+		for (const std::pair<const std::string, CacheEntry>& entry : resources)
+		{
+			AResource* resource = entry.second.resource;
+			if (resource->GetRefCount() == 0)
+			{
+				Evict(resource);
+				continue;
+			}
+
+			// Handles may outlive the module, released by components of scenes finalized later or by other threads
+			orphanedResources.push_back(resource);
+			resource->cache.store(nullptr, std::memory_order_release);
+		}
+	}
+	resources.clear();
+	lruList.clear();
+
+	stats.residentBytes = 0;
+	stats.residentCount = 0;
+	stats.unreferencedCount = 0;
+
+	UnmountPack();
+}
+
+bool ResourcesModule::MountPack(const std::string& _path)
+{
+	UnmountPack();
+
+	if (!assetPack.Open(_path))
+		return false;
+
+	AResource::SetAssetPack(&assetPack);
+	return true;
+}
+
+void ResourcesModule::UnmountPack()
+{
+	AResource::SetAssetPack(nullptr);
+	assetPack.Close();
+}
+
+bool ResourcesModule::SetHotReload(const bool _enabled)
+{
+	if (_enabled == IsHotReloadEnabled())
+		return true;
+
+	if (!_enabled)
+	{
+		fileWatcher.Stop();
+		StopReloadThread();
+		return true;
+	}
+
+	if (!fileWatcher.Start(AResource::AssetsFolderPath))
+		return false;
+
+	stopReloading = false;
+	reloadThread = std::thread(&ResourcesModule::ReloadThread, this);
+	return true;
+}
+
+void ResourcesModule::ReleaseResource(AResource* _resource)
+{
+	if (_resource)
+		_resource->Release();
+}
+
+void ResourcesModule::SetMemoryBudget(const std::size_t _bytes)
+{
+	stats.budgetBytes = _bytes;
+	Trim(stats.budgetBytes);
+}
+
+void ResourcesModule::EvictUnreferenced()
+{
+	Trim(0);
+}
+
+bool ResourcesModule::LoadFromPack(AResource* _resource, const std::string& _name)
+{
+	const void* data = nullptr;
+	std::size_t size = 0;
+
+	if (!assetPack.GetData(_name, data, size, decompressionBuffer))
+		return false;
+
+	return _resource->LoadFromMemory(data, size);
+}
+
+void ResourcesModule::Insert(const std::string& _name, AResource* _resource)
+{
+	_resource->name = _name;
+	_resource->path = AResource::GetPathFromName(_name);
+	_resource->cache = this;
+
+	CacheEntry& entry = resources[_name];
+	entry.resource = _resource;
+	entry.lruPosition = lruList.end();
+
+	stats.residentBytes += _resource->GetMemorySize();
+	++stats.residentCount;
+}
+
+void ResourcesModule::Trim(const std::size_t _budget)
+{
+	// Queued resources must reach the LRU list before anything is evicted
+	ProcessReleaseQueue();
+	MeasureResidentBytes();
+
+	while (stats.residentBytes > _budget && !lruList.empty())
+	{
+		AResource* resource = lruList.back();
+		lruList.pop_back();
+
+		const std::unordered_map<std::string, CacheEntry>::iterator it = resources.find(resource->name);
+		it->second.unreferenced = false;
+		--stats.unreferencedCount;
+
+		// Revived with AddRef() on a raw pointer since it was released
+		if (resource->GetRefCount() > 0)
+			continue;
+
+		stats.residentBytes -= resource->GetMemorySize();
+		--stats.residentCount;
+		++stats.evictions;
+		resources.erase(it);
+
+		Evict(resource);
+	}
+}
+
+void ResourcesModule::MeasureResidentBytes()
+{
+	stats.residentBytes = 0;
+	for (const std::pair<const std::string, CacheEntry>& entry : resources)
+		stats.residentBytes += entry.second.resource->GetMemorySize();
+}
+
+bool ResourcesModule::QueueRelease(AResource* _resource)
+{
+	const std::lock_guard<std::mutex> lock(releaseQueueMutex);
+
+	// The releasing thread read the cache before Finalize() cleared it
+	if (finalized)
+	{
+		const std::vector<AResource*>::iterator it = std::find(orphanedResources.begin(), orphanedResources.end(), _resource);
+		if (it == orphanedResources.end())
+			return true;
+
+		orphanedResources.erase(it);
+		return false;
+	}
+
+	releaseQueue.push_back(_resource);
+	return true;
+}
+
+void ResourcesModule::ProcessReleaseQueue()
+{
+	{
+		const std::lock_guard<std::mutex> lock(releaseQueueMutex);
+		processedReleases.swap(releaseQueue);
+	}
+
+	for (AResource* resource : processedReleases)
+	{
+		const std::unordered_map<std::string, CacheEntry>::iterator it = resources.find(resource->name);
+		if (it == resources.end() || it->second.unreferenced || resource->GetRefCount() > 0)
+			continue;
+
+		CacheEntry& entry = it->second;
+
+		lruList.push_front(resource);
+		entry.lruPosition = lruList.begin();
+		entry.unreferenced = true;
+		++stats.unreferencedCount;
+	}
+
+	processedReleases.clear();
+}
+
+void ResourcesModule::Evict(AResource* _resource)
+{
+	_resource->Unload();
+	_resource->ReleaseWeakRef();
+}
+
+void ResourcesModule::QueueReloads()
+{
+	fileWatcher.PollChanges(changedFiles);
+	changedFiles.insert(changedFiles.end(), deferredChanges.begin(), deferredChanges.end());
+	deferredChanges.clear();
+
+	if (changedFiles.empty())
+		return;
+
+	{
+		const std::lock_guard<std::mutex> lock(reloadMutex);
+
+		for (const std::string& file : changedFiles)
+		{
+			const AResource::Path changed_path = AResource::GetPathFromName(file).lexically_normal();
+
+			for (const std::pair<const std::string, CacheEntry>& entry : resources)
+			{
+				AResource* resource = entry.second.resource;
+				if (resource->path.lexically_normal() != changed_path)
+					continue;
+
+				// Still decoding the previous version, try again once it is applied
+				if (std::find(reloadsInFlight.begin(), reloadsInFlight.end(), resource) != reloadsInFlight.end())
+				{
+					deferredChanges.push_back(file);
+					continue;
+				}
+
+				resource->AddWeakRef();
+				reloadsInFlight.push_back(resource);
+				reloadJobs.push_back({resource, changed_path.string()});
+			}
+		}
+	}
+
+	reloadCondition.notify_one();
+}
+
+void ResourcesModule::ApplyReloads()
+{
+	{
+		const std::lock_guard<std::mutex> lock(reloadMutex);
+		appliedReloads.swap(finishedReloads);
+	}
+
+	for (const ReloadJob& job : appliedReloads)
+	{
+		reloadsInFlight.erase(std::find(reloadsInFlight.begin(), reloadsInFlight.end(), job.resource));
+
+		// The resource may have been evicted while it was decoded
+		const std::unordered_map<std::string, CacheEntry>::iterator it = resources.find(job.resource->name);
+		if (job.decoded && it != resources.end() && it->second.resource == job.resource)
+		{
+			job.resource->ApplyReload();
+			++stats.reloads;
+		}
+
+		job.resource->ReleaseWeakRef();
+	}
+
+	appliedReloads.clear();
+}
+
+void ResourcesModule::ReloadThread()
+{
+	std::unique_lock<std::mutex> lock(reloadMutex);
+
+	while (true)
+	{
+		reloadCondition.wait(lock, [this]()
+		{
+			return stopReloading || !reloadJobs.empty();
+		});
+
+		if (stopReloading)
+			return;
+
+		ReloadJob job = std::move(reloadJobs.front());
+		reloadJobs.pop_front();
+
+		// Decoding is the slow part, the main thread keeps running meanwhile
+		lock.unlock();
+		job.decoded = job.resource->DecodeReload(job.path);
+		lock.lock();
+
+		finishedReloads.push_back(std::move(job));
+	}
+}
+
+void ResourcesModule::StopReloadThread()
+{
+	{
+		const std::lock_guard<std::mutex> lock(reloadMutex);
+		stopReloading = true;
+	}
+
+	reloadCondition.notify_all();
+	if (reloadThread.joinable())
+		reloadThread.join();
+
+	for (const ReloadJob& job : reloadJobs)
+		job.resource->ReleaseWeakRef();
+	for (const ReloadJob& job : finishedReloads)
+		job.resource->ReleaseWeakRef();
+
+	reloadJobs.clear();
+	finishedReloads.clear();
+	reloadsInFlight.clear();
+	deferredChanges.clear();
+}
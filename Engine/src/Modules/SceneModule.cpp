@@ -1,6 +1,13 @@
 #include "Modules/SceneModule.h"
 
+#include <algorithm>
+#include <cmath>
+
 #include "ModuleManager.h"
+#include "Modules/ImGuiModule.h"
+#include "Resources/AResource.h"
+#include "Resources/AssetPack.h"
+#include "Serialization/SceneSerializer.h"
 
 SceneModule::SceneModule(): Module()
 {
@@ -15,6 +22,8 @@ void SceneModule::Start()
 
 	timeModule = moduleManager->GetModule<TimeModule>();
 	windowModule = moduleManager->GetModule<WindowModule>();
+
+	started = true;
 }
 
 void SceneModule::Render()
@@ -31,9 +40,19 @@ void SceneModule::Update()
 {
 	Module::Update();
 
-	for (const Scene* scene : scenes)
+	// Frame boundary: scenes are only added and removed here, never while they are updated
+	ProcessUnloads();
+	ActivateLoadedScenes();
+	UpdateStreaming();
+	DeleteRemovedScenes();
+	RecordTransitionFrame();
+
+	for (Scene* scene : scenes)
 	{
 		scene->Update(timeModule->GetDeltaTime());
+
+		// After the components, a clip played this frame starts moving at once
+		scene->GetAnimationSystem().Update(timeModule->GetDeltaTime());
 	}
 }
 
@@ -65,12 +84,22 @@ void SceneModule::Finalize()
 	{
 		scene->Finalize();
 	}
+
+	StopLoadingThread();
+
+	for (const Scene* scene : removedScenes)
+		delete scene;
+	removedScenes.clear();
 }
 
 void SceneModule::OnDebug()
 {
 	Module::OnDebug();
 
+	// Components draw their debug UI with ImGui, only while it builds a frame
+	if (!ImGuiModule::IsFrameActive())
+		return;
+
 	for (const Scene* scene : scenes)
 	{
 		scene->OnDebug();
@@ -81,6 +110,9 @@ void SceneModule::OnDebugSelected()
 {
 	Module::OnDebugSelected();
 
+	if (!ImGuiModule::IsFrameActive())
+		return;
+
 	for (const Scene* scene : scenes)
 	{
 		scene->OnDebugSelected();
@@ -147,6 +179,261 @@ void SceneModule::Present()
 	}
 }
 
+Scene* SceneModule::LoadScene(const std::string& _name, const bool _replace_scenes)
+{
+	Scene* scene = ReadScene(_name, AResource::GetAssetPack());
+	return scene ? AddScene(scene, _replace_scenes) : nullptr;
+}
+
+void SceneModule::LoadSceneAsync(const std::string& _name, const bool _replace_scenes)
+{
+	QueueLoadJob({_name, _replace_scenes});
+}
+
+void SceneModule::UnloadScene(Scene* _scene)
+{
+	if (_scene && std::find(pendingUnloads.begin(), pendingUnloads.end(), _scene) == pendingUnloads.end())
+		pendingUnloads.push_back(_scene);
+}
+
+void SceneModule::AddStreamingRegion(const std::string& _scene_name, const sf::FloatRect& _bounds)
+{
+	streamingRegions.push_back({_scene_name, _bounds});
+}
+
+void SceneModule::SetStreamingFocus(const Maths::Vector2f& _position, const float _load_distance, const float _unload_distance)
+{
+	streamingFocus = _position;
+	loadDistance = _load_distance;
+	unloadDistance = std::max(_load_distance, _unload_distance);
+}
+
+Scene* SceneModule::AddScene(Scene* _scene, const bool _replace_scenes)
+{
+	if (_replace_scenes)
+	{
+		while (!scenes.empty())
+			RemoveScene(scenes.back());
+		pendingUnloads.clear();
+
+		// Regions still loading were requested for the replaced scenes, they are dropped when they arrive
+		++replacements;
+		for (StreamingRegion& region : streamingRegions)
+			region.loading = false;
+	}
+
+	scenes.push_back(_scene);
+
+	if (_replace_scenes || mainScene == nullptr)
+		mainScene = _scene;
+
+	// Scenes added while running missed the startup events
+	if (started)
+	{
+		_scene->Awake();
+		_scene->Start();
+		_scene->OnEnable();
+	}
+
+	return _scene;
+}
+
+void SceneModule::RemoveScene(Scene* _scene)
+{
+	const std::vector<Scene*>::iterator it = std::find(scenes.begin(), scenes.end(), _scene);
+	if (it == scenes.end())
+		return;
+
+	scenes.erase(it);
+	++scenesVersion;
+
+	if (mainScene == _scene)
+		mainScene = scenes.empty() ? nullptr : scenes.front();
+
+	for (StreamingRegion& region : streamingRegions)
+	{
+		if (region.scene == _scene)
+			region.scene = nullptr;
+	}
+
+	// Destructors of components release resources and SFML objects, they run on the main thread
+	removedScenes.push_back(_scene);
+}
+
+Scene* SceneModule::ReadScene(const std::string& _name, const AssetPack* _asset_pack)
+{
+	if (_asset_pack && _asset_pack->Contains(_name))
+	{
+		const void* data = nullptr;
+		std::size_t size = 0;
+		std::vector<std::uint8_t> buffer;
+
+		return _asset_pack->GetData(_name, data, size, buffer) ? SceneSerializer::Load(data, size) : nullptr;
+	}
+
+	return SceneSerializer::LoadFromFile(AResource::GetPathFromName(_name));
+}
+
+void SceneModule::QueueLoadJob(LoadJob&& _job)
+{
+	if (transitionStats.pendingLoads++ == 0)
+	{
+		transitionStats.worstFrameTime = 0.0f;
+		++transitionStats.transitions;
+	}
+
+	// Read on the main thread only, mounting a pack while the loading thread reads it would race
+	_job.assetPack = AResource::GetAssetPack();
+	_job.replacements = replacements;
+
+	{
+		const std::lock_guard<std::mutex> lock(loadingMutex);
+		loadJobs.push_back(std::move(_job));
+
+		if (!loadingThread.joinable())
+		{
+			stopLoading = false;
+			loadingThread = std::thread(&SceneModule::LoadingThread, this);
+		}
+	}
+
+	loadingCondition.notify_one();
+}
+
+void SceneModule::LoadingThread()
+{
+	std::unique_lock<std::mutex> lock(loadingMutex);
+
+	while (true)
+	{
+		loadingCondition.wait(lock, [this]()
+		{
+			return stopLoading || !loadJobs.empty();
+		});
+
+		if (stopLoading)
+			return;
+
+		LoadJob job = std::move(loadJobs.front());
+		loadJobs.pop_front();
+
+		lock.unlock();
+
+		job.scene = job.build ? job.build() : ReadScene(job.name, job.assetPack);
+
+		lock.lock();
+		loadedScenes.push_back(std::move(job));
+	}
+}
+
+void SceneModule::StopLoadingThread()
+{
+	{
+		const std::lock_guard<std::mutex> lock(loadingMutex);
+		stopLoading = true;
+	}
+
+	loadingCondition.notify_all();
+	if (loadingThread.joinable())
+		loadingThread.join();
+
+	// Unfinished work: loaded scenes are dropped
+	for (const LoadJob& job : loadedScenes)
+		delete job.scene;
+
+	loadJobs.clear();
+	loadedScenes.clear();
+	transitionStats.pendingLoads = 0;
+}
+
+void SceneModule::ProcessUnloads()
+{
+	for (Scene* scene : pendingUnloads)
+		RemoveScene(scene);
+
+	pendingUnloads.clear();
+}
+
+void SceneModule::ActivateLoadedScenes()
+{
+	{
+		const std::lock_guard<std::mutex> lock(loadingMutex);
+		activatedScenes.swap(loadedScenes);
+	}
+
+	for (const LoadJob& job : activatedScenes)
+	{
+		--transitionStats.pendingLoads;
+
+		// Requested for scenes replaced since, its region may be loading again for the new ones
+		if (job.region >= 0 && job.replacements != replacements)
+		{
+			if (job.scene)
+				removedScenes.push_back(job.scene);
+			continue;
+		}
+
+		if (job.region >= 0)
+			streamingRegions[job.region].loading = false;
+
+		if (!job.scene)
+			continue;
+
+		AddScene(job.scene, job.replaceScenes);
+		framesSinceActivation = 0;
+
+		if (job.region >= 0)
+			streamingRegions[job.region].scene = job.scene;
+	}
+
+	activatedScenes.clear();
+}
+
+void SceneModule::DeleteRemovedScenes()
+{
+	// Deleting a large scene at once would be the hitch loading it on the loading thread avoided
+	if (!removedScenes.empty() && removedScenes.back()->DeleteGameObjects(DeletedGameObjectsPerFrame))
+	{
+		delete removedScenes.back();
+		removedScenes.pop_back();
+	}
+}
+
+void SceneModule::UpdateStreaming()
+{
+	for (std::size_t i = 0; i < streamingRegions.size(); i++)
+	{
+		StreamingRegion& region = streamingRegions[i];
+
+		const float delta_x = std::max({region.bounds.left - streamingFocus.x, 0.0f, streamingFocus.x - (region.bounds.left + region.bounds.width)});
+		const float delta_y = std::max({region.bounds.top - streamingFocus.y, 0.0f, streamingFocus.y - (region.bounds.top + region.bounds.height)});
+		const float distance = std::sqrt(delta_x * delta_x + delta_y * delta_y);
+
+		if (distance <= loadDistance && !region.scene && !region.loading)
+		{
+			region.loading = true;
+			QueueLoadJob({region.sceneName, false, static_cast<int>(i)});
+		}
+		else if (distance > unloadDistance && region.scene)
+		{
+			RemoveScene(region.scene);
+		}
+	}
+}
+
+void SceneModule::RecordTransitionFrame()
+{
+	if (transitionStats.pendingLoads > 0 || framesSinceActivation <= 1)
+	{
+		const float delta_time = timeModule->GetDeltaTime();
+		transitionStats.worstFrameTime = std::max(transitionStats.worstFrameTime, delta_time);
+		transitionStats.worstFrameTimeEver = std::max(transitionStats.worstFrameTimeEver, delta_time);
+	}
+
+	if (framesSinceActivation <= 1)
+		++framesSinceActivation;
+}
+
 const std::vector<Scene*>& SceneModule::GetScenes() const
 {
 	return scenes;
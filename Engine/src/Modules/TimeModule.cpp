@@ -13,7 +13,13 @@ void TimeModule::Update()
 	Module::Update();
 
 	const sf::Time delta = deltaClock.restart();
-	deltaTime = delta.asSeconds();
+	deltaTime = nextDeltaTime >= 0.0f ? nextDeltaTime : delta.asSeconds();
+	nextDeltaTime = -1.0f;
+}
+
+void TimeModule::SetNextDeltaTime(const float _delta_time)
+{
+	nextDeltaTime = _delta_time;
 }
 
 float TimeModule::GetDeltaTime() const
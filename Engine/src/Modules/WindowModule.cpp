@@ -6,6 +6,8 @@
 
 #include "Engine.h"
 
+std::uint32_t WindowModule::drawCalls = 0;
+
 void WindowModule::Awake()
 {
 	Module::Awake();
@@ -18,6 +20,7 @@ void WindowModule::PreRender()
 	Module::PreRender();
 
 	window->clear(sf::Color::Black);
+	drawCalls = 0;
 }
 
 void WindowModule::Present()
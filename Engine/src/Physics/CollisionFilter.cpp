@@ -0,0 +1,80 @@
+#include "Physics/CollisionFilter.h"
+
+#include <algorithm>
+
+namespace
+{
+	struct MatrixState
+	{
+		std::uint32_t masks[CollisionLayerCount];
+		std::uint32_t version = 0;
+
+		MatrixState()
+		{
+			for (std::uint32_t& mask : masks)
+				mask = AllLayers;
+		}
+	};
+
+	MatrixState& GetState()
+	{
+		static MatrixState state;
+		return state;
+	}
+
+	/// Layers past the last one are the last one, as SquareCollider::SetLayer() does.
+	std::uint32_t ClampLayer(const std::uint32_t _layer)
+	{
+		return std::min(_layer, CollisionLayerCount - 1);
+	}
+}
+
+void CollisionMatrix::SetLayersCollide(const std::uint32_t _layer_a, const std::uint32_t _layer_b, const bool _collide)
+{
+	MatrixState& state = GetState();
+	const std::uint32_t layer_a = ClampLayer(_layer_a);
+	const std::uint32_t layer_b = ClampLayer(_layer_b);
+	const std::uint32_t bit_a = 1u << layer_a;
+	const std::uint32_t bit_b = 1u << layer_b;
+
+	if (_collide)
+	{
+		state.masks[layer_a] |= bit_b;
+		state.masks[layer_b] |= bit_a;
+	}
+	else
+	{
+		state.masks[layer_a] &= ~bit_b;
+		state.masks[layer_b] &= ~bit_a;
+	}
+	++state.version;
+}
+
+bool CollisionMatrix::DoLayersCollide(const std::uint32_t _layer_a, const std::uint32_t _layer_b)
+{
+	return (GetState().masks[ClampLayer(_layer_a)] & 1u << ClampLayer(_layer_b)) != 0;
+}
+
+std::uint32_t CollisionMatrix::GetMask(const std::uint32_t _layer)
+{
+	return GetState().masks[ClampLayer(_layer)];
+}
+
+void CollisionMatrix::Reset()
+{
+	MatrixState& state = GetState();
+	for (std::uint32_t& mask : state.masks)
+		mask = AllLayers;
+	++state.version;
+}
+
+std::uint32_t CollisionMatrix::GetVersion()
+{
+	return GetState().version;
+}
+
+CollisionFilter CollisionMatrix::MakeFilter(const std::uint32_t _layer, const std::uint32_t _mask, const bool _is_trigger)
+{
+	const std::uint32_t layer = ClampLayer(_layer);
+	return CollisionFilter{1u << layer, _mask & GetState().masks[layer], _is_trigger};
+}
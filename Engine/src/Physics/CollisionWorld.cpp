@@ -0,0 +1,380 @@
+#include "Physics/CollisionWorld.h"
+
+#include <algorithm>
+#include <bit>
+#include <cmath>
+
+#include "GameObject.h"
+#include "Components/SquareCollider.h"
+
+ColliderId CollisionWorld::AddCollider(SquareCollider* _collider, const bool _is_static)
+{
+	ColliderId id;
+	if (!freeIds.empty())
+	{
+		id = freeIds.back();
+		freeIds.pop_back();
+	}
+	else
+	{
+		id = static_cast<ColliderId>(proxies.size());
+		proxies.emplace_back();
+	}
+
+	Proxy& proxy = proxies[id];
+	proxy.collider = _collider;
+	proxy.bounds = _collider->GetBounds();
+	proxy.filter = MakeFilter(_collider);
+	proxy.dynamicIndex = InvalidIndex;
+	proxy.refreshed = false;
+	proxy.treeProxy = tree.CreateProxy(proxy.bounds, id);
+	++treeAdditions;
+
+	if (!_is_static)
+	{
+		proxy.dynamicIndex = static_cast<std::uint32_t>(dynamicIds.size());
+		dynamicIds.push_back(id);
+	}
+
+	if (broadphase == Broadphase::SweepAndPrune)
+		sweepAndPrune.Add(id, proxy.bounds, proxy.filter);
+
+	return id;
+}
+
+void CollisionWorld::RemoveCollider(const ColliderId _id)
+{
+	// Out of the moving colliders, its bounds are not read anymore
+	SetStatic(_id, true);
+
+	Proxy& proxy = proxies[_id];
+	proxy.collider = nullptr;
+	tree.DestroyProxy(proxy.treeProxy);
+	proxy.treeProxy = DynamicTree::NullNode;
+
+	if (broadphase == Broadphase::SweepAndPrune)
+		sweepAndPrune.Remove(_id);
+
+	releasedIds.push_back(_id);
+}
+
+void CollisionWorld::SetStatic(const ColliderId _id, const bool _is_static)
+{
+	Proxy& proxy = proxies[_id];
+	if (_is_static == (proxy.dynamicIndex == InvalidIndex))
+		return;
+
+	if (_is_static)
+	{
+		const ColliderId last = dynamicIds.back();
+		dynamicIds[proxy.dynamicIndex] = last;
+		proxies[last].dynamicIndex = proxy.dynamicIndex;
+		dynamicIds.pop_back();
+		proxy.dynamicIndex = InvalidIndex;
+
+		// It may have moved since its bounds were last read
+		RefreshCollider(_id);
+	}
+	else
+	{
+		proxy.dynamicIndex = static_cast<std::uint32_t>(dynamicIds.size());
+		dynamicIds.push_back(_id);
+	}
+}
+
+void CollisionWorld::RefreshCollider(const ColliderId _id)
+{
+	Proxy& proxy = proxies[_id];
+	if (proxy.refreshed || proxy.dynamicIndex != InvalidIndex)
+		return;
+
+	proxy.refreshed = true;
+	refreshedIds.push_back(_id);
+}
+
+void CollisionWorld::RefreshFilter(const ColliderId _id)
+{
+	Proxy& proxy = proxies[_id];
+	const CollisionFilter filter = MakeFilter(proxy.collider);
+	if (filter.layerBit == proxy.filter.layerBit && filter.mask == proxy.filter.mask && filter.isTrigger == proxy.filter.isTrigger)
+		return;
+
+	proxy.filter = filter;
+
+	// Only this collider loses or finds pairs, the brute force reads the filters every update
+	if (broadphase == Broadphase::SweepAndPrune)
+		sweepAndPrune.SetFilter(_id, filter);
+}
+
+void CollisionWorld::SetBroadphase(const Broadphase _broadphase)
+{
+	if (broadphase == _broadphase)
+		return;
+
+	broadphase = _broadphase;
+	sweepAndPrune.Clear();
+	bruteForcePairs.clear();
+
+	if (broadphase == Broadphase::SweepAndPrune)
+		ResetSweepAndPrune();
+}
+
+void CollisionWorld::Update()
+{
+	for (const ColliderId id : dynamicIds)
+		MoveProxy(id, proxies[id].collider->GetBounds());
+
+	for (const ColliderId id : refreshedIds)
+	{
+		Proxy& proxy = proxies[id];
+		proxy.refreshed = false;
+		if (proxy.collider)
+			MoveProxy(id, proxy.collider->GetBounds());
+	}
+	refreshedIds.clear();
+
+	if (matrixVersion != CollisionMatrix::GetVersion())
+	{
+		matrixVersion = CollisionMatrix::GetVersion();
+		for (Proxy& proxy : proxies)
+		{
+			if (proxy.collider)
+				proxy.filter = MakeFilter(proxy.collider);
+		}
+
+		// Pairs kept by the sweep and prune may not be accepted anymore, or pairs filtered out may now be
+		if (broadphase == Broadphase::SweepAndPrune)
+			ResetSweepAndPrune();
+	}
+
+	// A scene load inserts everything in no particular order, the tree is better built from the top
+	if (treeAdditions > 32 && treeAdditions * 4 > tree.GetProxyCount())
+		tree.Rebuild();
+	treeAdditions = 0;
+
+	if (broadphase == Broadphase::SweepAndPrune)
+		sweepAndPrune.Update();
+	else
+		UpdateBruteForce();
+
+	freeIds.insert(freeIds.end(), releasedIds.begin(), releasedIds.end());
+	releasedIds.clear();
+}
+
+void CollisionWorld::DispatchCollisions() const
+{
+	const std::vector<CollisionPair>& pairs = GetPairs();
+
+	// Collisions may destroy game objects, removed colliders are null from then on
+	for (std::size_t i = 0; i < pairs.size(); i++)
+	{
+		const CollisionPair pair = pairs[i];
+
+		SquareCollider* collider_a = proxies[pair.a].collider;
+		SquareCollider* collider_b = proxies[pair.b].collider;
+		if (!collider_a || !collider_b)
+			continue;
+
+		collider_a->GetOwner()->OnCollision(*collider_a, *collider_b);
+
+		collider_a = proxies[pair.a].collider;
+		collider_b = proxies[pair.b].collider;
+		if (collider_a && collider_b)
+			collider_b->GetOwner()->OnCollision(*collider_b, *collider_a);
+	}
+}
+
+const std::vector<CollisionPair>& CollisionWorld::GetPairs() const
+{
+	return broadphase == Broadphase::SweepAndPrune ? sweepAndPrune.GetPairs() : bruteForcePairs;
+}
+
+std::size_t CollisionWorld::QueryRect(const Maths::Rectf& _rect, std::vector<SquareCollider*>& _results, const std::uint32_t _layers) const
+{
+	_results.clear();
+	tree.Query(_rect, [&](const std::int32_t _proxy)
+	{
+		const Proxy& proxy = proxies[tree.GetUserData(_proxy)];
+		if ((proxy.filter.layerBit & _layers) != 0 && proxy.bounds.Overlaps(_rect))
+			_results.push_back(proxy.collider);
+		return true;
+	});
+	return _results.size();
+}
+
+std::size_t CollisionWorld::QueryPoint(const Maths::Vector2f& _point, std::vector<SquareCollider*>& _results, const std::uint32_t _layers) const
+{
+	_results.clear();
+	tree.QueryPoint(_point, [&](const std::int32_t _proxy)
+	{
+		const Proxy& proxy = proxies[tree.GetUserData(_proxy)];
+		if ((proxy.filter.layerBit & _layers) != 0 && proxy.bounds.Contains(_point))
+			_results.push_back(proxy.collider);
+		return true;
+	});
+	return _results.size();
+}
+
+std::size_t CollisionWorld::QueryCircle(const Maths::Vector2f& _center, const float _radius, std::vector<SquareCollider*>& _results, const std::uint32_t _layers) const
+{
+	const float radius_squared = _radius * _radius;
+
+	_results.clear();
+	tree.QueryCircle(_center, _radius, [&](const std::int32_t _proxy)
+	{
+		const Proxy& proxy = proxies[tree.GetUserData(_proxy)];
+		if ((proxy.filter.layerBit & _layers) != 0 && proxy.bounds.DistanceSquared(_center) <= radius_squared)
+			_results.push_back(proxy.collider);
+		return true;
+	});
+	return _results.size();
+}
+
+bool CollisionWorld::Raycast(const Maths::Vector2f& _from, const Maths::Vector2f& _to, RaycastHit& _hit, const std::uint32_t _layers) const
+{
+	const Maths::Vector2f delta = _to - _from;
+	bool hit = false;
+
+	tree.Raycast(_from, _to, [&](const std::int32_t _proxy, const float _max_fraction)
+	{
+		const Proxy& proxy = proxies[tree.GetUserData(_proxy)];
+		if ((proxy.filter.layerBit & _layers) == 0)
+			return _max_fraction;
+
+		// Slabs: the segment is inside the bounds between the last entry and the first exit
+		float enter = 0.0f;
+		float exit = _max_fraction;
+		Maths::Vector2f normal = Maths::Vector2f::Zero;
+
+		for (int axis = 0; axis < 2; axis++)
+		{
+			const float start = axis == 0 ? _from.x : _from.y;
+			const float direction = axis == 0 ? delta.x : delta.y;
+			const float min = axis == 0 ? proxy.bounds.min.x : proxy.bounds.min.y;
+			const float max = axis == 0 ? proxy.bounds.max.x : proxy.bounds.max.y;
+
+			if (direction == 0.0f)
+			{
+				if (start < min || start > max)
+					return _max_fraction;
+				continue;
+			}
+
+			const float near_side = ((direction > 0.0f ? min : max) - start) / direction;
+			const float far_side = ((direction > 0.0f ? max : min) - start) / direction;
+			if (near_side > enter)
+			{
+				enter = near_side;
+				normal = axis == 0 ? Maths::Vector2f(direction > 0.0f ? -1.0f : 1.0f, 0.0f) : Maths::Vector2f(0.0f, direction > 0.0f ? -1.0f : 1.0f);
+			}
+			exit = std::min(exit, far_side);
+
+			if (enter > exit)
+				return _max_fraction;
+		}
+
+		hit = true;
+		_hit.collider = proxy.collider;
+		_hit.point = _from + delta * enter;
+		_hit.normal = normal;
+		_hit.fraction = enter;
+
+		// A segment starting inside stops the search, nothing is closer
+		return enter;
+	});
+
+	return hit;
+}
+
+void CollisionWorld::MoveProxy(const ColliderId _id, const Maths::Rectf& _bounds)
+{
+	Proxy& proxy = proxies[_id];
+	if (proxy.bounds == _bounds)
+		return;
+
+	tree.MoveProxy(proxy.treeProxy, _bounds, _bounds.min - proxy.bounds.min);
+
+	proxy.bounds = _bounds;
+	if (broadphase == Broadphase::SweepAndPrune)
+		sweepAndPrune.Move(_id, _bounds);
+}
+
+void CollisionWorld::UpdateBruteForce()
+{
+	// Colliders grouped by layer, with the layers accepted by any collider of each layer
+	std::uint32_t layer_starts[CollisionLayerCount + 1] = {};
+	std::uint32_t layer_masks[CollisionLayerCount] = {};
+	for (const Proxy& proxy : proxies)
+	{
+		if (!proxy.collider)
+			continue;
+
+		const int layer = std::countr_zero(proxy.filter.layerBit);
+		++layer_starts[layer + 1];
+		layer_masks[layer] |= proxy.filter.mask;
+	}
+	for (std::uint32_t layer = 0; layer < CollisionLayerCount; layer++)
+		layer_starts[layer + 1] += layer_starts[layer];
+
+	std::uint32_t layer_ends[CollisionLayerCount];
+	std::copy(layer_starts, layer_starts + CollisionLayerCount, layer_ends);
+
+	bruteForceIds.resize(layer_starts[CollisionLayerCount]);
+	for (ColliderId id = 0; id < proxies.size(); id++)
+	{
+		if (proxies[id].collider)
+			bruteForceIds[layer_ends[std::countr_zero(proxies[id].filter.layerBit)]++] = id;
+	}
+
+	bruteForceBounds.Resize(bruteForceIds.size());
+	for (std::size_t i = 0; i < bruteForceIds.size(); i++)
+		bruteForceBounds.Set(i, proxies[bruteForceIds[i]].bounds);
+
+	bruteForcePairs.clear();
+	overlapping.resize(bruteForceIds.size());
+
+	const Maths::ConstRectSpan bounds = bruteForceBounds.GetSpan();
+	for (std::uint32_t layer = 0; layer < CollisionLayerCount; layer++)
+	{
+		for (std::uint32_t i = layer_starts[layer]; i < layer_starts[layer + 1]; i++)
+		{
+			const CollisionFilter& filter = proxies[bruteForceIds[i]].filter;
+
+			// Its own layer after it and the layers after its own, every pair is tested once
+			for (std::uint32_t other_layer = layer; other_layer < CollisionLayerCount; other_layer++)
+			{
+				const std::uint32_t first = other_layer == layer ? i + 1 : layer_starts[other_layer];
+				const std::uint32_t last = layer_starts[other_layer + 1];
+
+				// Filtered out before testing any bounds when the layers cannot collide
+				if (first >= last || (filter.mask & 1u << other_layer) == 0 || (layer_masks[other_layer] & filter.layerBit) == 0)
+					continue;
+
+				const Maths::ConstRectSpan others = {bounds.minX + first, bounds.minY + first, bounds.maxX + first, bounds.maxY + first, last - first};
+				const std::size_t count = Maths::RectBatch::Overlapping(bruteForceBounds.Get(i), others, overlapping.data());
+
+				for (std::size_t j = 0; j < count; j++)
+				{
+					const ColliderId other = bruteForceIds[first + overlapping[j]];
+					if (filter.Accepts(proxies[other].filter))
+						bruteForcePairs.push_back(CollisionPair::Make(bruteForceIds[i], other));
+				}
+			}
+		}
+	}
+}
+
+void CollisionWorld::ResetSweepAndPrune()
+{
+	sweepAndPrune.Clear();
+	for (ColliderId id = 0; id < proxies.size(); id++)
+	{
+		if (proxies[id].collider)
+			sweepAndPrune.Add(id, proxies[id].bounds, proxies[id].filter);
+	}
+}
+
+CollisionFilter CollisionWorld::MakeFilter(const SquareCollider* _collider)
+{
+	return CollisionMatrix::MakeFilter(_collider->GetLayer(), _collider->GetMask(), _collider->IsTrigger());
+}
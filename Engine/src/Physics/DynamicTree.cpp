@@ -0,0 +1,333 @@
+#include "Physics/DynamicTree.h"
+
+#include <algorithm>
+
+std::int32_t DynamicTree::CreateProxy(const Maths::Rectf& _bounds, const std::uint32_t _user_data)
+{
+	const std::int32_t proxy = AllocateNode();
+	Node& node = nodes[proxy];
+	node.bounds = _bounds.Expand(margin);
+	node.userData = _user_data;
+	node.height = 0;
+
+	InsertLeaf(proxy);
+	++proxyCount;
+	return proxy;
+}
+
+void DynamicTree::DestroyProxy(const std::int32_t _proxy)
+{
+	RemoveLeaf(_proxy);
+	FreeNode(_proxy);
+	--proxyCount;
+}
+
+bool DynamicTree::MoveProxy(const std::int32_t _proxy, const Maths::Rectf& _bounds, const Maths::Vector2f& _displacement)
+{
+	// Grown ahead of the move, the proxy will likely keep moving that way
+	Maths::Rectf fat_bounds = _bounds.Expand(margin);
+	const Maths::Vector2f ahead = _displacement * 4.0f;
+	(ahead.x < 0.0f ? fat_bounds.min.x : fat_bounds.max.x) += ahead.x;
+	(ahead.y < 0.0f ? fat_bounds.min.y : fat_bounds.max.y) += ahead.y;
+
+	// Still inside, and the old fat bounds did not become far too big once the proxy slowed down
+	const Maths::Rectf& old_bounds = nodes[_proxy].bounds;
+	if (old_bounds.Contains(_bounds) && fat_bounds.Expand(margin * 4.0f).Contains(old_bounds))
+		return false;
+
+	RemoveLeaf(_proxy);
+	nodes[_proxy].bounds = fat_bounds;
+	InsertLeaf(_proxy);
+	return true;
+}
+
+void DynamicTree::Rebuild()
+{
+	if (proxyCount < 2)
+		return;
+
+	// Leaves keep their index, it is the id of their proxy, the other nodes are built again
+	std::vector<std::int32_t> leaves;
+	leaves.reserve(proxyCount);
+	freeList = NullNode;
+	for (std::int32_t index = static_cast<std::int32_t>(nodes.size()) - 1; index >= 0; index--)
+	{
+		if (nodes[index].height == 0)
+			leaves.push_back(index);
+		else
+			FreeNode(index);
+	}
+
+	root = BuildTopDown(leaves.data(), leaves.size(), NullNode);
+}
+
+void DynamicTree::Clear()
+{
+	nodes.clear();
+	root = NullNode;
+	freeList = NullNode;
+	proxyCount = 0;
+}
+
+float DynamicTree::GetAreaRatio() const
+{
+	if (root == NullNode)
+		return 0.0f;
+
+	float total = 0.0f;
+	for (const Node& node : nodes)
+	{
+		if (node.height >= 0)
+			total += node.bounds.GetPerimeter();
+	}
+
+	const float root_perimeter = nodes[root].bounds.GetPerimeter();
+	return root_perimeter > 0.0f ? total / root_perimeter : 0.0f;
+}
+
+bool DynamicTree::Validate() const
+{
+	std::size_t free_count = 0;
+	for (std::int32_t index = freeList; index != NullNode; index = nodes[index].parent)
+		++free_count;
+
+	std::size_t used_count = 0;
+	for (const Node& node : nodes)
+	{
+		if (node.height >= 0)
+			++used_count;
+	}
+
+	return free_count + used_count == nodes.size() && (root == NullNode || ValidateNode(root, NullNode));
+}
+
+std::int32_t DynamicTree::AllocateNode()
+{
+	std::int32_t index;
+	if (freeList != NullNode)
+	{
+		index = freeList;
+		freeList = nodes[index].parent;
+	}
+	else
+	{
+		index = static_cast<std::int32_t>(nodes.size());
+		nodes.emplace_back();
+	}
+
+	nodes[index] = Node();
+	return index;
+}
+
+void DynamicTree::FreeNode(const std::int32_t _node)
+{
+	nodes[_node].parent = freeList;
+	nodes[_node].height = -1;
+	freeList = _node;
+}
+
+std::int32_t DynamicTree::BuildTopDown(std::int32_t* _leaves, const std::size_t _count, const std::int32_t _parent)
+{
+	if (_count == 1)
+	{
+		nodes[_leaves[0]].parent = _parent;
+		return _leaves[0];
+	}
+
+	// Split at the median of the centers along the axis they spread the most
+	Maths::Vector2f min = nodes[_leaves[0]].bounds.GetCenter();
+	Maths::Vector2f max = min;
+	for (std::size_t i = 1; i < _count; i++)
+	{
+		const Maths::Vector2f center = nodes[_leaves[i]].bounds.GetCenter();
+		min = Maths::Vector2f::Min(min, center);
+		max = Maths::Vector2f::Max(max, center);
+	}
+
+	const bool split_x = max.x - min.x >= max.y - min.y;
+	const std::size_t half = _count / 2;
+	std::nth_element(_leaves, _leaves + half, _leaves + _count, [&](const std::int32_t _lhs, const std::int32_t _rhs)
+	{
+		const Maths::Rectf& lhs = nodes[_lhs].bounds;
+		const Maths::Rectf& rhs = nodes[_rhs].bounds;
+		return split_x ? lhs.min.x + lhs.max.x < rhs.min.x + rhs.max.x : lhs.min.y + lhs.max.y < rhs.min.y + rhs.max.y;
+	});
+
+	const std::int32_t index = AllocateNode();
+	const std::int32_t child1 = BuildTopDown(_leaves, half, index);
+	const std::int32_t child2 = BuildTopDown(_leaves + half, _count - half, index);
+
+	Node& node = nodes[index];
+	node.parent = _parent;
+	node.child1 = child1;
+	node.child2 = child2;
+	node.height = 1 + std::max(nodes[child1].height, nodes[child2].height);
+	node.bounds = nodes[child1].bounds.Union(nodes[child2].bounds);
+	return index;
+}
+
+void DynamicTree::InsertLeaf(const std::int32_t _leaf)
+{
+	if (root == NullNode)
+	{
+		root = _leaf;
+		nodes[root].parent = NullNode;
+		return;
+	}
+
+	// Walk down to the sibling adding the least perimeter, the perimeter of a node is the cost of entering it
+	const Maths::Rectf leaf_bounds = nodes[_leaf].bounds;
+	std::int32_t index = root;
+	while (!nodes[index].IsLeaf())
+	{
+		const Node& node = nodes[index];
+		const float perimeter = node.bounds.GetPerimeter();
+		const float combined_perimeter = node.bounds.Union(leaf_bounds).GetPerimeter();
+
+		// Cost of a new parent for this node and the leaf, and cost added to the children by going down
+		const float cost = 2.0f * combined_perimeter;
+		const float inheritance_cost = 2.0f * (combined_perimeter - perimeter);
+
+		const auto child_cost = [&](const std::int32_t _child)
+		{
+			const Node& child = nodes[_child];
+			const float union_perimeter = child.bounds.Union(leaf_bounds).GetPerimeter();
+			return (child.IsLeaf() ? union_perimeter : union_perimeter - child.bounds.GetPerimeter()) + inheritance_cost;
+		};
+
+		const float cost1 = child_cost(node.child1);
+		const float cost2 = child_cost(node.child2);
+		if (cost < cost1 && cost < cost2)
+			break;
+
+		index = cost1 < cost2 ? node.child1 : node.child2;
+	}
+
+	const std::int32_t sibling = index;
+	const std::int32_t old_parent = nodes[sibling].parent;
+	const std::int32_t new_parent = AllocateNode();
+
+	Node& parent = nodes[new_parent];
+	parent.parent = old_parent;
+	parent.bounds = leaf_bounds.Union(nodes[sibling].bounds);
+	parent.height = nodes[sibling].height + 1;
+	parent.child1 = sibling;
+	parent.child2 = _leaf;
+
+	if (old_parent != NullNode)
+		(nodes[old_parent].child1 == sibling ? nodes[old_parent].child1 : nodes[old_parent].child2) = new_parent;
+	else
+		root = new_parent;
+
+	nodes[sibling].parent = new_parent;
+	nodes[_leaf].parent = new_parent;
+
+	Refit(new_parent);
+}
+
+void DynamicTree::RemoveLeaf(const std::int32_t _leaf)
+{
+	if (_leaf == root)
+	{
+		root = NullNode;
+		return;
+	}
+
+	const std::int32_t parent = nodes[_leaf].parent;
+	const std::int32_t grand_parent = nodes[parent].parent;
+	const std::int32_t sibling = nodes[parent].child1 == _leaf ? nodes[parent].child2 : nodes[parent].child1;
+
+	// The sibling takes the place of the parent
+	FreeNode(parent);
+	nodes[sibling].parent = grand_parent;
+
+	if (grand_parent == NullNode)
+	{
+		root = sibling;
+		return;
+	}
+
+	(nodes[grand_parent].child1 == parent ? nodes[grand_parent].child1 : nodes[grand_parent].child2) = sibling;
+	Refit(grand_parent);
+}
+
+void DynamicTree::Refit(std::int32_t _node)
+{
+	while (_node != NullNode)
+	{
+		_node = Balance(_node);
+
+		Node& node = nodes[_node];
+		const Node& child1 = nodes[node.child1];
+		const Node& child2 = nodes[node.child2];
+		node.height = 1 + std::max(child1.height, child2.height);
+		node.bounds = child1.bounds.Union(child2.bounds);
+
+		_node = node.parent;
+	}
+}
+
+std::int32_t DynamicTree::Balance(const std::int32_t _node)
+{
+	Node& a = nodes[_node];
+	if (a.IsLeaf() || a.height < 2)
+		return _node;
+
+	// Rotates the deeper child up, A becomes its child and takes its shallower grandchild
+	const auto rotate_up = [&](const std::int32_t _child, const bool _is_child2)
+	{
+		Node& c = nodes[_child];
+		const std::int32_t other = _is_child2 ? a.child1 : a.child2;
+		const std::int32_t f = c.child1;
+		const std::int32_t g = c.child2;
+
+		c.child1 = _node;
+		c.parent = a.parent;
+		a.parent = _child;
+
+		if (c.parent != NullNode)
+			(nodes[c.parent].child1 == _node ? nodes[c.parent].child1 : nodes[c.parent].child2) = _child;
+		else
+			root = _child;
+
+		// The deeper grandchild stays with C, the other one moves under A
+		const bool keep_f = nodes[f].height > nodes[g].height;
+		const std::int32_t kept = keep_f ? f : g;
+		const std::int32_t moved = keep_f ? g : f;
+
+		c.child2 = kept;
+		(_is_child2 ? a.child2 : a.child1) = moved;
+		nodes[moved].parent = _node;
+
+		a.bounds = nodes[other].bounds.Union(nodes[moved].bounds);
+		a.height = 1 + std::max(nodes[other].height, nodes[moved].height);
+		c.bounds = a.bounds.Union(nodes[kept].bounds);
+		c.height = 1 + std::max(a.height, nodes[kept].height);
+		return _child;
+	};
+
+	const std::int32_t balance = nodes[a.child2].height - nodes[a.child1].height;
+	if (balance > 1)
+		return rotate_up(a.child2, true);
+	if (balance < -1)
+		return rotate_up(a.child1, false);
+
+	return _node;
+}
+
+bool DynamicTree::ValidateNode(const std::int32_t _node, const std::int32_t _parent) const
+{
+	const Node& node = nodes[_node];
+	if (node.parent != _parent)
+		return false;
+
+	if (node.IsLeaf())
+		return node.height == 0 && node.child2 == NullNode;
+
+	const Node& child1 = nodes[node.child1];
+	const Node& child2 = nodes[node.child2];
+	return node.height == 1 + std::max(child1.height, child2.height)
+		&& node.bounds == child1.bounds.Union(child2.bounds)
+		&& ValidateNode(node.child1, _node)
+		&& ValidateNode(node.child2, _node);
+}
@@ -0,0 +1,750 @@
+#include "Physics/PhysicsWorld.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include "GameObject.h"
+#include "Components/Rigidbody2D.h"
+#include "Components/SquareCollider.h"
+#include "WorkerPool.h"
+#include "Physics/CollisionWorld.h"
+
+namespace
+{
+	/// Fraction of the depth past the slop corrected per step.
+	constexpr float Baumgarte = 0.2f;
+
+	/// Depth left uncorrected, resting boxes keep overlapping and their contact is not lost.
+	constexpr float LinearSlop = 0.5f;
+
+	/// Impact speed under which bodies do not bounce, in pixels per second.
+	constexpr float RestitutionThreshold = 60.0f;
+
+	/// Speed under which a body is at rest, in pixels per second.
+	constexpr float SleepTolerance = 5.0f;
+
+	/// Time an island stays at rest before it sleeps, in seconds.
+	constexpr float TimeToSleep = 0.5f;
+
+	/// Work given to a thread at once, small enough for the threads to share it evenly.
+	constexpr std::size_t PairsPerTask = 512;
+	constexpr std::size_t BodiesPerTask = 1024;
+	constexpr std::uint32_t ContactsPerTask = 256;
+
+	/**
+	 * \brief Finds where a point moving along a segment enters a box.
+	 * \param _bounds The box.
+	 * \param _from The start of the segment, outside the box.
+	 * \param _delta The move along the segment.
+	 * \param _fraction The fraction to beat, replaced by the entry on a hit.
+	 * \param _normal Replaced by the normal of the side entered on a hit.
+	 * \return True if the box is entered before _fraction.
+	 */
+	bool SegmentEnters(const Maths::Rectf& _bounds, const Maths::Vector2f& _from, const Maths::Vector2f& _delta, float& _fraction, Maths::Vector2f& _normal)
+	{
+		float enter = 0.0f;
+		float exit = _fraction;
+		Maths::Vector2f normal = Maths::Vector2f::Zero;
+
+		for (int axis = 0; axis < 2; axis++)
+		{
+			const float start = axis == 0 ? _from.x : _from.y;
+			const float direction = axis == 0 ? _delta.x : _delta.y;
+			const float min = axis == 0 ? _bounds.min.x : _bounds.min.y;
+			const float max = axis == 0 ? _bounds.max.x : _bounds.max.y;
+
+			if (direction == 0.0f)
+			{
+				if (start <= min || start >= max)
+					return false;
+				continue;
+			}
+
+			const float near_side = ((direction > 0.0f ? min : max) - start) / direction;
+			const float far_side = ((direction > 0.0f ? max : min) - start) / direction;
+			if (near_side >= enter)
+			{
+				enter = near_side;
+				normal = axis == 0 ? Maths::Vector2f(direction > 0.0f ? -1.0f : 1.0f, 0.0f) : Maths::Vector2f(0.0f, direction > 0.0f ? -1.0f : 1.0f);
+			}
+			exit = std::min(exit, far_side);
+
+			if (enter >= exit)
+				return false;
+		}
+
+		// Starting inside is left to the contacts
+		if (normal == Maths::Vector2f::Zero)
+			return false;
+
+		_fraction = enter;
+		_normal = normal;
+		return true;
+	}
+}
+
+BodyId PhysicsWorld::AddBody(Rigidbody2D* _rigidbody)
+{
+	BodyId id;
+	if (!freeIds.empty())
+	{
+		id = freeIds.back();
+		freeIds.pop_back();
+	}
+	else
+	{
+		id = static_cast<BodyId>(bodies.size());
+		bodies.emplace_back();
+	}
+
+	Body& body = bodies[id];
+	body = Body();
+	body.rigidbody = _rigidbody;
+	body.inverseMass = _rigidbody->GetInverseMass();
+	body.awakeIndex = static_cast<std::uint32_t>(awakeBodies.size());
+	awakeBodies.push_back(id);
+
+	return id;
+}
+
+void PhysicsWorld::RemoveBody(const BodyId _id)
+{
+	WakeUp(_id);
+	SetBodyCollider(_id, nullptr);
+
+	Body& body = bodies[_id];
+	const BodyId last = awakeBodies.back();
+	awakeBodies[body.awakeIndex] = last;
+	bodies[last].awakeIndex = body.awakeIndex;
+	awakeBodies.pop_back();
+
+	body = Body();
+	freeIds.push_back(_id);
+}
+
+void PhysicsWorld::SetBodyCollider(const BodyId _id, SquareCollider* _collider)
+{
+	Body& body = bodies[_id];
+	if (body.collider == _collider)
+		return;
+
+	if (body.collider)
+		LinkCollider(_id, false);
+
+	body.collider = _collider;
+	body.colliderId = _collider ? _collider->GetColliderId() : InvalidCollider;
+
+	if (body.collider)
+		LinkCollider(_id, true);
+}
+
+void PhysicsWorld::SetVelocity(const BodyId _id, const Maths::Vector2f& _velocity)
+{
+	bodies[_id].velocity = _velocity;
+	WakeUp(_id);
+}
+
+void PhysicsWorld::ApplyForce(const BodyId _id, const Maths::Vector2f& _force)
+{
+	bodies[_id].force += _force;
+	WakeUp(_id);
+}
+
+void PhysicsWorld::WakeUp(const BodyId _id)
+{
+	Body& body = bodies[_id];
+	if (body.sleepingIsland != InvalidIndex)
+		WakeUpIsland(body.sleepingIsland);
+	else
+		body.sleepTime = 0.0f;
+}
+
+void PhysicsWorld::WakeUpArea(const Maths::Rectf& _bounds)
+{
+	if (sleepingIslands.size() == freeSleepingIslands.size())
+		return;
+
+	// Bodies resting on the area only touch its edges
+	collisionWorld.QueryRect(_bounds.Expand(1.0f), sweepResults);
+	for (const SquareCollider* collider : sweepResults)
+	{
+		const BodyId id = GetColliderBody(collider->GetColliderId());
+		if (id != InvalidBody)
+			WakeUp(id);
+	}
+}
+
+void PhysicsWorld::Step(const float _delta_time, WorkerPool* _workers)
+{
+	collisionWorld.Update();
+
+	if (awakeBodies.empty())
+	{
+		contacts.clear();
+		islands.clear();
+		islandTasks.assign(1, 0);
+		return;
+	}
+
+	RunTasks(_workers, (awakeBodies.size() + BodiesPerTask - 1) / BodiesPerTask, [&](const std::size_t _task)
+	{
+		const std::size_t end = std::min(awakeBodies.size(), (_task + 1) * BodiesPerTask);
+		for (std::size_t i = _task * BodiesPerTask; i < end; i++)
+		{
+			Body& body = bodies[awakeBodies[i]];
+			const Rigidbody2D* rigidbody = body.rigidbody;
+
+			body.inverseMass = rigidbody->GetInverseMass();
+			if (body.inverseMass > 0.0f)
+			{
+				body.velocity += (gravity * rigidbody->GetGravityScale() + body.force * body.inverseMass) * _delta_time;
+				body.velocity *= 1.0f / (1.0f + _delta_time * rigidbody->GetLinearDamping());
+			}
+			body.force = Maths::Vector2f::Zero;
+		}
+	});
+
+	WakeUpTouched();
+	BuildContacts(_delta_time, _workers);
+	BuildIslands(_workers);
+
+	// Islands share no dynamic body, each one is solved by one thread in the same order whatever the number of threads
+	RunTasks(_workers, islandTasks.size() - 1, [this](const std::size_t _task)
+	{
+		for (std::uint32_t island = islandTasks[_task]; island < islandTasks[_task + 1]; island++)
+			SolveIsland(islands[island]);
+	});
+
+	IntegratePositions(_delta_time, _workers);
+	UpdateSleep(_delta_time, _workers);
+}
+
+void PhysicsWorld::LinkCollider(const BodyId _id, const bool _linked)
+{
+	const Body& body = bodies[_id];
+	if (body.colliderId >= colliderBodies.size())
+		colliderBodies.resize(body.colliderId + 1, InvalidBody);
+
+	colliderBodies[body.colliderId] = _linked ? _id : InvalidBody;
+
+	// Read every frame while awake, the collider keeps its own setting once unlinked
+	collisionWorld.SetStatic(body.colliderId, _linked ? !IsAwake(_id) : body.collider->IsStatic());
+}
+
+void PhysicsWorld::WakeUpIsland(const std::uint32_t _island)
+{
+	std::vector<BodyId>& island_bodies = sleepingIslands[_island];
+	for (const BodyId id : island_bodies)
+	{
+		Body& body = bodies[id];
+		body.sleepTime = 0.0f;
+		body.sleepingIsland = InvalidIndex;
+		body.awakeIndex = static_cast<std::uint32_t>(awakeBodies.size());
+		awakeBodies.push_back(id);
+
+		if (body.collider)
+			collisionWorld.SetStatic(body.colliderId, false);
+	}
+
+	island_bodies.clear();
+	freeSleepingIslands.push_back(_island);
+}
+
+void PhysicsWorld::WakeUpTouched()
+{
+	if (sleepingIslands.size() == freeSleepingIslands.size())
+		return;
+
+	// Both sides of a contact are solved together, a sleeping body touched by an awake one wakes with its island
+	for (const CollisionPair& pair : collisionWorld.GetPairs())
+	{
+		const BodyId id_a = GetColliderBody(pair.a);
+		const BodyId id_b = GetColliderBody(pair.b);
+		if (id_a == InvalidBody || id_b == InvalidBody)
+			continue;
+
+		// Nothing pushes through a trigger
+		if (collisionWorld.GetFilter(pair.a).isTrigger || collisionWorld.GetFilter(pair.b).isTrigger)
+			continue;
+
+		if (IsAwake(id_a) != IsAwake(id_b))
+			WakeUp(IsAwake(id_a) ? id_b : id_a);
+	}
+}
+
+void PhysicsWorld::BuildContacts(const float _delta_time, WorkerPool* _workers)
+{
+	std::swap(contacts, previousContacts);
+
+	// The slots of the pairs of a task are filled from their start, then sorted, the pairs come in no particular order
+	const std::vector<CollisionPair>& pairs = collisionWorld.GetPairs();
+	contacts.resize(pairs.size());
+
+	const std::size_t task_count = (pairs.size() + PairsPerTask - 1) / PairsPerTask;
+	contactRuns.assign(task_count + 1, 0);
+	RunTasks(_workers, task_count, [&](const std::size_t _task)
+	{
+		const std::size_t begin = _task * PairsPerTask;
+		const std::size_t end = std::min(pairs.size(), begin + PairsPerTask);
+		std::size_t made = begin;
+		for (std::size_t i = begin; i < end; i++)
+		{
+			if (MakeContact(pairs[i], _delta_time, contacts[made]))
+				++made;
+		}
+
+		std::sort(contacts.begin() + begin, contacts.begin() + made, [](const Contact& _lhs, const Contact& _rhs) { return _lhs.key < _rhs.key; });
+		contactRuns[_task + 1] = static_cast<std::uint32_t>(made - begin);
+	});
+
+	MergeContactRuns(_workers);
+
+	// Warm start from the impulses of the same contacts at the previous step, both are sorted
+	RunTasks(_workers, (contacts.size() + PairsPerTask - 1) / PairsPerTask, [&](const std::size_t _task)
+	{
+		const std::size_t begin = _task * PairsPerTask;
+		const std::size_t end = std::min(contacts.size(), begin + PairsPerTask);
+
+		// Searched once per task, then walked along
+		std::size_t previous = std::lower_bound(previousContacts.begin(), previousContacts.end(), contacts[begin].key,
+			[](const Contact& _contact, const std::uint64_t _key) { return _contact.key < _key; }) - previousContacts.begin();
+		for (std::size_t i = begin; i < end; i++)
+		{
+			Contact& contact = contacts[i];
+			while (previous < previousContacts.size() && previousContacts[previous].key < contact.key)
+				++previous;
+
+			if (previous == previousContacts.size())
+				break;
+
+			const Contact& previous_contact = previousContacts[previous];
+			if (previous_contact.key == contact.key && previous_contact.normal == contact.normal)
+			{
+				contact.normalImpulse = previous_contact.normalImpulse;
+				contact.tangentImpulse = previous_contact.tangentImpulse;
+			}
+		}
+	});
+}
+
+void PhysicsWorld::MergeContactRuns(WorkerPool* _workers)
+{
+	// The runs moved next to each other, at the sum of the lengths of the runs before them
+	const std::size_t run_count = contactRuns.size() - 1;
+	for (std::size_t run = 0; run < run_count; run++)
+		contactRuns[run + 1] += contactRuns[run];
+
+	mergedContacts.resize(contactRuns.back());
+	RunTasks(_workers, run_count, [&](const std::size_t _run)
+	{
+		const auto first = contacts.begin() + static_cast<std::ptrdiff_t>(_run * PairsPerTask);
+		std::copy(first, first + (contactRuns[_run + 1] - contactRuns[_run]), mergedContacts.begin() + contactRuns[_run]);
+	});
+	std::swap(contacts, mergedContacts);
+
+	// Keys are unique, any order of the merges sorts the contacts the same way
+	for (std::size_t width = 1; width < run_count; width *= 2)
+	{
+		mergedContacts.resize(contacts.size());
+		RunTasks(_workers, (run_count + 2 * width - 1) / (2 * width), [&](const std::size_t _task)
+		{
+			const std::size_t first_run = _task * 2 * width;
+			const auto begin = contacts.begin() + contactRuns[first_run];
+			const auto middle = contacts.begin() + contactRuns[std::min(first_run + width, run_count)];
+			const auto end = contacts.begin() + contactRuns[std::min(first_run + 2 * width, run_count)];
+			std::merge(begin, middle, middle, end, mergedContacts.begin() + contactRuns[first_run],
+				[](const Contact& _lhs, const Contact& _rhs) { return _lhs.key < _rhs.key; });
+		});
+		std::swap(contacts, mergedContacts);
+	}
+}
+
+bool PhysicsWorld::MakeContact(const CollisionPair& _pair, const float _delta_time, Contact& _contact) const
+{
+	// Triggers are only reported to the callbacks
+	if (collisionWorld.GetFilter(_pair.a).isTrigger || collisionWorld.GetFilter(_pair.b).isTrigger)
+		return false;
+
+	BodyId id_a = GetColliderBody(_pair.a);
+	BodyId id_b = GetColliderBody(_pair.b);
+
+	// Sleeping bodies left are only touched by static colliders and other sleeping bodies
+	if (id_a != InvalidBody && !IsAwake(id_a))
+		id_a = InvalidBody;
+	if (id_b != InvalidBody && !IsAwake(id_b))
+		id_b = InvalidBody;
+
+	const float inverse_mass_a = id_a != InvalidBody ? bodies[id_a].inverseMass : 0.0f;
+	const float inverse_mass_b = id_b != InvalidBody ? bodies[id_b].inverseMass : 0.0f;
+	if (inverse_mass_a + inverse_mass_b <= 0.0f)
+		return false;
+
+	// The axis of least overlap pushes the boxes apart the shortest way
+	const Maths::Rectf& bounds_a = collisionWorld.GetBounds(_pair.a);
+	const Maths::Rectf& bounds_b = collisionWorld.GetBounds(_pair.b);
+	const float overlap_x = std::min(bounds_a.max.x, bounds_b.max.x) - std::max(bounds_a.min.x, bounds_b.min.x);
+	const float overlap_y = std::min(bounds_a.max.y, bounds_b.max.y) - std::max(bounds_a.min.y, bounds_b.min.y);
+	if (overlap_x <= 0.0f || overlap_y <= 0.0f)
+		return false;
+
+	_contact = Contact();
+	_contact.key = _pair.GetKey();
+	_contact.bodyA = id_a;
+	_contact.bodyB = id_b;
+	_contact.normalMass = 1.0f / (inverse_mass_a + inverse_mass_b);
+
+	const Maths::Vector2f center_delta = bounds_b.GetCenter() - bounds_a.GetCenter();
+	if (overlap_x < overlap_y)
+	{
+		_contact.normal = Maths::Vector2f(center_delta.x < 0.0f ? -1.0f : 1.0f, 0.0f);
+		_contact.depth = overlap_x;
+	}
+	else
+	{
+		_contact.normal = Maths::Vector2f(0.0f, center_delta.y < 0.0f ? -1.0f : 1.0f);
+		_contact.depth = overlap_y;
+	}
+
+	// A collider without body takes the settings of the body it touches
+	const Rigidbody2D* rigidbody_a = id_a != InvalidBody ? bodies[id_a].rigidbody : bodies[id_b].rigidbody;
+	const Rigidbody2D* rigidbody_b = id_b != InvalidBody ? bodies[id_b].rigidbody : bodies[id_a].rigidbody;
+	_contact.friction = std::sqrt(rigidbody_a->GetFriction() * rigidbody_b->GetFriction());
+	_contact.restitution = std::max(rigidbody_a->GetRestitution(), rigidbody_b->GetRestitution());
+
+	const Maths::Vector2f velocity_a = id_a != InvalidBody ? bodies[id_a].velocity : Maths::Vector2f::Zero;
+	const Maths::Vector2f velocity_b = id_b != InvalidBody ? bodies[id_b].velocity : Maths::Vector2f::Zero;
+	const float normal_speed = (velocity_b - velocity_a).Dot(_contact.normal);
+
+	_contact.velocityBias = normal_speed < -RestitutionThreshold ? -_contact.restitution * normal_speed : 0.0f;
+	_contact.depthBias = Baumgarte / _delta_time * std::max(_contact.depth - LinearSlop, 0.0f);
+
+	return true;
+}
+
+void PhysicsWorld::BuildIslands(WorkerPool* _workers)
+{
+	// Union-find over the awake dynamic bodies, kinematic bodies and colliders do not link islands
+	for (const BodyId id : awakeBodies)
+		bodies[id].islandParent = id;
+
+	for (const Contact& contact : contacts)
+	{
+		if (contact.bodyA == InvalidBody || contact.bodyB == InvalidBody)
+			continue;
+		if (bodies[contact.bodyA].inverseMass <= 0.0f || bodies[contact.bodyB].inverseMass <= 0.0f)
+			continue;
+
+		const std::uint32_t root_a = FindIsland(contact.bodyA);
+		const std::uint32_t root_b = FindIsland(contact.bodyB);
+		if (root_a != root_b)
+			bodies[std::max(root_a, root_b)].islandParent = std::min(root_a, root_b);
+	}
+
+	// Counted, then grouped, the islands in the order of their first body. Every body then points to its root
+	islands.clear();
+	for (const BodyId id : awakeBodies)
+	{
+		const std::uint32_t root_id = FindIsland(id);
+		Body& root = bodies[root_id];
+		if (root.island == InvalidIndex)
+		{
+			root.island = static_cast<std::uint32_t>(islands.size());
+			islands.emplace_back();
+		}
+		++islands[root.island].bodyCount;
+		bodies[id].islandParent = root_id;
+	}
+
+	// The bodies of the contacts are awake, their root is read without changing it
+	contactIslands.resize(contacts.size());
+	RunTasks(_workers, (contacts.size() + PairsPerTask - 1) / PairsPerTask, [&](const std::size_t _task)
+	{
+		const std::size_t end = std::min(contacts.size(), (_task + 1) * PairsPerTask);
+		for (std::size_t i = _task * PairsPerTask; i < end; i++)
+		{
+			const Contact& contact = contacts[i];
+			const BodyId id = contact.bodyA != InvalidBody && bodies[contact.bodyA].inverseMass > 0.0f ? contact.bodyA : contact.bodyB;
+			contactIslands[i] = bodies[bodies[id].islandParent].island;
+		}
+	});
+
+	for (const std::uint32_t island : contactIslands)
+		++islands[island].contactCount;
+
+	// Small islands are grouped into tasks of about the same number of contacts
+	std::uint32_t first_body = 0;
+	std::uint32_t first_contact = 0;
+	std::uint32_t task_contacts = 0;
+	islandTasks.assign(1, 0);
+	for (std::uint32_t index = 0; index < islands.size(); index++)
+	{
+		Island& island = islands[index];
+		island.firstBody = first_body;
+		island.firstContact = first_contact;
+		first_body += island.bodyCount;
+		first_contact += island.contactCount;
+
+		task_contacts += island.contactCount + 1;
+		if (task_contacts >= ContactsPerTask)
+		{
+			islandTasks.push_back(index + 1);
+			task_contacts = 0;
+		}
+
+		island.bodyCount = 0;
+		island.contactCount = 0;
+	}
+	if (islandTasks.back() != islands.size())
+		islandTasks.push_back(static_cast<std::uint32_t>(islands.size()));
+
+	islandBodies.resize(first_body);
+	islandContacts.resize(first_contact);
+
+	for (const BodyId id : awakeBodies)
+	{
+		Island& island = islands[bodies[bodies[id].islandParent].island];
+		islandBodies[island.firstBody + island.bodyCount++] = id;
+	}
+
+	for (std::uint32_t index = 0; index < contacts.size(); index++)
+	{
+		Island& island = islands[contactIslands[index]];
+		islandContacts[island.firstContact + island.contactCount++] = index;
+	}
+
+	for (const BodyId id : awakeBodies)
+		bodies[id].island = InvalidIndex;
+}
+
+void PhysicsWorld::SolveIsland(const Island& _island)
+{
+	const std::uint32_t* first = islandContacts.data() + _island.firstContact;
+	const std::uint32_t* last = first + _island.contactCount;
+
+	// Kinematic bodies may touch several islands, only dynamic bodies are written
+	const auto apply = [&](const Contact& _contact, const Maths::Vector2f& _impulse, Maths::Vector2f Body::* _velocity)
+	{
+		if (_contact.bodyA != InvalidBody && bodies[_contact.bodyA].inverseMass > 0.0f)
+			bodies[_contact.bodyA].*_velocity -= _impulse * bodies[_contact.bodyA].inverseMass;
+		if (_contact.bodyB != InvalidBody && bodies[_contact.bodyB].inverseMass > 0.0f)
+			bodies[_contact.bodyB].*_velocity += _impulse * bodies[_contact.bodyB].inverseMass;
+	};
+
+	const auto relative_velocity = [&](const Contact& _contact, Maths::Vector2f Body::* _velocity)
+	{
+		const Maths::Vector2f velocity_a = _contact.bodyA != InvalidBody ? bodies[_contact.bodyA].*_velocity : Maths::Vector2f::Zero;
+		const Maths::Vector2f velocity_b = _contact.bodyB != InvalidBody ? bodies[_contact.bodyB].*_velocity : Maths::Vector2f::Zero;
+		return velocity_b - velocity_a;
+	};
+
+	for (const std::uint32_t* index = first; index != last; ++index)
+	{
+		const Contact& contact = contacts[*index];
+		const Maths::Vector2f tangent(-contact.normal.y, contact.normal.x);
+		apply(contact, contact.normal * contact.normalImpulse + tangent * contact.tangentImpulse, &Body::velocity);
+	}
+
+	for (int iteration = 0; iteration < velocityIterations; iteration++)
+	{
+		for (const std::uint32_t* index = first; index != last; ++index)
+		{
+			Contact& contact = contacts[*index];
+			const Maths::Vector2f tangent(-contact.normal.y, contact.normal.x);
+
+			// Friction first, bounded by the normal impulse of the previous iteration
+			const float max_friction = contact.friction * contact.normalImpulse;
+			const float tangent_speed = relative_velocity(contact, &Body::velocity).Dot(tangent);
+			const float tangent_impulse = std::clamp(contact.tangentImpulse - tangent_speed * contact.normalMass, -max_friction, max_friction);
+			apply(contact, tangent * (tangent_impulse - contact.tangentImpulse), &Body::velocity);
+			contact.tangentImpulse = tangent_impulse;
+
+			// Accumulated, the total impulse only pushes the bodies apart
+			const float normal_speed = relative_velocity(contact, &Body::velocity).Dot(contact.normal);
+			const float normal_impulse = std::max(contact.normalImpulse + (contact.velocityBias - normal_speed) * contact.normalMass, 0.0f);
+			apply(contact, contact.normal * (normal_impulse - contact.normalImpulse), &Body::velocity);
+			contact.normalImpulse = normal_impulse;
+
+			// The same on the bias velocities, the speed added to correct the depth is not kept after the step
+			const float bias_speed = relative_velocity(contact, &Body::biasVelocity).Dot(contact.normal);
+			const float depth_impulse = std::max(contact.depthImpulse + (contact.depthBias - bias_speed) * contact.normalMass, 0.0f);
+			apply(contact, contact.normal * (depth_impulse - contact.depthImpulse), &Body::biasVelocity);
+			contact.depthImpulse = depth_impulse;
+		}
+	}
+}
+
+void PhysicsWorld::IntegratePositions(const float _delta_time, WorkerPool* _workers)
+{
+	const auto is_swept = [](const Body& _body, const Maths::Vector2f& _move)
+	{
+		return _body.collider && _body.rigidbody->IsContinuous()
+			&& (std::abs(_move.x) * 2.0f > _body.collider->GetWidth() || std::abs(_move.y) * 2.0f > _body.collider->GetHeight());
+	};
+
+	const auto move_body = [&](Body& _body, const Maths::Vector2f& _move)
+	{
+		_body.biasVelocity = Maths::Vector2f::Zero;
+		if (_move == Maths::Vector2f::Zero)
+			return;
+
+		GameObject* owner = _body.rigidbody->GetOwner();
+		owner->SetPosition(owner->GetPosition() + _move);
+	};
+
+	// The sweeps only read the collision world, still at the start of the step, each task queries it into its own list
+	const std::size_t task_count = (awakeBodies.size() + BodiesPerTask - 1) / BodiesPerTask;
+	if (sweepTaskResults.size() < task_count)
+		sweepTaskResults.resize(task_count);
+
+	RunTasks(_workers, task_count, [&](const std::size_t _task)
+	{
+		const std::size_t end = std::min(awakeBodies.size(), (_task + 1) * BodiesPerTask);
+		for (std::size_t i = _task * BodiesPerTask; i < end; i++)
+		{
+			Body& body = bodies[awakeBodies[i]];
+			Maths::Vector2f move = (body.velocity + body.biasVelocity) * _delta_time;
+			if (is_swept(body, move))
+				SweepBody(awakeBodies[i], move, sweepTaskResults[_task]);
+			move_body(body, move);
+		}
+	});
+}
+
+void PhysicsWorld::SweepBody(const BodyId _id, Maths::Vector2f& _move, std::vector<SquareCollider*>& _results)
+{
+	Body& body = bodies[_id];
+
+	// Bounds at the start of the step, the other bodies are seen where they were too whatever the order of the moves
+	const Maths::Rectf& bounds = collisionWorld.GetBounds(body.colliderId);
+	const Maths::Vector2f half_size = bounds.GetSize() * 0.5f;
+	const Maths::Vector2f center = bounds.GetCenter();
+	const CollisionFilter& filter = collisionWorld.GetFilter(body.colliderId);
+	if (filter.isTrigger)
+		return;
+
+	collisionWorld.QueryRect(bounds.Union(bounds.Translate(_move)), _results, filter.mask);
+
+	float fraction = 1.0f;
+	Maths::Vector2f normal;
+	for (const SquareCollider* collider : _results)
+	{
+		const ColliderId id = collider->GetColliderId();
+		if (id == body.colliderId)
+			continue;
+
+		// Same filter as the pairs, the body goes through what it would not collide with
+		const CollisionFilter& other_filter = collisionWorld.GetFilter(id);
+		if (other_filter.isTrigger || !filter.Accepts(other_filter))
+			continue;
+
+		// Awake dynamic bodies move too and are left to the contacts
+		const BodyId other = GetColliderBody(id);
+		if (other != InvalidBody && IsAwake(other) && bodies[other].inverseMass > 0.0f)
+			continue;
+
+		// The center of the body against the other box grown by the half size of the body
+		const Maths::Rectf& other_bounds = collisionWorld.GetBounds(id);
+		const Maths::Rectf grown(other_bounds.min - half_size, other_bounds.max + half_size);
+		SegmentEnters(grown, center, _move, fraction, normal);
+	}
+
+	if (fraction >= 1.0f)
+		return;
+
+	_move *= fraction;
+
+	const float normal_speed = body.velocity.Dot(normal);
+	if (normal_speed < 0.0f)
+		body.velocity -= normal * (normal_speed * (1.0f + body.rigidbody->GetRestitution()));
+}
+
+void PhysicsWorld::UpdateSleep(const float _delta_time, WorkerPool* _workers)
+{
+	const float tolerance_squared = SleepTolerance * SleepTolerance;
+
+	// The same tasks as the solver, the islands falling asleep are then moved out of the awake bodies one by one
+	RunTasks(_workers, islandTasks.size() - 1, [&](const std::size_t _task)
+	{
+		for (std::uint32_t index = islandTasks[_task]; index < islandTasks[_task + 1]; index++)
+		{
+			Island& island = islands[index];
+			const BodyId* first = islandBodies.data() + island.firstBody;
+			const BodyId* last = first + island.bodyCount;
+
+			float min_sleep_time = TimeToSleep;
+			for (const BodyId* id = first; id != last; ++id)
+			{
+				Body& body = bodies[*id];
+				if (!body.rigidbody->IsSleepAllowed() || body.velocity.MagnitudeSquared() > tolerance_squared)
+					body.sleepTime = 0.0f;
+				else
+					body.sleepTime += _delta_time;
+
+				min_sleep_time = std::min(min_sleep_time, body.sleepTime);
+			}
+			island.fallsAsleep = min_sleep_time >= TimeToSleep;
+		}
+	});
+
+	for (const Island& island : islands)
+	{
+		if (!island.fallsAsleep)
+			continue;
+
+		const BodyId* first = islandBodies.data() + island.firstBody;
+		const BodyId* last = first + island.bodyCount;
+
+		std::uint32_t sleeping_island;
+		if (!freeSleepingIslands.empty())
+		{
+			sleeping_island = freeSleepingIslands.back();
+			freeSleepingIslands.pop_back();
+		}
+		else
+		{
+			sleeping_island = static_cast<std::uint32_t>(sleepingIslands.size());
+			sleepingIslands.emplace_back();
+		}
+
+		// Static in the collision world, its bounds are not read until it wakes up
+		for (const BodyId* id = first; id != last; ++id)
+		{
+			Body& body = bodies[*id];
+			body.velocity = Maths::Vector2f::Zero;
+			body.sleepingIsland = sleeping_island;
+			sleepingIslands[sleeping_island].push_back(*id);
+
+			const BodyId moved = awakeBodies.back();
+			awakeBodies[body.awakeIndex] = moved;
+			bodies[moved].awakeIndex = body.awakeIndex;
+			awakeBodies.pop_back();
+			body.awakeIndex = InvalidIndex;
+
+			if (body.collider)
+				collisionWorld.SetStatic(body.colliderId, true);
+		}
+	}
+}
+
+void PhysicsWorld::RunTasks(WorkerPool* _workers, const std::size_t _count, const std::function<void(std::size_t)>& _task)
+{
+	if (_workers)
+	{
+		_workers->ParallelFor(_count, _task);
+		return;
+	}
+
+	for (std::size_t i = 0; i < _count; i++)
+		_task(i);
+}
+
+std::uint32_t PhysicsWorld::FindIsland(BodyId _id)
+{
+	// Path halving, every other body points to its grandparent
+	while (bodies[_id].islandParent != _id)
+	{
+		bodies[_id].islandParent = bodies[bodies[_id].islandParent].islandParent;
+		_id = bodies[_id].islandParent;
+	}
+	return _id;
+}
@@ -0,0 +1,364 @@
+#include "Physics/SweepAndPrune.h"
+
+#include <algorithm>
+#include <iterator>
+
+void SweepAndPrune::Add(const ColliderId _id, const Maths::Rectf& _bounds, const CollisionFilter& _filter)
+{
+	if (_id >= boxes.size())
+		boxes.resize(static_cast<std::size_t>(_id) + 1);
+
+	Box& box = boxes[_id];
+	box.bounds = _bounds;
+	box.filter = _filter;
+	box.state = Box::State::Adding;
+	adding.push_back(_id);
+}
+
+void SweepAndPrune::SetFilter(const ColliderId _id, const CollisionFilter& _filter)
+{
+	Box& box = boxes[_id];
+	box.filter = _filter;
+
+	// A box not inserted yet finds its pairs with the new filter anyway
+	if (box.state == Box::State::Inserted)
+	{
+		box.state = Box::State::Removing;
+		box.reinsert = true;
+		removing.push_back(_id);
+	}
+}
+
+void SweepAndPrune::Remove(const ColliderId _id)
+{
+	Box& box = boxes[_id];
+	box.reinsert = false;
+	if (box.state == Box::State::Adding)
+	{
+		// Searched from the end, the last boxes added are usually the first removed, as when a scene is deleted
+		adding.erase(std::prev(std::find(adding.rbegin(), adding.rend(), _id).base()));
+		box.state = Box::State::Free;
+	}
+	else if (box.state == Box::State::Inserted)
+	{
+		box.state = Box::State::Removing;
+		removing.push_back(_id);
+	}
+}
+
+void SweepAndPrune::Move(const ColliderId _id, const Maths::Rectf& _bounds)
+{
+	Box& box = boxes[_id];
+	if (box.state != Box::State::Inserted)
+	{
+		// Read when the box is inserted, or inserted again after a new filter
+		if (box.state != Box::State::Free)
+			box.bounds = _bounds;
+		return;
+	}
+
+	box.bounds = _bounds;
+	maxWidth = std::max(maxWidth, _bounds.max.x - _bounds.min.x);
+
+	for (int axis = 0; axis < 2; axis++)
+	{
+		const float new_min = axis == 0 ? _bounds.min.x : _bounds.min.y;
+		const float new_max = axis == 0 ? _bounds.max.x : _bounds.max.y;
+
+		Endpoint& min = endpoints[axis][box.min[axis]];
+		Endpoint& max = endpoints[axis][box.max[axis]];
+		const float old_min = min.value;
+		const float old_max = max.value;
+		min.value = new_min;
+		max.value = new_max;
+
+		// The side in front first, so the min does not pass the max of its own box
+		if (new_min < old_min)
+			SortDown(axis, box.min[axis]);
+		if (new_max < old_max)
+			SortDown(axis, box.max[axis]);
+		if (new_max > old_max)
+			SortUp(axis, box.max[axis]);
+		if (new_min > old_min)
+			SortUp(axis, box.min[axis]);
+	}
+}
+
+void SweepAndPrune::Update()
+{
+	if (!removing.empty())
+		PurgeRemoved();
+
+	if (adding.empty())
+		return;
+
+	for (const ColliderId id : adding)
+		boxes[id].state = Box::State::Inserted;
+
+	// Past a few boxes, as when a scene is loaded, sorting them all again finds the pairs in one sweep
+	const std::size_t inserted = endpoints[0].size() / 2;
+	if (adding.size() > inserted / 16 + 8)
+		Rebuild();
+	else
+		InsertAdded();
+	adding.clear();
+}
+
+void SweepAndPrune::Clear()
+{
+	boxes.clear();
+	endpoints[0].clear();
+	endpoints[1].clear();
+	adding.clear();
+	removing.clear();
+	pairs.clear();
+	pairIndices.clear();
+	maxWidth = 0.0f;
+}
+
+void SweepAndPrune::SortDown(const int _axis, std::uint32_t _index)
+{
+	std::vector<Endpoint>& list = endpoints[_axis];
+	const Endpoint moving = list[_index];
+
+	while (_index > 0 && IsBefore(moving, list[_index - 1]))
+	{
+		const Endpoint& previous = list[_index - 1];
+
+		// A min passing a max may start an overlap, a max passing a min may end one
+		if (moving.IsMax() != previous.IsMax())
+			OnSwap(moving.GetId(), previous.GetId());
+
+		list[_index] = previous;
+		SetEndpointIndex(_axis, previous, _index);
+		--_index;
+		++swapCount;
+	}
+
+	list[_index] = moving;
+	SetEndpointIndex(_axis, moving, _index);
+}
+
+void SweepAndPrune::SortUp(const int _axis, std::uint32_t _index)
+{
+	std::vector<Endpoint>& list = endpoints[_axis];
+	const Endpoint moving = list[_index];
+
+	while (_index + 1 < list.size() && IsBefore(list[_index + 1], moving))
+	{
+		const Endpoint& next = list[_index + 1];
+
+		if (moving.IsMax() != next.IsMax())
+			OnSwap(moving.GetId(), next.GetId());
+
+		list[_index] = next;
+		SetEndpointIndex(_axis, next, _index);
+		++_index;
+		++swapCount;
+	}
+
+	list[_index] = moving;
+	SetEndpointIndex(_axis, moving, _index);
+}
+
+void SweepAndPrune::OnSwap(const ColliderId _moving, const ColliderId _other)
+{
+	if (_moving == _other || boxes[_other].state != Box::State::Inserted)
+		return;
+
+	// Filtered pairs were never added, nothing to remove either
+	if (!boxes[_moving].filter.Accepts(boxes[_other].filter))
+		return;
+
+	// Decided from the bounds rather than from the side that swapped, boxes moving
+	// the same frame are seen with their endpoints partly sorted
+	if (boxes[_moving].bounds.Overlaps(boxes[_other].bounds))
+		AddPair(_moving, _other);
+	else
+		RemovePair(_moving, _other);
+}
+
+void SweepAndPrune::SetEndpointIndex(const int _axis, const Endpoint& _endpoint, const std::uint32_t _index)
+{
+	Box& box = boxes[_endpoint.GetId()];
+	(_endpoint.IsMax() ? box.max : box.min)[_axis] = _index;
+}
+
+void SweepAndPrune::AddPair(const ColliderId _first, const ColliderId _second)
+{
+	const CollisionPair pair = CollisionPair::Make(_first, _second);
+	if (pairIndices.try_emplace(pair.GetKey(), static_cast<std::uint32_t>(pairs.size())).second)
+		pairs.push_back(pair);
+}
+
+void SweepAndPrune::RemovePair(const ColliderId _first, const ColliderId _second)
+{
+	const std::unordered_map<std::uint64_t, std::uint32_t>::iterator it = pairIndices.find(CollisionPair::Make(_first, _second).GetKey());
+	if (it == pairIndices.end())
+		return;
+
+	const std::uint32_t index = it->second;
+	pairIndices.erase(it);
+
+	if (index + 1 != pairs.size())
+	{
+		pairs[index] = pairs.back();
+		pairIndices[pairs[index].GetKey()] = index;
+	}
+	pairs.pop_back();
+}
+
+void SweepAndPrune::InsertAdded()
+{
+	// Merged at their place rather than sorted down one by one, a walk over the endpoints for all of them
+	for (int axis = 0; axis < 2; axis++)
+	{
+		insertedEndpoints.clear();
+		for (const ColliderId id : adding)
+		{
+			const Box& box = boxes[id];
+			insertedEndpoints.push_back({axis == 0 ? box.bounds.min.x : box.bounds.min.y, id << 1});
+			insertedEndpoints.push_back({axis == 0 ? box.bounds.max.x : box.bounds.max.y, id << 1 | 1});
+		}
+		std::sort(insertedEndpoints.begin(), insertedEndpoints.end(), IsBefore);
+
+		std::vector<Endpoint>& list = endpoints[axis];
+		mergedEndpoints.resize(list.size() + insertedEndpoints.size());
+		std::merge(list.begin(), list.end(), insertedEndpoints.begin(), insertedEndpoints.end(), mergedEndpoints.begin(), IsBefore);
+		list.swap(mergedEndpoints);
+
+		for (std::uint32_t i = 0; i < list.size(); i++)
+			SetEndpointIndex(axis, list[i], i);
+	}
+
+	for (const ColliderId id : adding)
+		maxWidth = std::max(maxWidth, boxes[id].bounds.max.x - boxes[id].bounds.min.x);
+
+	// A box overlapping a new one along x starts after its min minus the widest box,
+	// the boxes added together find each other twice and keep one pair
+	const std::vector<Endpoint>& list = endpoints[0];
+	for (const ColliderId id : adding)
+	{
+		const Box& box = boxes[id];
+		const float from = box.bounds.min.x - maxWidth;
+		std::vector<Endpoint>::const_iterator it = std::lower_bound(list.begin(), list.end(), from, [](const Endpoint& _endpoint, const float _value) { return _endpoint.value < _value; });
+
+		for (; it != list.end() && it->value < box.bounds.max.x; ++it)
+		{
+			const ColliderId other = it->GetId();
+			if (it->IsMax() || other == id)
+				continue;
+
+			if (box.filter.Accepts(boxes[other].filter) && box.bounds.Overlaps(boxes[other].bounds))
+				AddPair(id, other);
+		}
+	}
+}
+
+void SweepAndPrune::Rebuild()
+{
+	maxWidth = 0.0f;
+	for (const Box& box : boxes)
+	{
+		if (box.state == Box::State::Inserted)
+			maxWidth = std::max(maxWidth, box.bounds.max.x - box.bounds.min.x);
+	}
+
+	for (int axis = 0; axis < 2; axis++)
+	{
+		std::vector<Endpoint>& list = endpoints[axis];
+		list.clear();
+
+		for (ColliderId id = 0; id < boxes.size(); id++)
+		{
+			const Box& box = boxes[id];
+			if (box.state != Box::State::Inserted)
+				continue;
+
+			list.push_back({axis == 0 ? box.bounds.min.x : box.bounds.min.y, id << 1});
+			list.push_back({axis == 0 ? box.bounds.max.x : box.bounds.max.y, id << 1 | 1});
+		}
+
+		std::sort(list.begin(), list.end(), IsBefore);
+
+		for (std::uint32_t i = 0; i < list.size(); i++)
+			SetEndpointIndex(axis, list[i], i);
+	}
+
+	pairs.clear();
+	pairIndices.clear();
+
+	// One sweep along x, the boxes open at a min are the candidates of the box starting there
+	std::vector<ColliderId> open;
+	std::vector<std::uint32_t> open_indices(boxes.size());
+	for (const Endpoint& endpoint : endpoints[0])
+	{
+		const ColliderId id = endpoint.GetId();
+		if (endpoint.IsMax())
+		{
+			const std::uint32_t index = open_indices[id];
+			open[index] = open.back();
+			open_indices[open[index]] = index;
+			open.pop_back();
+			continue;
+		}
+
+		const Box& box = boxes[id];
+		for (const ColliderId other : open)
+		{
+			if (box.filter.Accepts(boxes[other].filter) && box.bounds.Overlaps(boxes[other].bounds))
+				AddPair(id, other);
+		}
+
+		open_indices[id] = static_cast<std::uint32_t>(open.size());
+		open.push_back(id);
+	}
+}
+
+void SweepAndPrune::PurgeRemoved()
+{
+	for (int axis = 0; axis < 2; axis++)
+	{
+		std::vector<Endpoint>& list = endpoints[axis];
+		std::uint32_t kept = 0;
+		for (std::uint32_t i = 0; i < list.size(); i++)
+		{
+			if (boxes[list[i].GetId()].state == Box::State::Removing)
+				continue;
+
+			list[kept] = list[i];
+			SetEndpointIndex(axis, list[kept], kept);
+			++kept;
+		}
+		list.resize(kept);
+	}
+
+	std::uint32_t kept = 0;
+	for (std::uint32_t i = 0; i < pairs.size(); i++)
+	{
+		const CollisionPair pair = pairs[i];
+		if (boxes[pair.a].state == Box::State::Removing || boxes[pair.b].state == Box::State::Removing)
+		{
+			pairIndices.erase(pair.GetKey());
+			continue;
+		}
+
+		if (kept != i)
+		{
+			pairs[kept] = pair;
+			pairIndices[pair.GetKey()] = kept;
+		}
+		++kept;
+	}
+	pairs.resize(kept);
+
+	for (const ColliderId id : removing)
+	{
+		Box& box = boxes[id];
+		box.state = box.reinsert ? Box::State::Adding : Box::State::Free;
+		if (box.reinsert)
+			adding.push_back(id);
+		box.reinsert = false;
+	}
+	removing.clear();
+}
@@ -1,87 +1,120 @@
 #include "Resources/AResource.h"
 
+#include "Resources/AssetPack.h"
+#include "Modules/ResourcesModule.h"
+
 const std::string AResource::AssetsFolderName = "Assets";
 
 const std::filesystem::path AResource::AssetsFolderPath = std::filesystem::current_path() / AssetsFolderName;
 
+const AssetPack* AResource::assetPack = nullptr;
+
 AResource::AResource() {}
 
-AResource::AResource(const AResource& _other) : path(_other.path), refCount(_other.refCount)
-{
-	IncreaseRefCount();
-}
+AResource::~AResource() {}
 
-AResource::AResource(AResource&& _other) noexcept : path(std::move(_other.path)), refCount(_other.refCount)
+bool AResource::Exists(const std::string& _name)
 {
-	_other.refCount = nullptr;
+	if (assetPack && assetPack->Contains(_name))
+		return true;
+
+	const std::filesystem::path path = GetPathFromName(_name);
+	return exists(path);
 }
 
-AResource& AResource::operator=(const AResource& _other)
+bool AResource::Load(const std::string& _path)
 {
-	if (this != &_other)
-	{
-		DecreaseRefCount();
-		refCount = _other.refCount;
-		path = _other.path;
-		IncreaseRefCount();
-	}
-	return *this;
+	return false;
 }
 
-AResource& AResource::operator=(AResource&& _other) noexcept
+bool AResource::LoadFromMemory(const void* _data, const std::size_t _size)
 {
-	if (this != &_other)
-	{
-		DecreaseRefCount();
-		refCount = _other.refCount;
-		path = std::move(_other.path);
-		_other.refCount = nullptr;
-	}
-	return *this;
+	return false;
 }
 
-AResource::~AResource()
+void AResource::Unload() {}
+
+bool AResource::DecodeReload(const std::string& _path)
 {
-	DecreaseRefCount();
+	return false;
 }
 
-bool AResource::Exists(const std::string& _name)
+void AResource::ApplyReload() {}
+
+std::size_t AResource::GetMemorySize() const
 {
-	const std::filesystem::path path = GetPathFromName(_name);
-	return exists(path);
+	return 0;
 }
 
-bool AResource::Load(const std::string& _path)
+unsigned int AResource::GetRefCount() const
 {
-	return false;
+	return refCount.load(std::memory_order_relaxed);
 }
 
-void AResource::Unload() {}
-
-unsigned int AResource::GetRefCount() const
+void AResource::AddRef() noexcept
 {
-	return refCount ? *refCount : 0;
+	refCount.fetch_add(1, std::memory_order_relaxed);
 }
 
-void AResource::IncreaseRefCount() noexcept
+bool AResource::TryAddRef() noexcept
 {
-	if (refCount)
-		++(*refCount);
-	else
-		refCount = new unsigned int(1);
+	unsigned int count = refCount.load(std::memory_order_relaxed);
+	do
+	{
+		if (count == 0)
+			return false;
+	}
+	while (!refCount.compare_exchange_weak(count, count + 1, std::memory_order_acquire, std::memory_order_relaxed));
+
+	return true;
 }
 
-void AResource::DecreaseRefCount() noexcept
+void AResource::Release() noexcept
 {
-	if (refCount && --(*refCount) == 0)
+	// Read while still referenced, a resource revived by AddRef() may be evicted and deleted as soon as the count reaches 0
+	ResourcesModule* const owner = cache.load(std::memory_order_acquire);
+
+	unsigned int count = refCount.load(std::memory_order_relaxed);
+	do
+	{
+		if (count == 0)
+			return;
+	}
+	while (!refCount.compare_exchange_weak(count, count - 1, std::memory_order_acq_rel, std::memory_order_relaxed));
+
+	if (count != 1)
+		return;
+
+	// Left by a finalized cache, nothing evicts the resource anymore
+	if (!owner || !owner->QueueRelease(this))
 	{
 		Unload();
-		delete refCount;
-		refCount = nullptr;
+		ReleaseWeakRef();
 	}
 }
 
+void AResource::AddWeakRef() noexcept
+{
+	weakCount.fetch_add(1, std::memory_order_relaxed);
+}
+
+void AResource::ReleaseWeakRef() noexcept
+{
+	if (weakCount.fetch_sub(1, std::memory_order_acq_rel) == 1)
+		delete this;
+}
+
 AResource::Path AResource::GetPathFromName(const std::string& _name)
 {
 	return AssetsFolderPath / _name;
 }
+
+void AResource::SetAssetPack(const AssetPack* _asset_pack)
+{
+	assetPack = _asset_pack;
+}
+
+const AssetPack* AResource::GetAssetPack()
+{
+	return assetPack;
+}
@@ -0,0 +1,27 @@
+#include "Resources/AnimatedTileSet.h"
+
+const AnimationClip* AnimatedTileSet::AddClip(const std::string& _name, const sf::IntRect& _rect, const sf::Vector2i& _size, const sf::Vector2i& _offset, const bool _loop)
+{
+	AddSprites(_name, _rect, _size, _offset);
+
+	AnimationClip clip;
+	clip.frameDuration = speed;
+	clip.loop = _loop;
+
+	// Same names and order as AddSprites, the sprites stay in place in their map
+	for (int y = 0; y < _size.y; y++)
+	{
+		for (int x = 0; x < _size.x; x++)
+			clip.frames.push_back(GetSprite(_name + "_" + std::to_string(x) + "_" + std::to_string(y)));
+	}
+
+	return &clips.insert_or_assign(_name, std::move(clip)).first->second;
+}
+
+const AnimationClip* AnimatedTileSet::GetClip(const std::string& _name) const
+{
+	if (const std::unordered_map<std::string, AnimationClip>::const_iterator it = clips.find(_name); it != clips.end())
+		return &it->second;
+
+	return nullptr;
+}
@@ -0,0 +1,314 @@
+#include "Resources/AssetPack.h"
+
+#include <algorithm>
+#include <fstream>
+
+#include "Resources/Lz4.h"
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace
+{
+	/// Bytes an LZ4 byte decompresses to at most, a length byte of 255 adds 255 bytes.
+	constexpr std::uint64_t MaxExpansion = 255;
+
+	/// Bytes of a block decompressed beyond the expansion of its bytes, the match length left in its token.
+	constexpr std::uint64_t ExpansionSlack = 64;
+}
+
+// The header and the table of contents are read in place from the mapping
+static_assert(sizeof(AssetPack::Header) == 32, "AssetPack::Header layout changed, bump AssetPack::Version");
+static_assert(sizeof(AssetPack::TocEntry) == 48, "AssetPack::TocEntry layout changed, bump AssetPack::Version");
+
+AssetPack::~AssetPack()
+{
+	Close();
+}
+
+bool AssetPack::Open(const std::filesystem::path& _path)
+{
+	Close();
+
+	if (!Map(_path))
+		return false;
+
+	header = reinterpret_cast<const Header*>(mappedData);
+
+	const bool valid_header = mappedSize >= sizeof(Header) && header->magic == Magic && header->version == Version;
+	const bool valid_toc = valid_header && header->tocOffset <= mappedSize && header->entryCount <= (mappedSize - header->tocOffset) / sizeof(TocEntry);
+	const bool valid_names = valid_toc && header->namesOffset <= mappedSize;
+
+	if (!valid_names)
+	{
+		Close();
+		return false;
+	}
+
+	toc = reinterpret_cast<const TocEntry*>(mappedData + header->tocOffset);
+	names = reinterpret_cast<const char*>(mappedData + header->namesOffset);
+	return true;
+}
+
+void AssetPack::Close()
+{
+#ifdef _WIN32
+	if (mappedData)
+		UnmapViewOfFile(mappedData);
+	if (mappingHandle)
+		CloseHandle(mappingHandle);
+	if (fileHandle)
+		CloseHandle(fileHandle);
+	mappingHandle = nullptr;
+	fileHandle = nullptr;
+#else
+	if (mappedData)
+		munmap(const_cast<std::uint8_t*>(mappedData), mappedSize);
+#endif
+
+	mappedData = nullptr;
+	mappedSize = 0;
+	header = nullptr;
+	toc = nullptr;
+	names = nullptr;
+}
+
+bool AssetPack::Contains(const std::string& _name) const
+{
+	return FindEntry(_name) != nullptr;
+}
+
+bool AssetPack::GetData(const std::string& _name, const void*& _data, std::size_t& _size, std::vector<std::uint8_t>& _buffer) const
+{
+	const TocEntry* entry = FindEntry(_name);
+	if (!entry || entry->dataOffset > mappedSize || entry->size > mappedSize - entry->dataOffset)
+		return false;
+
+	const std::uint8_t* blob = mappedData + entry->dataOffset;
+
+	if (!(entry->flags & Compressed))
+	{
+		_data = blob;
+		_size = static_cast<std::size_t>(entry->size);
+		return true;
+	}
+
+	// Read from the file, a corrupted size must not allocate more than the block could decompress to
+	if (entry->uncompressedSize > entry->size * MaxExpansion + ExpansionSlack)
+		return false;
+
+	_buffer.resize(static_cast<std::size_t>(entry->uncompressedSize));
+	if (!Lz4::Decompress(blob, static_cast<std::size_t>(entry->size), _buffer.data(), _buffer.size()))
+		return false;
+
+	_data = _buffer.data();
+	_size = _buffer.size();
+	return true;
+}
+
+std::uint32_t AssetPack::GetEntryCount() const
+{
+	return header ? header->entryCount : 0;
+}
+
+std::uint64_t AssetPack::HashName(const std::string& _name)
+{
+	std::uint64_t hash = 14695981039346656037ull;
+	for (const char character : _name)
+	{
+		hash ^= static_cast<std::uint8_t>(character == '\\' ? '/' : character);
+		hash *= 1099511628211ull;
+	}
+	return hash;
+}
+
+bool AssetPack::Build(const std::filesystem::path& _folder, const std::filesystem::path& _output, const bool _compress)
+{
+	std::error_code error;
+	if (!std::filesystem::is_directory(_folder, error))
+		return false;
+
+	std::vector<std::string> asset_names;
+	for (const std::filesystem::directory_entry& file : std::filesystem::recursive_directory_iterator(_folder, error))
+	{
+		if (file.is_regular_file())
+			asset_names.push_back(std::filesystem::relative(file.path(), _folder).generic_string());
+	}
+
+	std::sort(asset_names.begin(), asset_names.end(), [](const std::string& _lhs, const std::string& _rhs)
+	{
+		const std::uint64_t lhs_hash = HashName(_lhs);
+		const std::uint64_t rhs_hash = HashName(_rhs);
+		return lhs_hash != rhs_hash ? lhs_hash < rhs_hash : _lhs < _rhs;
+	});
+
+	std::ofstream file(_output, std::ios::binary | std::ios::trunc);
+	if (!file)
+		return false;
+
+	Header pack_header;
+	pack_header.entryCount = static_cast<std::uint32_t>(asset_names.size());
+	file.write(reinterpret_cast<const char*>(&pack_header), sizeof(pack_header));
+
+	std::vector<TocEntry> entries(asset_names.size());
+	std::string names_table;
+	std::vector<std::uint8_t> content;
+	std::vector<std::uint8_t> compressed;
+	std::uint64_t offset = sizeof(Header);
+
+	const auto align = [&file, &offset]()
+	{
+		static constexpr char zeros[Alignment] = {};
+		const std::uint64_t padding = (Alignment - offset % Alignment) % Alignment;
+		file.write(zeros, static_cast<std::streamsize>(padding));
+		offset += padding;
+	};
+
+	for (std::size_t i = 0; i < asset_names.size(); i++)
+	{
+		std::ifstream asset(_folder / asset_names[i], std::ios::binary | std::ios::ate);
+		if (!asset)
+			return false;
+
+		content.resize(static_cast<std::size_t>(asset.tellg()));
+		asset.seekg(0);
+		asset.read(reinterpret_cast<char*>(content.data()), static_cast<std::streamsize>(content.size()));
+
+		TocEntry& entry = entries[i];
+		entry.nameHash = HashName(asset_names[i]);
+		entry.nameOffset = static_cast<std::uint32_t>(names_table.size());
+		entry.nameLength = static_cast<std::uint32_t>(asset_names[i].size());
+		entry.uncompressedSize = content.size();
+		names_table += asset_names[i];
+
+		const std::uint8_t* blob = content.data();
+		entry.size = content.size();
+
+		if (_compress && !content.empty())
+		{
+			compressed.resize(Lz4::CompressBound(content.size()));
+			const std::size_t compressed_size = Lz4::Compress(content.data(), content.size(), compressed.data(), compressed.size());
+
+			// Already compressed formats (png, ogg...) rarely shrink, keep them zero-copy
+			if (compressed_size > 0 && compressed_size < content.size() - content.size() / 8)
+			{
+				blob = compressed.data();
+				entry.size = compressed_size;
+				entry.flags |= Compressed;
+			}
+		}
+
+		align();
+		entry.dataOffset = offset;
+		file.write(reinterpret_cast<const char*>(blob), static_cast<std::streamsize>(entry.size));
+		offset += entry.size;
+	}
+
+	align();
+	pack_header.tocOffset = offset;
+	file.write(reinterpret_cast<const char*>(entries.data()), static_cast<std::streamsize>(entries.size() * sizeof(TocEntry)));
+	offset += entries.size() * sizeof(TocEntry);
+
+	pack_header.namesOffset = offset;
+	file.write(names_table.data(), static_cast<std::streamsize>(names_table.size()));
+
+	file.seekp(0);
+	file.write(reinterpret_cast<const char*>(&pack_header), sizeof(pack_header));
+
+	return static_cast<bool>(file);
+}
+
+const AssetPack::TocEntry* AssetPack::FindEntry(const std::string& _name) const
+{
+	if (!header)
+		return nullptr;
+
+	const std::uint64_t hash = HashName(_name);
+	const TocEntry* end = toc + header->entryCount;
+	const TocEntry* entry = std::lower_bound(toc, end, hash, [](const TocEntry& _entry, const std::uint64_t _hash)
+	{
+		return _entry.nameHash < _hash;
+	});
+
+	for (; entry != end && entry->nameHash == hash; ++entry)
+	{
+		if (entry->nameLength != _name.size() || header->namesOffset + entry->nameOffset + entry->nameLength > mappedSize)
+			continue;
+
+		const char* entry_name = names + entry->nameOffset;
+		if (std::equal(_name.begin(), _name.end(), entry_name, [](const char _lhs, const char _rhs)
+		{
+			return (_lhs == '\\' ? '/' : _lhs) == _rhs;
+		}))
+		{
+			return entry;
+		}
+	}
+
+	return nullptr;
+}
+
+bool AssetPack::Map(const std::filesystem::path& _path)
+{
+#ifdef _WIN32
+	fileHandle = CreateFileW(_path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL | FILE_FLAG_RANDOM_ACCESS, nullptr);
+	if (fileHandle == INVALID_HANDLE_VALUE)
+	{
+		fileHandle = nullptr;
+		return false;
+	}
+
+	LARGE_INTEGER file_size;
+	if (!GetFileSizeEx(fileHandle, &file_size) || file_size.QuadPart == 0)
+	{
+		Close();
+		return false;
+	}
+
+	mappingHandle = CreateFileMappingW(fileHandle, nullptr, PAGE_READONLY, 0, 0, nullptr);
+	if (!mappingHandle)
+	{
+		Close();
+		return false;
+	}
+
+	mappedData = static_cast<const std::uint8_t*>(MapViewOfFile(mappingHandle, FILE_MAP_READ, 0, 0, 0));
+	mappedSize = static_cast<std::size_t>(file_size.QuadPart);
+#else
+	const int file_descriptor = open(_path.c_str(), O_RDONLY);
+	if (file_descriptor < 0)
+		return false;
+
+	struct stat file_stat;
+	if (fstat(file_descriptor, &file_stat) != 0 || file_stat.st_size == 0)
+	{
+		close(file_descriptor);
+		return false;
+	}
+
+	void* mapping = mmap(nullptr, static_cast<std::size_t>(file_stat.st_size), PROT_READ, MAP_PRIVATE, file_descriptor, 0);
+	close(file_descriptor);
+
+	if (mapping == MAP_FAILED)
+		return false;
+
+	mappedData = static_cast<const std::uint8_t*>(mapping);
+	mappedSize = static_cast<std::size_t>(file_stat.st_size);
+#endif
+
+	if (!mappedData)
+	{
+		Close();
+		return false;
+	}
+
+	return true;
+}
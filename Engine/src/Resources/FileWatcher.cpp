@@ -0,0 +1,187 @@
+#include "Resources/FileWatcher.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+
+#ifdef __linux__
+#include <poll.h>
+#include <sys/inotify.h>
+#include <unistd.h>
+#endif
+
+FileWatcher::~FileWatcher()
+{
+	Stop();
+}
+
+bool FileWatcher::Start(const std::filesystem::path& _folder)
+{
+	Stop();
+
+	std::error_code error;
+	if (!std::filesystem::is_directory(_folder, error))
+		return false;
+
+	folder = _folder;
+
+#ifdef __linux__
+	inotifyDescriptor = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+	if (inotifyDescriptor < 0)
+		return false;
+
+	AddWatches(folder);
+#else
+	Scan(false);
+#endif
+
+	running = true;
+	thread = std::thread(&FileWatcher::Run, this);
+	return true;
+}
+
+void FileWatcher::Stop()
+{
+	running = false;
+	if (thread.joinable())
+		thread.join();
+
+#ifdef __linux__
+	if (inotifyDescriptor >= 0)
+		close(inotifyDescriptor);
+	inotifyDescriptor = -1;
+	watchedFolders.clear();
+#else
+	writeTimes.clear();
+#endif
+
+	const std::lock_guard<std::mutex> lock(changesMutex);
+	changes.clear();
+}
+
+void FileWatcher::PollChanges(std::vector<std::string>& _names)
+{
+	_names.clear();
+
+	const std::lock_guard<std::mutex> lock(changesMutex);
+	_names.swap(changes);
+}
+
+void FileWatcher::Push(const std::string& _name)
+{
+	const std::lock_guard<std::mutex> lock(changesMutex);
+	if (std::find(changes.begin(), changes.end(), _name) == changes.end())
+		changes.push_back(_name);
+}
+
+#ifdef __linux__
+void FileWatcher::Run()
+{
+	alignas(inotify_event) char buffer[4096];
+
+	while (running)
+	{
+		// Wake up regularly to notice Stop()
+		pollfd descriptor = {inotifyDescriptor, POLLIN, 0};
+		if (poll(&descriptor, 1, 100) <= 0)
+			continue;
+
+		const ssize_t length = read(inotifyDescriptor, buffer, sizeof(buffer));
+		for (ssize_t offset = 0; offset < length;)
+		{
+			const inotify_event* event = reinterpret_cast<const inotify_event*>(buffer + offset);
+			offset += static_cast<ssize_t>(sizeof(inotify_event) + event->len);
+
+			const std::unordered_map<int, std::string>::iterator it = watchedFolders.find(event->wd);
+			if (it == watchedFolders.end())
+				continue;
+
+			if (event->mask & IN_IGNORED)
+			{
+				watchedFolders.erase(it);
+				continue;
+			}
+
+			if (event->len == 0)
+				continue;
+
+			const std::string name = it->second.empty() ? std::string(event->name) : it->second + "/" + event->name;
+
+			if (event->mask & IN_ISDIR)
+			{
+				if (event->mask & (IN_CREATE | IN_MOVED_TO))
+					AddWatches(folder / name);
+			}
+			else if (event->mask & (IN_CLOSE_WRITE | IN_MOVED_TO))
+			{
+				Push(name);
+			}
+		}
+	}
+}
+
+void FileWatcher::AddWatches(const std::filesystem::path& _path)
+{
+	constexpr std::uint32_t mask = IN_CLOSE_WRITE | IN_MOVED_TO | IN_CREATE;
+
+	const int watch = inotify_add_watch(inotifyDescriptor, _path.c_str(), mask);
+	if (watch < 0)
+		return;
+
+	const std::string relative = std::filesystem::relative(_path, folder).generic_string();
+	watchedFolders[watch] = relative == "." ? std::string() : relative;
+
+	std::error_code error;
+	for (const std::filesystem::directory_entry& entry : std::filesystem::directory_iterator(_path, error))
+	{
+		if (entry.is_directory(error))
+			AddWatches(entry.path());
+	}
+}
+#else
+void FileWatcher::Run()
+{
+	constexpr std::chrono::milliseconds scan_interval(250);
+	constexpr std::chrono::milliseconds sleep_step(50);
+
+	while (running)
+	{
+		// Sleep in small steps to notice Stop()
+		for (std::chrono::milliseconds slept(0); slept < scan_interval && running; slept += sleep_step)
+			std::this_thread::sleep_for(sleep_step);
+
+		if (running)
+			Scan(true);
+	}
+}
+
+void FileWatcher::Scan(const bool _report)
+{
+	std::error_code error;
+	for (const std::filesystem::directory_entry& entry : std::filesystem::recursive_directory_iterator(folder, error))
+	{
+		if (!entry.is_regular_file(error))
+			continue;
+
+		const std::filesystem::file_time_type write_time = entry.last_write_time(error);
+		if (error)
+			continue;
+
+		const std::string name = std::filesystem::relative(entry.path(), folder, error).generic_string();
+
+		const std::unordered_map<std::string, std::filesystem::file_time_type>::iterator it = writeTimes.find(name);
+		if (it == writeTimes.end())
+		{
+			writeTimes.emplace(name, write_time);
+			if (_report)
+				Push(name);
+		}
+		else if (it->second != write_time)
+		{
+			it->second = write_time;
+			if (_report)
+				Push(name);
+		}
+	}
+}
+#endif
@@ -0,0 +1,185 @@
+#include "Resources/Lz4.h"
+
+#include <cstring>
+#include <vector>
+
+namespace
+{
+	constexpr std::size_t MinMatch = 4;
+	constexpr std::size_t LastLiterals = 5;
+	constexpr std::size_t MatchFindLimit = 12;
+	constexpr std::size_t MaxOffset = 65535;
+	constexpr unsigned int HashLog = 16;
+
+	std::uint32_t Read32(const std::uint8_t* _pointer)
+	{
+		std::uint32_t value;
+		std::memcpy(&value, _pointer, sizeof(value));
+		return value;
+	}
+
+	std::uint32_t Hash(const std::uint32_t _sequence)
+	{
+		return (_sequence * 2654435761u) >> (32 - HashLog);
+	}
+
+	std::uint8_t* WriteLength(std::uint8_t* _output, std::size_t _length)
+	{
+		while (_length >= 255)
+		{
+			*_output++ = 255;
+			_length -= 255;
+		}
+		*_output++ = static_cast<std::uint8_t>(_length);
+		return _output;
+	}
+
+	std::uint8_t* WriteLiterals(std::uint8_t* _output, const std::uint8_t* _literals, const std::size_t _length, std::uint8_t*& _token)
+	{
+		_token = _output++;
+		if (_length >= 15)
+		{
+			*_token = 15 << 4;
+			_output = WriteLength(_output, _length - 15);
+		}
+		else
+		{
+			*_token = static_cast<std::uint8_t>(_length << 4);
+		}
+
+		// An empty source may be a null pointer, not to be given to memcpy
+		if (_length > 0)
+			std::memcpy(_output, _literals, _length);
+		return _output + _length;
+	}
+
+	bool ReadLength(const std::uint8_t*& _input, const std::uint8_t* _input_end, std::size_t& _length)
+	{
+		std::uint8_t byte;
+		do
+		{
+			if (_input >= _input_end)
+				return false;
+			byte = *_input++;
+			_length += byte;
+		}
+		while (byte == 255);
+		return true;
+	}
+}
+
+std::size_t Lz4::CompressBound(const std::size_t _size)
+{
+	return _size + _size / 255 + 16;
+}
+
+std::size_t Lz4::Compress(const std::uint8_t* _source, const std::size_t _source_size, std::uint8_t* _destination, const std::size_t _destination_capacity)
+{
+	if (_destination_capacity < CompressBound(_source_size))
+		return 0;
+
+	std::uint8_t* output = _destination;
+	std::uint8_t* token = nullptr;
+	std::size_t anchor = 0;
+
+	if (_source_size > MatchFindLimit)
+	{
+		std::vector<std::int64_t> table(static_cast<std::size_t>(1) << HashLog, -1);
+		const std::size_t match_limit = _source_size - LastLiterals;
+
+		std::size_t position = 0;
+		while (position + MatchFindLimit <= _source_size)
+		{
+			const std::uint32_t sequence = Read32(_source + position);
+			const std::uint32_t hash = Hash(sequence);
+			const std::int64_t reference = table[hash];
+			table[hash] = static_cast<std::int64_t>(position);
+
+			if (reference < 0 || position - reference > MaxOffset || Read32(_source + reference) != sequence)
+			{
+				++position;
+				continue;
+			}
+
+			std::size_t length = MinMatch;
+			while (position + length < match_limit && _source[reference + length] == _source[position + length])
+				++length;
+
+			output = WriteLiterals(output, _source + anchor, position - anchor, token);
+
+			const std::size_t offset = position - static_cast<std::size_t>(reference);
+			*output++ = static_cast<std::uint8_t>(offset & 0xFF);
+			*output++ = static_cast<std::uint8_t>(offset >> 8);
+
+			const std::size_t match_length = length - MinMatch;
+			if (match_length >= 15)
+			{
+				*token |= 15;
+				output = WriteLength(output, match_length - 15);
+			}
+			else
+			{
+				*token |= static_cast<std::uint8_t>(match_length);
+			}
+
+			position += length;
+			anchor = position;
+		}
+	}
+
+	output = WriteLiterals(output, _source + anchor, _source_size - anchor, token);
+	return static_cast<std::size_t>(output - _destination);
+}
+
+bool Lz4::Decompress(const std::uint8_t* _source, const std::size_t _source_size, std::uint8_t* _destination, const std::size_t _destination_size)
+{
+	const std::uint8_t* input = _source;
+	const std::uint8_t* input_end = _source + _source_size;
+	std::uint8_t* output = _destination;
+	const std::uint8_t* output_end = _destination + _destination_size;
+
+	while (input < input_end)
+	{
+		const std::uint8_t token = *input++;
+
+		std::size_t literal_length = token >> 4;
+		if (literal_length == 15 && !ReadLength(input, input_end, literal_length))
+			return false;
+
+		if (literal_length > static_cast<std::size_t>(input_end - input) || literal_length > static_cast<std::size_t>(output_end - output))
+			return false;
+
+		if (literal_length > 0)
+			std::memcpy(output, input, literal_length);
+		input += literal_length;
+		output += literal_length;
+
+		// The last sequence only holds literals
+		if (input >= input_end)
+			break;
+
+		if (input_end - input < 2)
+			return false;
+
+		const std::size_t offset = input[0] | (static_cast<std::size_t>(input[1]) << 8);
+		input += 2;
+		if (offset == 0 || offset > static_cast<std::size_t>(output - _destination))
+			return false;
+
+		std::size_t match_length = token & 15;
+		if (match_length == 15 && !ReadLength(input, input_end, match_length))
+			return false;
+		match_length += MinMatch;
+
+		if (match_length > static_cast<std::size_t>(output_end - output))
+			return false;
+
+		// Byte copy, the match may overlap the output
+		const std::uint8_t* match = output - offset;
+		for (std::size_t i = 0; i < match_length; i++)
+			output[i] = match[i];
+		output += match_length;
+	}
+
+	return output == output_end;
+}
@@ -1,5 +1,12 @@
 #include "Resources/Texture.h"
 
+#include "Resources/TextureAtlas.h"
+
+Texture::Texture()
+{
+	data = new sf::Texture();
+}
+
 Texture::Texture(const std::string& _path)
 {
 	data = new sf::Texture();
@@ -8,12 +15,57 @@ Texture::Texture(const std::string& _path)
 
 Texture::~Texture()
 {
+	Texture::Unload();
+}
+
+bool Texture::Load(const std::string& _path)
+{
+	return data->loadFromFile(_path);
+}
+
+bool Texture::LoadFromMemory(const void* _data, const std::size_t _size)
+{
+	return data->loadFromMemory(_data, _size);
+}
+
+void Texture::Unload()
+{
+	if (atlas)
+		atlas->RemoveTexture(this);
+
 	delete data;
+	data = nullptr;
+}
+
+bool Texture::DecodeReload(const std::string& _path)
+{
+	return reloadedImage.loadFromFile(_path);
+}
+
+void Texture::ApplyReload()
+{
+	if (data && data->loadFromImage(reloadedImage) && atlas)
+		atlas->UpdateTexture(this, reloadedImage);
+
+	reloadedImage = sf::Image();
+}
+
+std::size_t Texture::GetMemorySize() const
+{
+	if (!data)
+		return 0;
+
+	const sf::Vector2u size = data->getSize();
+	return static_cast<std::size_t>(size.x) * size.y * 4;
 }
 
 Texture* Texture::AddSprite(const std::string& _name, const sf::IntRect& _rect)
 {
-	sprites.insert_or_assign(_name, sf::Sprite(*data, _rect));
+	spriteRects.insert_or_assign(_name, _rect);
+
+	sf::Sprite sprite;
+	RemapSprite(sprite, _rect);
+	sprites.insert_or_assign(_name, sprite);
 	return this;
 }
 
@@ -23,8 +75,45 @@ Texture* Texture::AddSprites(const std::string& _base_name, const sf::IntRect& _
 	{
 		for (int x = 0; x < _size.x; x++)
 		{
-			sprites.insert_or_assign(_base_name + "_" + std::to_string(x) + "_" + std::to_string(y), sf::Sprite(*data, sf::IntRect(_rect.left + x * _offset.x, _rect.top + y * _offset.y, _offset.x, _offset.y)));
+			AddSprite(_base_name + "_" + std::to_string(x) + "_" + std::to_string(y), sf::IntRect(_rect.left + x * _offset.x, _rect.top + y * _offset.y, _offset.x, _offset.y));
 		}
 	}
 	return this;
 }
+
+sf::Sprite* Texture::GetSprite(const std::string& _name)
+{
+	if (const std::unordered_map<std::string, sf::Sprite>::iterator it = sprites.find(_name); it != sprites.end())
+		return &it->second;
+
+	return nullptr;
+}
+
+void Texture::MapToAtlas(TextureAtlas* _atlas, const sf::Texture* _page, const sf::Vector2i& _offset)
+{
+	atlas = _atlas;
+	atlasPage = _page;
+	atlasOffset = _offset;
+
+	for (std::pair<const std::string, sf::Sprite>& sprite : sprites)
+		RemapSprite(sprite.second, spriteRects[sprite.first]);
+}
+
+void Texture::UnmapFromAtlas()
+{
+	MapToAtlas(nullptr, nullptr, sf::Vector2i());
+}
+
+void Texture::RemapSprite(sf::Sprite& _sprite, const sf::IntRect& _rect) const
+{
+	if (atlasPage)
+	{
+		_sprite.setTexture(*atlasPage);
+		_sprite.setTextureRect(sf::IntRect(_rect.left + atlasOffset.x, _rect.top + atlasOffset.y, _rect.width, _rect.height));
+	}
+	else if (data)
+	{
+		_sprite.setTexture(*data);
+		_sprite.setTextureRect(_rect);
+	}
+}
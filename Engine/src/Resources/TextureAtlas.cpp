@@ -0,0 +1,275 @@
+#include "Resources/TextureAtlas.h"
+
+#include <algorithm>
+
+#include "Resources/Texture.h"
+
+TextureAtlas::TextureAtlas(const unsigned int _page_size, const unsigned int _padding, const bool _extrude) : pageSize(_page_size), padding(_padding), extrude(_extrude)
+{
+	// Two neighbours extruding one pixel each need at least two pixels between them
+	if (extrude && padding < 2)
+		padding = 2;
+}
+
+TextureAtlas::~TextureAtlas()
+{
+	TextureAtlas::Unload();
+}
+
+bool TextureAtlas::AddImage(const std::string& _name, const sf::Image& _image)
+{
+	const sf::Vector2u size = _image.getSize();
+	if (size.x == 0 || size.y == 0 || size.x + 2 * padding > pageSize || size.y + 2 * padding > pageSize)
+		return false;
+
+	Texture* texture = nullptr;
+	if (const std::unordered_map<std::string, Entry>::iterator it = entries.find(_name); it != entries.end())
+		texture = it->second.texture;
+
+	Entry& entry = entries[_name];
+	entry.image = _image;
+	entry.texture = texture;
+
+	if (!Pack(entry))
+	{
+		entries.erase(_name);
+		return false;
+	}
+
+	if (entry.texture)
+		entry.texture->MapToAtlas(this, &pages[entry.region.page]->texture, sf::Vector2i(entry.region.rect.left, entry.region.rect.top));
+
+	return true;
+}
+
+bool TextureAtlas::AddImageFromFile(const std::string& _name, const std::string& _path)
+{
+	sf::Image image;
+	if (!image.loadFromFile(_path))
+		return false;
+
+	return AddImage(_name, image);
+}
+
+bool TextureAtlas::AddTexture(const std::string& _name, Texture* _texture)
+{
+	if (_texture == nullptr || _texture->GetData() == nullptr)
+		return false;
+
+	if (!AddImage(_name, _texture->GetData()->copyToImage()))
+		return false;
+
+	Entry& entry = entries[_name];
+	entry.texture = _texture;
+	_texture->MapToAtlas(this, &pages[entry.region.page]->texture, sf::Vector2i(entry.region.rect.left, entry.region.rect.top));
+
+	return true;
+}
+
+void TextureAtlas::UpdateTexture(Texture* _texture, const sf::Image& _image)
+{
+	for (std::pair<const std::string, Entry>& entry : entries)
+	{
+		if (entry.second.texture != _texture)
+			continue;
+
+		// Same size: overwrite the region in place, otherwise pack it again elsewhere
+		if (entry.second.image.getSize() == _image.getSize())
+		{
+			entry.second.image = _image;
+			Upload(entry.second);
+		}
+		else
+		{
+			const std::string name = entry.first;
+			if (!AddImage(name, _image))
+				_texture->UnmapFromAtlas();
+		}
+		return;
+	}
+}
+
+void TextureAtlas::RemoveTexture(Texture* _texture)
+{
+	for (std::pair<const std::string, Entry>& entry : entries)
+	{
+		if (entry.second.texture == _texture)
+		{
+			entry.second.texture = nullptr;
+			_texture->UnmapFromAtlas();
+		}
+	}
+}
+
+void TextureAtlas::Rebuild()
+{
+	std::vector<Entry*> sorted_entries;
+	sorted_entries.reserve(entries.size());
+	for (std::pair<const std::string, Entry>& entry : entries)
+		sorted_entries.push_back(&entry.second);
+
+	// Tallest first keeps shelves tight
+	std::sort(sorted_entries.begin(), sorted_entries.end(), [](const Entry* _lhs, const Entry* _rhs)
+	{
+		const sf::Vector2u lhs_size = _lhs->image.getSize();
+		const sf::Vector2u rhs_size = _rhs->image.getSize();
+		return lhs_size.y != rhs_size.y ? lhs_size.y > rhs_size.y : lhs_size.x > rhs_size.x;
+	});
+
+	const std::vector<Page*> old_pages = std::move(pages);
+	pages.clear();
+
+	for (Entry* entry : sorted_entries)
+		Pack(*entry);
+
+	for (Entry* entry : sorted_entries)
+	{
+		if (entry->texture)
+			entry->texture->MapToAtlas(this, &pages[entry->region.page]->texture, sf::Vector2i(entry->region.rect.left, entry->region.rect.top));
+	}
+
+	for (const Page* page : old_pages)
+		delete page;
+}
+
+const TextureAtlas::Region* TextureAtlas::GetRegion(const std::string& _name) const
+{
+	if (const std::unordered_map<std::string, Entry>::const_iterator it = entries.find(_name); it != entries.end())
+		return &it->second.region;
+
+	return nullptr;
+}
+
+const sf::Texture* TextureAtlas::GetPage(const unsigned int _index) const
+{
+	return _index < pages.size() ? &pages[_index]->texture : nullptr;
+}
+
+unsigned int TextureAtlas::GetPageCount() const
+{
+	return static_cast<unsigned int>(pages.size());
+}
+
+unsigned int TextureAtlas::GetImageCount() const
+{
+	return static_cast<unsigned int>(entries.size());
+}
+
+unsigned int TextureAtlas::GetDrawCallsSaved() const
+{
+	return GetImageCount() > GetPageCount() ? GetImageCount() - GetPageCount() : 0;
+}
+
+void TextureAtlas::Unload()
+{
+	for (std::pair<const std::string, Entry>& entry : entries)
+	{
+		if (entry.second.texture)
+			entry.second.texture->UnmapFromAtlas();
+	}
+	entries.clear();
+
+	for (const Page* page : pages)
+		delete page;
+	pages.clear();
+}
+
+std::size_t TextureAtlas::GetMemorySize() const
+{
+	std::size_t size = pages.size() * pageSize * pageSize * 4;
+	for (const std::pair<const std::string, Entry>& entry : entries)
+	{
+		const sf::Vector2u image_size = entry.second.image.getSize();
+		size += static_cast<std::size_t>(image_size.x) * image_size.y * 4;
+	}
+	return size;
+}
+
+bool TextureAtlas::Pack(Entry& _entry)
+{
+	const sf::Vector2u size = _entry.image.getSize();
+	const unsigned int padded_width = size.x + padding;
+	const unsigned int padded_height = size.y + padding;
+
+	sf::Vector2u position;
+	unsigned int page_index = 0;
+	while (page_index < pages.size() && !Allocate(*pages[page_index], padded_width, padded_height, position))
+		++page_index;
+
+	if (page_index == pages.size())
+	{
+		if (!Allocate(*CreatePage(), padded_width, padded_height, position))
+			return false;
+	}
+
+	_entry.region.page = page_index;
+	_entry.region.rect = sf::IntRect(static_cast<int>(position.x), static_cast<int>(position.y), static_cast<int>(size.x), static_cast<int>(size.y));
+
+	Upload(_entry);
+	return true;
+}
+
+bool TextureAtlas::Allocate(Page& _page, const unsigned int _width, const unsigned int _height, sf::Vector2u& _position) const
+{
+	// Best fit: the shelf wasting the least height
+	Shelf* best_shelf = nullptr;
+	for (Shelf& shelf : _page.shelves)
+	{
+		if (shelf.height >= _height && shelf.cursor + _width <= pageSize && (!best_shelf || shelf.height < best_shelf->height))
+			best_shelf = &shelf;
+	}
+
+	if (!best_shelf)
+	{
+		if (_page.nextShelfY + _height > pageSize || padding + _width > pageSize)
+			return false;
+
+		_page.shelves.push_back({_page.nextShelfY, _height, padding});
+		_page.nextShelfY += _height;
+		best_shelf = &_page.shelves.back();
+	}
+
+	_position = sf::Vector2u(best_shelf->cursor, best_shelf->y);
+	best_shelf->cursor += _width;
+	return true;
+}
+
+TextureAtlas::Page* TextureAtlas::CreatePage()
+{
+	Page* page = new Page();
+	page->texture.create(pageSize, pageSize);
+	page->nextShelfY = padding;
+	pages.push_back(page);
+	return page;
+}
+
+void TextureAtlas::Upload(const Entry& _entry)
+{
+	sf::Texture& page_texture = pages[_entry.region.page]->texture;
+	const unsigned int x = static_cast<unsigned int>(_entry.region.rect.left);
+	const unsigned int y = static_cast<unsigned int>(_entry.region.rect.top);
+
+	if (!extrude)
+	{
+		page_texture.update(_entry.image, x, y);
+		return;
+	}
+
+	const sf::Vector2u size = _entry.image.getSize();
+	sf::Image extruded;
+	extruded.create(size.x + 2, size.y + 2);
+	extruded.copy(_entry.image, 1, 1);
+
+	for (unsigned int i = 0; i < size.x; i++)
+	{
+		extruded.setPixel(i + 1, 0, _entry.image.getPixel(i, 0));
+		extruded.setPixel(i + 1, size.y + 1, _entry.image.getPixel(i, size.y - 1));
+	}
+	for (unsigned int j = 0; j < size.y + 2; j++)
+	{
+		extruded.setPixel(0, j, extruded.getPixel(1, j));
+		extruded.setPixel(size.x + 1, j, extruded.getPixel(size.x, j));
+	}
+
+	page_texture.update(extruded, x - 1, y - 1);
+}
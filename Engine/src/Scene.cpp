@@ -7,6 +7,17 @@ Scene::Scene(const std::string& _name)
 	name = _name;
 }
 
+Scene::~Scene()
+{
+	for (const GameObject* game_object : gameObjects)
+		delete game_object;
+	gameObjects.clear();
+
+	for (const ComponentPool& pool : componentPools)
+		pool.type->destroyPool(pool.data);
+	componentPools.clear();
+}
+
 void Scene::Awake() const
 {
 	for (GameObject* const& game_object : gameObjects)
@@ -128,7 +139,9 @@ GameObject* Scene::CreateGameObject(const std::string& _name)
 {
 	GameObject* const game_object = new GameObject();
 	game_object->SetName(_name);
+	game_object->SetScene(this);
 	gameObjects.push_back(game_object);
+	++gameObjectsVersion;
 	return game_object;
 }
 
@@ -140,6 +153,7 @@ void Scene::DestroyGameObject(const GameObject* _game_object)
 		{
 			gameObjects.erase(it);
 			delete _game_object;
+			++gameObjectsVersion;
 			return;
 		}
 	}
@@ -161,3 +175,24 @@ const std::vector<GameObject*>& Scene::GetGameObjects() const
 {
 	return gameObjects;
 }
+
+void Scene::ReserveGameObjects(const std::size_t _count)
+{
+	gameObjects.reserve(_count);
+}
+
+bool Scene::DeleteGameObjects(const std::size_t _max_count)
+{
+	for (std::size_t i = 0; i < _max_count && !gameObjects.empty(); i++)
+	{
+		delete gameObjects.back();
+		gameObjects.pop_back();
+		++gameObjectsVersion;
+	}
+	return gameObjects.empty();
+}
+
+void Scene::AddComponentPool(const ComponentRegistry::ComponentType* _type, void* _pool)
+{
+	componentPools.push_back({_type, _pool});
+}
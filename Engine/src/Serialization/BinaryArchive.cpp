@@ -0,0 +1,121 @@
+#include "Serialization/BinaryArchive.h"
+
+#include <cstring>
+
+void BinaryWriter::Write(const void* _data, const std::size_t _size)
+{
+	const std::size_t offset = buffer.size();
+	buffer.resize(offset + _size);
+	std::memcpy(buffer.data() + offset, _data, _size);
+}
+
+void BinaryWriter::Field(const char* _name, bool& _value)
+{
+	const std::uint8_t value = _value ? 1 : 0;
+	Write(&value, sizeof(value));
+}
+
+void BinaryWriter::Field(const char* _name, std::int32_t& _value)
+{
+	Write(&_value, sizeof(_value));
+}
+
+void BinaryWriter::Field(const char* _name, std::uint32_t& _value)
+{
+	Write(&_value, sizeof(_value));
+}
+
+void BinaryWriter::Field(const char* _name, float& _value)
+{
+	Write(&_value, sizeof(_value));
+}
+
+void BinaryWriter::Field(const char* _name, std::string& _value)
+{
+	const std::uint32_t length = static_cast<std::uint32_t>(_value.size());
+	Write(&length, sizeof(length));
+	Write(_value.data(), _value.size());
+}
+
+void BinaryWriter::Field(const char* _name, Maths::Vector2f& _value)
+{
+	const float values[2] = {_value.x, _value.y};
+	Write(values, sizeof(values));
+}
+
+void BinaryWriter::Field(const char* _name, sf::Color& _value)
+{
+	const std::uint8_t values[4] = {_value.r, _value.g, _value.b, _value.a};
+	Write(values, sizeof(values));
+}
+
+bool BinaryReader::Read(void* _data, const std::size_t _size)
+{
+	if (const std::uint8_t* bytes = Skip(_size))
+	{
+		std::memcpy(_data, bytes, _size);
+		return true;
+	}
+
+	std::memset(_data, 0, _size);
+	return false;
+}
+
+const std::uint8_t* BinaryReader::Skip(const std::size_t _size)
+{
+	if (!valid || _size > size - position)
+	{
+		valid = false;
+		return nullptr;
+	}
+
+	const std::uint8_t* bytes = data + position;
+	position += _size;
+	return bytes;
+}
+
+void BinaryReader::Field(const char* _name, bool& _value)
+{
+	std::uint8_t value = 0;
+	Read(&value, sizeof(value));
+	_value = value != 0;
+}
+
+void BinaryReader::Field(const char* _name, std::int32_t& _value)
+{
+	Read(&_value, sizeof(_value));
+}
+
+void BinaryReader::Field(const char* _name, std::uint32_t& _value)
+{
+	Read(&_value, sizeof(_value));
+}
+
+void BinaryReader::Field(const char* _name, float& _value)
+{
+	Read(&_value, sizeof(_value));
+}
+
+void BinaryReader::Field(const char* _name, std::string& _value)
+{
+	std::uint32_t length = 0;
+	Read(&length, sizeof(length));
+
+	const char* characters = reinterpret_cast<const char*>(Skip(length));
+	_value.assign(characters ? characters : "", characters ? length : 0);
+}
+
+void BinaryReader::Field(const char* _name, Maths::Vector2f& _value)
+{
+	float values[2];
+	Read(values, sizeof(values));
+	_value.x = values[0];
+	_value.y = values[1];
+}
+
+void BinaryReader::Field(const char* _name, sf::Color& _value)
+{
+	std::uint8_t values[4];
+	Read(values, sizeof(values));
+	_value = sf::Color(values[0], values[1], values[2], values[3]);
+}
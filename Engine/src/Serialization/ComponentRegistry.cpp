@@ -0,0 +1,90 @@
+#include "Serialization/ComponentRegistry.h"
+
+#include "Component.h"
+#include "Components/AnimatorComponent.h"
+#include "Components/ParticleEmitter.h"
+#include "Components/RectangleShapeRenderer.h"
+#include "Components/Rigidbody2D.h"
+#include "Components/SpriteRenderer.h"
+#include "Components/SquareCollider.h"
+
+const ComponentRegistry::ComponentType* ComponentRegistry::Find(const std::uint32_t _id)
+{
+	const Registry& registry = GetRegistry();
+	if (const std::unordered_map<std::uint32_t, ComponentType>::const_iterator it = registry.types.find(_id); it != registry.types.end())
+		return &it->second;
+
+	return nullptr;
+}
+
+const ComponentRegistry::ComponentType* ComponentRegistry::Find(const std::string& _name)
+{
+	const ComponentType* type = Find(HashName(_name));
+	return type && type->name == _name ? type : nullptr;
+}
+
+const ComponentRegistry::ComponentType* ComponentRegistry::Find(const Component* _component)
+{
+	const Registry& registry = GetRegistry();
+	if (const std::unordered_map<std::type_index, const ComponentType*>::const_iterator it = registry.typesByIndex.find(std::type_index(typeid(*_component))); it != registry.typesByIndex.end())
+		return it->second;
+
+	return nullptr;
+}
+
+void* ComponentRegistry::CreatePool(const ComponentType& _type, const std::size_t _count)
+{
+	void* pool = _type.createPool(_count);
+	for (std::size_t i = 0; i < _count; i++)
+		_type.getPoolElement(pool, i)->pooled = true;
+
+	return pool;
+}
+
+std::uint32_t ComponentRegistry::HashName(const std::string& _name)
+{
+	std::uint32_t hash = 2166136261u;
+	for (const char character : _name)
+	{
+		hash ^= static_cast<std::uint8_t>(character);
+		hash *= 16777619u;
+	}
+	return hash;
+}
+
+ComponentRegistry::Registry& ComponentRegistry::GetRegistry()
+{
+	// Engine components are registered on first use rather than from static constructors,
+	// which the linker drops from a static library
+	static Registry registry = []()
+	{
+		Registry engine_registry;
+		Add(engine_registry, std::type_index(typeid(SquareCollider)), MakeType<SquareCollider>("SquareCollider", 3));
+		Add(engine_registry, std::type_index(typeid(RectangleShapeRenderer)), MakeType<RectangleShapeRenderer>("RectangleShapeRenderer", 1));
+		Add(engine_registry, std::type_index(typeid(SpriteRenderer)), MakeType<SpriteRenderer>("SpriteRenderer", 1));
+		Add(engine_registry, std::type_index(typeid(Rigidbody2D)), MakeType<Rigidbody2D>("Rigidbody2D", 1));
+		Add(engine_registry, std::type_index(typeid(ParticleEmitter)), MakeType<ParticleEmitter>("ParticleEmitter", 2));
+		Add(engine_registry, std::type_index(typeid(AnimatorComponent)), MakeType<AnimatorComponent>("AnimatorComponent", 1));
+		return engine_registry;
+	}();
+
+	return registry;
+}
+
+const ComponentRegistry::ComponentType* ComponentRegistry::Add(Registry& _registry, const std::type_index& _type_index, ComponentType&& _type)
+{
+	const std::unordered_map<std::uint32_t, ComponentType>::iterator it = _registry.types.find(_type.id);
+	if (it != _registry.types.end())
+	{
+		// Registering the same type again only updates its version
+		if (it->second.name != _type.name)
+			return nullptr;
+
+		it->second.version = _type.version;
+		return &it->second;
+	}
+
+	ComponentType& type = _registry.types.emplace(_type.id, std::move(_type)).first->second;
+	_registry.typesByIndex[_type_index] = &type;
+	return &type;
+}
@@ -0,0 +1,56 @@
+#include "Serialization/ImGuiArchive.h"
+
+#include <algorithm>
+#include <cstring>
+
+#include <imgui.h>
+
+void ImGuiArchive::Field(const char* _name, bool& _value)
+{
+	modified |= ImGui::Checkbox(_name, &_value);
+}
+
+void ImGuiArchive::Field(const char* _name, std::int32_t& _value)
+{
+	modified |= ImGui::DragScalar(_name, ImGuiDataType_S32, &_value);
+}
+
+void ImGuiArchive::Field(const char* _name, std::uint32_t& _value)
+{
+	modified |= ImGui::DragScalar(_name, ImGuiDataType_U32, &_value);
+}
+
+void ImGuiArchive::Field(const char* _name, float& _value)
+{
+	modified |= ImGui::DragFloat(_name, &_value);
+}
+
+void ImGuiArchive::Field(const char* _name, std::string& _value)
+{
+	// Longer strings are shown truncated and only replaced once edited
+	char buffer[256];
+	const std::size_t size = std::min(_value.size(), sizeof(buffer) - 1);
+	std::memcpy(buffer, _value.data(), size);
+	buffer[size] = '\0';
+
+	if (ImGui::InputText(_name, buffer, sizeof(buffer)))
+	{
+		_value = buffer;
+		modified = true;
+	}
+}
+
+void ImGuiArchive::Field(const char* _name, Maths::Vector2f& _value)
+{
+	modified |= ImGui::DragFloat2(_name, &_value.x);
+}
+
+void ImGuiArchive::Field(const char* _name, sf::Color& _value)
+{
+	float color[4] = {_value.r / 255.0f, _value.g / 255.0f, _value.b / 255.0f, _value.a / 255.0f};
+	if (ImGui::ColorEdit4(_name, color))
+	{
+		_value = sf::Color(static_cast<sf::Uint8>(color[0] * 255.0f + 0.5f), static_cast<sf::Uint8>(color[1] * 255.0f + 0.5f), static_cast<sf::Uint8>(color[2] * 255.0f + 0.5f), static_cast<sf::Uint8>(color[3] * 255.0f + 0.5f));
+		modified = true;
+	}
+}
@@ -0,0 +1,144 @@
+#include "Serialization/JsonArchive.h"
+
+#include <cstdio>
+
+void JsonWriter::BeginObject(const char* _name)
+{
+	NewValue(_name);
+	output += '{';
+	empty.push_back(true);
+}
+
+void JsonWriter::EndObject()
+{
+	Close('}');
+}
+
+void JsonWriter::BeginArray(const char* _name)
+{
+	NewValue(_name);
+	output += '[';
+	empty.push_back(true);
+}
+
+void JsonWriter::EndArray()
+{
+	Close(']');
+}
+
+void JsonWriter::Field(const char* _name, bool& _value)
+{
+	NewValue(_name);
+	output += _value ? "true" : "false";
+}
+
+void JsonWriter::Field(const char* _name, std::int32_t& _value)
+{
+	NewValue(_name);
+	output += std::to_string(_value);
+}
+
+void JsonWriter::Field(const char* _name, std::uint32_t& _value)
+{
+	NewValue(_name);
+	output += std::to_string(_value);
+}
+
+void JsonWriter::Field(const char* _name, float& _value)
+{
+	NewValue(_name);
+	AppendFloat(_value);
+}
+
+void JsonWriter::Field(const char* _name, std::string& _value)
+{
+	NewValue(_name);
+	AppendString(_value);
+}
+
+void JsonWriter::Field(const char* _name, Maths::Vector2f& _value)
+{
+	NewValue(_name);
+	output += '[';
+	AppendFloat(_value.x);
+	output += ", ";
+	AppendFloat(_value.y);
+	output += ']';
+}
+
+void JsonWriter::Field(const char* _name, sf::Color& _value)
+{
+	NewValue(_name);
+	output += '[' + std::to_string(_value.r) + ", " + std::to_string(_value.g) + ", " + std::to_string(_value.b) + ", " + std::to_string(_value.a) + ']';
+}
+
+void JsonWriter::NewValue(const char* _name)
+{
+	if (!empty.empty())
+	{
+		if (!empty.back())
+			output += ',';
+		empty.back() = false;
+
+		output += '\n';
+		output.append(empty.size(), '\t');
+	}
+
+	if (_name)
+	{
+		AppendString(_name);
+		output += ": ";
+	}
+}
+
+void JsonWriter::Close(const char _character)
+{
+	const bool was_empty = empty.back();
+	empty.pop_back();
+
+	if (!was_empty)
+	{
+		output += '\n';
+		output.append(empty.size(), '\t');
+	}
+	output += _character;
+
+	if (empty.empty())
+		output += '\n';
+}
+
+void JsonWriter::AppendString(const std::string& _value)
+{
+	output += '"';
+	for (const char character : _value)
+	{
+		switch (character)
+		{
+		case '"': output += "\\\""; break;
+		case '\\': output += "\\\\"; break;
+		case '\n': output += "\\n"; break;
+		case '\r': output += "\\r"; break;
+		case '\t': output += "\\t"; break;
+		default:
+			if (static_cast<unsigned char>(character) < 0x20)
+			{
+				char escaped[8];
+				std::snprintf(escaped, sizeof(escaped), "\\u%04x", static_cast<unsigned int>(character));
+				output += escaped;
+			}
+			else
+			{
+				output += character;
+			}
+		}
+	}
+	output += '"';
+}
+
+void JsonWriter::AppendFloat(const float _value)
+{
+	// 9 significant digits round-trip any float
+	char buffer[32];
+	std::snprintf(buffer, sizeof(buffer), "%.9g", static_cast<double>(_value));
+	output += buffer;
+}
@@ -0,0 +1,306 @@
+#include "Serialization/SceneSerializer.h"
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <typeinfo>
+#include <unordered_map>
+
+#include "Scene.h"
+#include "Serialization/BinaryArchive.h"
+#include "Serialization/ComponentRegistry.h"
+#include "Serialization/JsonArchive.h"
+
+// Records are read and written as raw blocks
+static_assert(sizeof(SceneSerializer::Header) == 24, "SceneSerializer::Header layout changed, bump SceneSerializer::Version");
+static_assert(sizeof(SceneSerializer::ObjectRecord) == 32, "SceneSerializer::ObjectRecord layout changed, bump SceneSerializer::Version");
+static_assert(sizeof(SceneSerializer::PoolHeader) == 24, "SceneSerializer::PoolHeader layout changed, bump SceneSerializer::Version");
+static_assert(sizeof(SceneSerializer::PoolSlot) == 8, "SceneSerializer::PoolSlot layout changed, bump SceneSerializer::Version");
+
+namespace
+{
+	/**
+	 * \struct PoolBuilder
+	 * \brief The components of one type gathered while saving.
+	 */
+	struct PoolBuilder
+	{
+		const ComponentRegistry::ComponentType* type = nullptr;
+		std::vector<SceneSerializer::PoolSlot> slots;
+		std::vector<std::uint8_t> data;
+	};
+}
+
+std::size_t SceneSerializer::Save(const Scene& _scene, std::vector<std::uint8_t>& _buffer)
+{
+	const std::vector<GameObject*>& game_objects = _scene.GetGameObjects();
+
+	Header header;
+	header.objectCount = static_cast<std::uint32_t>(game_objects.size());
+	header.sceneNameLength = static_cast<std::uint32_t>(_scene.GetName().size());
+
+	std::vector<ObjectRecord> records(game_objects.size());
+	std::string names = _scene.GetName();
+
+	std::vector<PoolBuilder> pools;
+	std::unordered_map<std::uint32_t, std::size_t> pool_indices;
+	std::size_t skipped_components = 0;
+
+	for (std::size_t i = 0; i < game_objects.size(); i++)
+	{
+		GameObject* game_object = game_objects[i];
+		ObjectRecord& record = records[i];
+
+		const Maths::Vector2f position = game_object->GetPosition();
+		const Maths::Vector2f scale = game_object->GetScale();
+		const std::string& name = game_object->GetName();
+
+		record.position[0] = position.x;
+		record.position[1] = position.y;
+		record.rotation = game_object->GetRotation();
+		record.scale[0] = scale.x;
+		record.scale[1] = scale.y;
+		record.nameOffset = static_cast<std::uint32_t>(names.size());
+		record.nameLength = static_cast<std::uint32_t>(name.size());
+		names += name;
+
+		for (Component* component : game_object->GetComponents())
+		{
+			const ComponentRegistry::ComponentType* type = ComponentRegistry::Find(component);
+			if (!type)
+			{
+				++skipped_components;
+				continue;
+			}
+
+			const std::pair<std::unordered_map<std::uint32_t, std::size_t>::iterator, bool> pool_index = pool_indices.emplace(type->id, pools.size());
+			if (pool_index.second)
+				pools.push_back({type, {}, {}});
+
+			PoolBuilder& pool = pools[pool_index.first->second];
+			pool.slots.push_back({static_cast<std::uint32_t>(i), record.componentCount++});
+
+			BinaryWriter writer(pool.data);
+			writer.SetVersion(type->version);
+			component->Serialize(writer);
+		}
+	}
+
+	header.poolCount = static_cast<std::uint32_t>(pools.size());
+	header.namesSize = static_cast<std::uint32_t>(names.size());
+
+	_buffer.clear();
+	BinaryWriter writer(_buffer);
+	writer.Write(&header, sizeof(header));
+	writer.Write(records.data(), records.size() * sizeof(ObjectRecord));
+	writer.Write(names.data(), names.size());
+
+	for (const PoolBuilder& pool : pools)
+	{
+		PoolHeader pool_header;
+		pool_header.typeId = pool.type->id;
+		pool_header.typeVersion = pool.type->version;
+		pool_header.count = static_cast<std::uint32_t>(pool.slots.size());
+		pool_header.dataSize = pool.data.size();
+
+		writer.Write(&pool_header, sizeof(pool_header));
+		writer.Write(pool.slots.data(), pool.slots.size() * sizeof(PoolSlot));
+		writer.Write(pool.data.data(), pool.data.size());
+	}
+
+	return skipped_components;
+}
+
+bool SceneSerializer::SaveToFile(const Scene& _scene, const std::filesystem::path& _path)
+{
+	std::vector<std::uint8_t> buffer;
+	Save(_scene, buffer);
+
+	std::ofstream file(_path, std::ios::binary | std::ios::trunc);
+	file.write(reinterpret_cast<const char*>(buffer.data()), static_cast<std::streamsize>(buffer.size()));
+	return static_cast<bool>(file);
+}
+
+Scene* SceneSerializer::Load(const void* _data, const std::size_t _size)
+{
+	BinaryReader reader(_data, _size);
+
+	Header header;
+	if (!reader.Read(&header, sizeof(header)) || header.magic != Magic || header.version != Version)
+		return nullptr;
+
+	// Checked against the remaining size before anything is allocated
+	if (header.objectCount > reader.GetRemaining() / sizeof(ObjectRecord))
+		return nullptr;
+
+	std::vector<ObjectRecord> records(header.objectCount);
+	reader.Read(records.data(), records.size() * sizeof(ObjectRecord));
+
+	const char* names = reinterpret_cast<const char*>(reader.Skip(header.namesSize));
+	if (!names || header.sceneNameLength > header.namesSize)
+		return nullptr;
+
+	// Every component needs at least its slot in the remaining data
+	std::uint64_t component_count = 0;
+	for (const ObjectRecord& record : records)
+		component_count += record.componentCount;
+	if (component_count > reader.GetRemaining() / sizeof(PoolSlot))
+		return nullptr;
+
+	Scene* scene = new Scene(std::string(names, header.sceneNameLength));
+	scene->ReserveGameObjects(records.size());
+
+	std::vector<GameObject*> game_objects(records.size());
+	std::uint64_t assigned_components = 0;
+	bool valid = true;
+
+	for (std::size_t i = 0; i < records.size(); i++)
+	{
+		const ObjectRecord& record = records[i];
+		const bool valid_name = record.nameOffset <= header.namesSize && record.nameLength <= header.namesSize - record.nameOffset;
+
+		GameObject* game_object = scene->CreateGameObject(valid_name ? std::string(names + record.nameOffset, record.nameLength) : std::string());
+		game_object->SetPosition(Maths::Vector2f(record.position[0], record.position[1]));
+		game_object->SetRotation(record.rotation);
+		game_object->SetScale(Maths::Vector2f(record.scale[0], record.scale[1]));
+		game_object->GetComponents().resize(record.componentCount, nullptr);
+		game_objects[i] = game_object;
+	}
+
+	for (std::uint32_t pool_index = 0; pool_index < header.poolCount && valid; pool_index++)
+	{
+		PoolHeader pool_header;
+		reader.Read(&pool_header, sizeof(pool_header));
+
+		const PoolSlot* slots = reinterpret_cast<const PoolSlot*>(reader.Skip(static_cast<std::size_t>(pool_header.count) * sizeof(PoolSlot)));
+		const std::uint8_t* data = reader.Skip(static_cast<std::size_t>(pool_header.dataSize));
+		if (!slots || !data)
+		{
+			valid = false;
+			break;
+		}
+
+		const ComponentRegistry::ComponentType* type = ComponentRegistry::Find(pool_header.typeId);
+		if (!type || pool_header.count == 0)
+			continue;
+
+		void* pool = ComponentRegistry::CreatePool(*type, pool_header.count);
+		scene->AddComponentPool(type, pool);
+
+		BinaryReader pool_reader(data, static_cast<std::size_t>(pool_header.dataSize));
+		pool_reader.SetVersion(pool_header.typeVersion);
+
+		for (std::uint32_t i = 0; i < pool_header.count; i++)
+		{
+			Component* component = type->getPoolElement(pool, i);
+			component->Serialize(pool_reader);
+
+			PoolSlot slot;
+			std::memcpy(&slot, slots + i, sizeof(slot));
+			if (slot.owner >= game_objects.size() || slot.slot >= records[slot.owner].componentCount || game_objects[slot.owner]->GetComponents()[slot.slot])
+				continue;
+
+			std::vector<Component*>& components = game_objects[slot.owner]->GetComponents();
+
+			component->SetOwner(game_objects[slot.owner]);
+			components[slot.slot] = component;
+			component->OnAttach();
+			++assigned_components;
+		}
+
+		valid = pool_reader.IsValid();
+	}
+
+	valid = valid && reader.IsValid();
+
+	// Slots of skipped types, invalid slots or unread pools stay empty
+	if (assigned_components != component_count)
+	{
+		for (GameObject* game_object : game_objects)
+		{
+			std::vector<Component*>& components = game_object->GetComponents();
+			components.erase(std::remove(components.begin(), components.end(), nullptr), components.end());
+		}
+	}
+
+	if (!valid)
+	{
+		delete scene;
+		return nullptr;
+	}
+
+	return scene;
+}
+
+Scene* SceneSerializer::LoadFromFile(const std::filesystem::path& _path)
+{
+	std::ifstream file(_path, std::ios::binary | std::ios::ate);
+	if (!file)
+		return nullptr;
+
+	std::vector<std::uint8_t> buffer(static_cast<std::size_t>(file.tellg()));
+	file.seekg(0);
+	if (!file.read(reinterpret_cast<char*>(buffer.data()), static_cast<std::streamsize>(buffer.size())))
+		return nullptr;
+
+	return Load(buffer.data(), buffer.size());
+}
+
+std::string SceneSerializer::ExportJson(const Scene& _scene)
+{
+	std::string output;
+	JsonWriter writer(output);
+
+	std::string scene_name = _scene.GetName();
+	std::uint32_t version = Version;
+
+	writer.BeginObject();
+	writer.Field("name", scene_name);
+	writer.Field("version", version);
+	writer.BeginArray("gameObjects");
+
+	for (GameObject* game_object : _scene.GetGameObjects())
+	{
+		std::string name = game_object->GetName();
+		Maths::Vector2f position = game_object->GetPosition();
+		float rotation = game_object->GetRotation();
+		Maths::Vector2f scale = game_object->GetScale();
+
+		writer.BeginObject();
+		writer.Field("name", name);
+		writer.Field("position", position);
+		writer.Field("rotation", rotation);
+		writer.Field("scale", scale);
+		writer.BeginArray("components");
+
+		for (Component* component : game_object->GetComponents())
+		{
+			const ComponentRegistry::ComponentType* type = ComponentRegistry::Find(component);
+			std::string type_name = type ? type->name : std::string(typeid(*component).name());
+			std::uint32_t type_version = type ? type->version : 0;
+
+			writer.BeginObject();
+			writer.Field("type", type_name);
+			writer.Field("version", type_version);
+			writer.SetVersion(type_version);
+			component->Serialize(writer);
+			writer.EndObject();
+		}
+
+		writer.EndArray();
+		writer.EndObject();
+	}
+
+	writer.EndArray();
+	writer.EndObject();
+	return output;
+}
+
+bool SceneSerializer::ExportJsonToFile(const Scene& _scene, const std::filesystem::path& _path)
+{
+	const std::string json = ExportJson(_scene);
+
+	std::ofstream file(_path, std::ios::binary | std::ios::trunc);
+	file.write(json.data(), static_cast<std::streamsize>(json.size()));
+	return static_cast<bool>(file);
+}
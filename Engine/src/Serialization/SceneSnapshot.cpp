@@ -0,0 +1,177 @@
+#include "Serialization/SceneSnapshot.h"
+
+#include <cstring>
+#include <typeinfo>
+
+#include "Scene.h"
+#include "Serialization/BinaryArchive.h"
+
+namespace
+{
+	/**
+	 * \class TypeCache
+	 * \brief Finds the registered type of components, remembering the few types a scene uses.
+	 *
+	 * ComponentRegistry::Find() hashes the type name, comparing type_info against the
+	 * types already seen is several times faster when done for every component.
+	 */
+	class TypeCache
+	{
+	public:
+		const ComponentRegistry::ComponentType* Find(const Component* _component)
+		{
+			const std::type_info& info = typeid(*_component);
+			for (const Entry& entry : entries)
+			{
+				if (*entry.info == info)
+					return entry.type;
+			}
+
+			const ComponentRegistry::ComponentType* type = ComponentRegistry::Find(_component);
+			entries.push_back({&info, type});
+			return type;
+		}
+
+	private:
+		struct Entry
+		{
+			const std::type_info* info = nullptr;
+			const ComponentRegistry::ComponentType* type = nullptr;
+		};
+
+		std::vector<Entry> entries;
+	};
+
+	/**
+	 * \brief Writes or reads the transforms and the components state, in the order of the layout.
+	 * \param _scene The scene.
+	 * \param _archive The archive, BinaryWriter or BinaryReader so the transform fields are not virtual calls.
+	 * \param _types The type of every component in layout order.
+	 */
+	template<typename T>
+	void SerializeState(const Scene& _scene, T& _archive, const std::vector<const ComponentRegistry::ComponentType*>& _types)
+	{
+		std::size_t type_index = 0;
+
+		for (GameObject* game_object : _scene.GetGameObjects())
+		{
+			Maths::Vector2f position = game_object->GetPosition();
+			float rotation = game_object->GetRotation();
+			Maths::Vector2f scale = game_object->GetScale();
+
+			_archive.T::Field("position", position);
+			_archive.T::Field("rotation", rotation);
+			_archive.T::Field("scale", scale);
+
+			if (_archive.IsReading())
+			{
+				game_object->SetPosition(position);
+				game_object->SetRotation(rotation);
+				game_object->SetScale(scale);
+			}
+
+			for (Component* component : game_object->GetComponents())
+			{
+				const ComponentRegistry::ComponentType* type = _types[type_index++];
+				_archive.SetVersion(type ? type->version : 1);
+				component->Serialize(_archive);
+			}
+		}
+	}
+}
+
+void SceneSnapshot::Capture(const Scene& _scene)
+{
+	const std::vector<GameObject*>& game_objects = _scene.GetGameObjects();
+
+	data.clear();
+	BinaryWriter writer(data);
+
+	Header header;
+	header.objectCount = static_cast<std::uint32_t>(game_objects.size());
+	writer.Write(&header, sizeof(header));
+
+	types.clear();
+	TypeCache type_cache;
+
+	for (GameObject* game_object : game_objects)
+	{
+		const std::vector<Component*>& components = game_object->GetComponents();
+		const std::uint32_t component_count = static_cast<std::uint32_t>(components.size());
+		writer.Write(&component_count, sizeof(component_count));
+
+		for (const Component* component : components)
+		{
+			const ComponentRegistry::ComponentType* type = type_cache.Find(component);
+			const std::uint32_t type_id = type ? type->id : 0;
+			writer.Write(&type_id, sizeof(type_id));
+			types.push_back(type);
+		}
+
+		header.componentCount += component_count;
+	}
+
+	header.stateOffset = static_cast<std::uint32_t>(writer.GetPosition());
+	SerializeState(_scene, writer, types);
+	header.stateSize = static_cast<std::uint32_t>(writer.GetPosition() - header.stateOffset);
+
+	std::memcpy(data.data(), &header, sizeof(header));
+}
+
+bool SceneSnapshot::Restore(Scene& _scene) const
+{
+	Header header;
+	if (data.size() < sizeof(header))
+		return false;
+
+	std::memcpy(&header, data.data(), sizeof(header));
+	if (header.magic != Magic || header.stateOffset < sizeof(header) || header.stateOffset > data.size() || header.stateSize != data.size() - header.stateOffset)
+		return false;
+
+	if (!Matches(_scene, header))
+		return false;
+
+	// The types were gathered by Matches()
+	BinaryReader reader(data.data() + header.stateOffset, header.stateSize);
+	SerializeState(_scene, reader, types);
+	return reader.IsValid();
+}
+
+void SceneSnapshot::SetData(const void* _data, const std::size_t _size)
+{
+	const std::uint8_t* bytes = static_cast<const std::uint8_t*>(_data);
+	data.assign(bytes, bytes + _size);
+}
+
+bool SceneSnapshot::Matches(const Scene& _scene, const Header& _header) const
+{
+	const std::vector<GameObject*>& game_objects = _scene.GetGameObjects();
+	if (game_objects.size() != _header.objectCount)
+		return false;
+
+	BinaryReader reader(data.data() + sizeof(Header), _header.stateOffset - sizeof(Header));
+	types.clear();
+	TypeCache type_cache;
+
+	for (GameObject* game_object : game_objects)
+	{
+		const std::vector<Component*>& components = game_object->GetComponents();
+
+		std::uint32_t component_count = 0;
+		if (!reader.Read(&component_count, sizeof(component_count)) || component_count != components.size())
+			return false;
+
+		for (const Component* component : components)
+		{
+			const ComponentRegistry::ComponentType* type = type_cache.Find(component);
+
+			std::uint32_t type_id = 0;
+			if (!reader.Read(&type_id, sizeof(type_id)) || type_id != (type ? type->id : 0))
+				return false;
+
+			types.push_back(type);
+		}
+	}
+
+	return reader.GetRemaining() == 0;
+}
@@ -0,0 +1,89 @@
+#include "WorkerPool.h"
+
+WorkerPool::WorkerPool(const std::size_t _thread_count)
+{
+	for (std::size_t i = 1; i < _thread_count; i++)
+		threads.emplace_back(&WorkerPool::Run, this);
+}
+
+WorkerPool::~WorkerPool()
+{
+	{
+		const std::lock_guard<std::mutex> lock(mutex);
+		stopping = true;
+	}
+
+	startCondition.notify_all();
+	for (std::thread& thread : threads)
+		thread.join();
+}
+
+void WorkerPool::ParallelFor(const std::size_t _count, const std::function<void(std::size_t)>& _task)
+{
+	if (threads.empty() || _count <= 1)
+	{
+		for (std::size_t i = 0; i < _count; i++)
+			_task(i);
+		return;
+	}
+
+	{
+		// A thread woken too late for the previous loop may still be looking for a task of it
+		std::unique_lock<std::mutex> lock(mutex);
+		doneCondition.wait(lock, [this]()
+		{
+			return activeThreads == 0;
+		});
+
+		task = &_task;
+		taskCount = _count;
+		nextTask = 0;
+		++generation;
+		++activeThreads;
+	}
+
+	startCondition.notify_all();
+	RunTasks();
+
+	// The task goes out of scope once returned, every thread running it is waited for
+	std::unique_lock<std::mutex> lock(mutex);
+	--activeThreads;
+	doneCondition.wait(lock, [this]()
+	{
+		return activeThreads == 0;
+	});
+	task = nullptr;
+}
+
+void WorkerPool::Run()
+{
+	std::uint64_t last_generation = 0;
+	std::unique_lock<std::mutex> lock(mutex);
+
+	while (true)
+	{
+		startCondition.wait(lock, [&]()
+		{
+			return stopping || generation != last_generation;
+		});
+
+		if (stopping)
+			return;
+
+		last_generation = generation;
+		++activeThreads;
+
+		lock.unlock();
+		RunTasks();
+		lock.lock();
+
+		if (--activeThreads == 0)
+			doneCondition.notify_all();
+	}
+}
+
+void WorkerPool::RunTasks()
+{
+	for (std::size_t index = nextTask++; index < taskCount; index = nextTask++)
+		(*task)(index);
+}
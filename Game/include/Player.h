@@ -1,34 +1,30 @@
 #pragma once
 #include "Component.h"
 #include "InputModule.h"
+#include "Serialization/Archive.h"
 
 class Player : public Component
 {
 public:
-	void Update(const float _delta_time) override
+	void Start() override
 	{
-		Maths::Vector2<float> position = GetOwner()->GetPosition();
+		moveAction = InputModule::GetActions().FindAction("Move");
+	}
 
-		if (InputModule::GetKey(sf::Keyboard::D))
-		{
-			position.x += speed * _delta_time;
-		}
-		if (InputModule::GetKey(sf::Keyboard::Q))
-		{
-			position.x -= speed * _delta_time;
-		}
+	void Update(const float _delta_time) override
+	{
+		GetOwner()->SetPosition(GetOwner()->GetPosition() + InputModule::GetAxis2D(moveAction) * speed * _delta_time);
+	}
 
-		if (InputModule::GetKey(sf::Keyboard::Z))
-		{
-			position.y -= speed * _delta_time;
-		}
-		if (InputModule::GetKey(sf::Keyboard::S))
-		{
-			position.y += speed * _delta_time;
-		}
+	void Serialize(Archive& _archive) override
+	{
+		Component::Serialize(_archive);
 
-		GetOwner()->SetPosition(position);
+		_archive.Field("speed", speed);
 	}
 
 	float speed = 100.0f;
+
+private:
+	ActionId moveAction = ActionMap::InvalidAction;
 };
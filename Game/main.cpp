@@ -1,17 +1,81 @@
+#include <iostream>
+#include <string>
+
 #include "Engine.h"
+#include "InputModule.h"
+#include "PerformanceModule.h"
+#include "Player.h"
+#include "ReplayModule.h"
 #include "SceneModule.h"
+#include "Resources/AResource.h"
 #include "Scenes/DefaultScene.h"
+#include "Serialization/ComponentRegistry.h"
 
-int main()
+// Usage: Game [--record <file>] [--replay <file>] [--headless] [--perf-csv <file>]
+int main(const int _argc, char* _argv[])
 {
-	const Engine* engine = Engine::GetInstance();
+	ComponentRegistry::Register<Player>("Player");
+
+	// Default bindings, replaced by the ones of the bindings file when it lists them
+	ActionMap& actions = InputModule::GetActions();
+	const ActionId move_action = actions.AddAction("Move", ActionMap::ActionType::Axis2D);
+	actions.AddBinding(move_action, {ActionMap::BindingSource::Key, sf::Keyboard::D, 0, 1.0f});
+	actions.AddBinding(move_action, {ActionMap::BindingSource::Key, sf::Keyboard::Q, 0, -1.0f});
+	actions.AddBinding(move_action, {ActionMap::BindingSource::Key, sf::Keyboard::S, 1, 1.0f});
+	actions.AddBinding(move_action, {ActionMap::BindingSource::Key, sf::Keyboard::Z, 1, -1.0f});
+	actions.LoadFromFile(AResource::GetPathFromName("Input.bindings"));
+
+	Engine* engine = Engine::GetInstance();
+
+	std::string record_path;
+	std::string replay_path;
+	std::string perf_csv_path;
+	for (int i = 1; i < _argc; i++)
+	{
+		const std::string argument = _argv[i];
+		if (argument == "--record" && i + 1 < _argc)
+			record_path = _argv[++i];
+		else if (argument == "--replay" && i + 1 < _argc)
+			replay_path = _argv[++i];
+		else if (argument == "--perf-csv" && i + 1 < _argc)
+			perf_csv_path = _argv[++i];
+		else if (argument == "--headless")
+			engine->SetHeadless(true);
+	}
 
 	engine->Init();
 
 	SceneModule* scene_module = engine->GetModuleManager()->GetModule<SceneModule>();
 	scene_module->SetScene<DefaultScene>();
 
+	ReplayModule* replay_module = engine->GetModuleManager()->GetModule<ReplayModule>();
+	if (!replay_path.empty() && !replay_module->StartReplay(replay_path))
+	{
+		std::cerr << "Failed to read the recording " << replay_path << "\n";
+		return 1;
+	}
+	if (!record_path.empty() && !replay_module->StartRecording(record_path))
+	{
+		std::cerr << "Failed to create the recording " << record_path << "\n";
+		return 1;
+	}
+
+	PerformanceModule* performance_module = engine->GetModuleManager()->GetModule<PerformanceModule>();
+	if (!perf_csv_path.empty())
+		performance_module->SetCsvPath(perf_csv_path);
+
 	engine->Run();
 
+	// The statistics of the last seconds of the run
+	if (!perf_csv_path.empty() && !performance_module->DumpCsv(perf_csv_path))
+		std::cerr << "Failed to write the performance statistics to " << perf_csv_path << "\n";
+
+	if (!replay_path.empty())
+	{
+		const ReplayModule::ReplayStats& stats = replay_module->GetReplayStats();
+		std::cout << "Replayed " << stats.frames << " frames, " << stats.simulatedTime << " s simulated in " << stats.realTime << " s ("
+			<< (stats.frames > 0 ? stats.realTime * 1000.0f / static_cast<float>(stats.frames) : 0.0f) << " ms per frame)\n";
+	}
+
 	return 0;
 }
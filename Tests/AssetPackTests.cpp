@@ -0,0 +1,125 @@
+#include <filesystem>
+#include <fstream>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "Resources/AssetPack.h"
+
+#include "Test.h"
+
+namespace
+{
+	/**
+	 * \brief Writes a file, creating its folders.
+	 * \param _path The path of the file.
+	 * \param _content The content.
+	 */
+	void WriteFile(const std::filesystem::path& _path, const std::vector<std::uint8_t>& _content)
+	{
+		std::filesystem::create_directories(_path.parent_path());
+		std::ofstream file(_path, std::ios::binary | std::ios::trunc);
+		file.write(reinterpret_cast<const char*>(_content.data()), static_cast<std::streamsize>(_content.size()));
+	}
+
+	/**
+	 * \brief Gets an asset of a pack as a vector.
+	 * \param _pack The open pack.
+	 * \param _name The name of the asset.
+	 * \param _content Replaced by the content of the asset.
+	 * \return True if the asset was found and valid.
+	 */
+	bool ReadAsset(const AssetPack& _pack, const std::string& _name, std::vector<std::uint8_t>& _content)
+	{
+		const void* data = nullptr;
+		std::size_t size = 0;
+		std::vector<std::uint8_t> buffer;
+		if (!_pack.GetData(_name, data, size, buffer))
+			return false;
+
+		const std::uint8_t* bytes = static_cast<const std::uint8_t*>(data);
+		_content.assign(bytes, bytes + size);
+		return true;
+	}
+}
+
+TEST_CASE(AssetPackReadsGeneratedPack)
+{
+	const std::filesystem::path folder = std::filesystem::temp_directory_path() / "AssetPackTests";
+	const std::filesystem::path pack_path = folder.string() + ".pack";
+	std::filesystem::remove_all(folder);
+
+	std::mt19937 random(42);
+	std::uniform_int_distribution<int> bytes(0, 255);
+	std::vector<std::uint8_t> noise(3000);
+	for (std::uint8_t& byte : noise)
+		byte = static_cast<std::uint8_t>(bytes(random));
+
+	// Repeated text is compressed, the noise stays as is and is read in place
+	const std::string line = "The quick brown fox jumps over the lazy dog.\n";
+	std::vector<std::uint8_t> text;
+	for (int i = 0; i < 200; i++)
+		text.insert(text.end(), line.begin(), line.end());
+
+	WriteFile(folder / "Textures" / "noise.bin", noise);
+	WriteFile(folder / "Text" / "fox.txt", text);
+	WriteFile(folder / "empty.txt", {});
+
+	CHECK(AssetPack::Build(folder, pack_path, true));
+
+	{
+		AssetPack pack;
+		CHECK(pack.Open(pack_path));
+		CHECK(pack.GetEntryCount() == 3);
+
+		CHECK(pack.Contains("Textures/noise.bin"));
+		CHECK(pack.Contains("Textures\\noise.bin"));
+		CHECK(pack.Contains("empty.txt"));
+		CHECK(!pack.Contains("Textures/missing.bin"));
+		CHECK(!pack.Contains("noise.bin"));
+
+		std::vector<std::uint8_t> content;
+		CHECK(ReadAsset(pack, "Textures/noise.bin", content) && content == noise);
+		CHECK(ReadAsset(pack, "Text/fox.txt", content) && content == text);
+		CHECK(ReadAsset(pack, "empty.txt", content) && content.empty());
+		CHECK(!ReadAsset(pack, "Text/missing.txt", content));
+	}
+
+	// A compressed entry claiming more than its block could decompress to is refused before allocating
+	{
+		std::fstream file(pack_path, std::ios::binary | std::ios::in | std::ios::out);
+		AssetPack::Header header;
+		file.read(reinterpret_cast<char*>(&header), sizeof(header));
+
+		for (std::uint32_t i = 0; i < header.entryCount; i++)
+		{
+			const std::streamoff position = static_cast<std::streamoff>(header.tocOffset + i * sizeof(AssetPack::TocEntry));
+			AssetPack::TocEntry entry;
+			file.seekg(position);
+			file.read(reinterpret_cast<char*>(&entry), sizeof(entry));
+			if (!(entry.flags & AssetPack::Compressed))
+				continue;
+
+			entry.uncompressedSize = 1ull << 40;
+			file.seekp(position);
+			file.write(reinterpret_cast<const char*>(&entry), sizeof(entry));
+		}
+	}
+
+	{
+		AssetPack pack;
+		CHECK(pack.Open(pack_path));
+
+		std::vector<std::uint8_t> content;
+		CHECK(!ReadAsset(pack, "Text/fox.txt", content));
+		CHECK(ReadAsset(pack, "Textures/noise.bin", content) && content == noise);
+	}
+
+	// Not a pack
+	WriteFile(pack_path, text);
+	AssetPack pack;
+	CHECK(!pack.Open(pack_path));
+
+	std::filesystem::remove_all(folder);
+	std::filesystem::remove(pack_path);
+}
@@ -0,0 +1,68 @@
+#include <cstring>
+#include <iostream>
+#include <random>
+#include <vector>
+
+#include "Maths/FloatBatch.h"
+#include "Maths/Vector2Batch.h"
+
+#include "Test.h"
+
+namespace
+{
+	using namespace Maths;
+
+	constexpr float Scale = 0.016f;
+
+	/// Sizes around the widths of the kernels, to go through their scalar tails.
+	constexpr std::size_t Sizes[] = {0, 1, 3, 4, 5, 7, 8, 9, 15, 16, 17, 31, 33, 1000};
+}
+
+TEST_CASE(AddScaledReachingMatchesScalar)
+{
+	const Vector2Batch::SimdLevel supported = Vector2Batch::GetSupportedSimdLevel();
+
+	std::mt19937 random(42);
+	std::uniform_real_distribution<float> values_distribution(0.0f, 1.0f);
+	std::uniform_real_distribution<float> rates_distribution(0.5f, 10.0f);
+
+	for (const std::size_t size : Sizes)
+	{
+		// One more value, the batches start at the second one to test unaligned arrays
+		std::vector<float> values(size + 1);
+		std::vector<float> rates(size + 1);
+		for (std::size_t i = 0; i <= size; i++)
+		{
+			// Some values exactly at the limit once increased, which are found
+			values[i] = i % 9 == 0 ? 1.0f - 2.0f * Scale : values_distribution(random);
+			rates[i] = i % 9 == 0 ? 2.0f : rates_distribution(random);
+		}
+
+		std::vector<float> expected_values(values);
+		std::vector<std::uint32_t> expected_indices;
+		for (std::size_t i = 0; i < size; i++)
+		{
+			expected_values[i + 1] += rates[i + 1] * Scale;
+			if (expected_values[i + 1] >= 1.0f)
+				expected_indices.push_back(static_cast<std::uint32_t>(i));
+		}
+
+		for (int level = 0; level <= static_cast<int>(supported); level++)
+		{
+			Vector2Batch::SetSimdLevel(static_cast<Vector2Batch::SimdLevel>(level));
+
+			std::vector<float> batch_values(values);
+			std::vector<std::uint32_t> indices(size);
+			const std::size_t reaching = FloatBatch::AddScaledReaching(batch_values.data() + 1, rates.data() + 1, Scale, 1.0f, indices.data(), size);
+
+			bool same = reaching == expected_indices.size() && std::memcmp(batch_values.data(), expected_values.data(), values.size() * sizeof(float)) == 0;
+			for (std::size_t i = 0; same && i < reaching; i++)
+				same = indices[i] == expected_indices[i];
+			if (!same)
+				std::cerr << "AddScaledReaching differs at " << Vector2Batch::GetSimdLevelName(static_cast<Vector2Batch::SimdLevel>(level)) << " for " << size << " values\n";
+			CHECK(same);
+		}
+	}
+
+	Vector2Batch::SetSimdLevel(supported);
+}
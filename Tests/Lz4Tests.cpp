@@ -0,0 +1,125 @@
+#include <cstring>
+#include <iostream>
+#include <random>
+#include <vector>
+
+#include "Resources/Lz4.h"
+
+#include "Test.h"
+
+namespace
+{
+	/// Sizes around the match finding limits, up to blocks with long literal and match lengths.
+	constexpr std::size_t Sizes[] = {0, 1, 4, 5, 12, 13, 16, 255, 256, 270, 4096, 100000};
+
+	/**
+	 * \brief Compresses and decompresses a buffer.
+	 * \param _source The data.
+	 * \return True if the block decompressed to the same data.
+	 */
+	bool RoundTrips(const std::vector<std::uint8_t>& _source)
+	{
+		std::vector<std::uint8_t> compressed(Lz4::CompressBound(_source.size()));
+		const std::size_t compressed_size = Lz4::Compress(_source.data(), _source.size(), compressed.data(), compressed.size());
+		if (compressed_size == 0)
+			return false;
+
+		std::vector<std::uint8_t> decompressed(_source.size());
+		return Lz4::Decompress(compressed.data(), compressed_size, decompressed.data(), decompressed.size()) && decompressed == _source;
+	}
+
+	/**
+	 * \brief Decompresses a block into an output of a given size.
+	 * \param _block The block.
+	 * \param _size The size of the output.
+	 * \return True if the block was accepted.
+	 */
+	bool Decompresses(const std::vector<std::uint8_t>& _block, const std::size_t _size)
+	{
+		std::vector<std::uint8_t> output(_size);
+		return Lz4::Decompress(_block.data(), _block.size(), output.data(), output.size());
+	}
+}
+
+TEST_CASE(Lz4RoundTrips)
+{
+	std::mt19937 random(42);
+	std::uniform_int_distribution<int> bytes(0, 255);
+	std::uniform_int_distribution<int> letters('a', 'd');
+
+	for (const std::size_t size : Sizes)
+	{
+		std::vector<std::uint8_t> incompressible(size);
+		std::vector<std::uint8_t> text(size);
+		std::vector<std::uint8_t> repeated(size, 'x');
+		std::vector<std::uint8_t> pattern(size);
+		for (std::size_t i = 0; i < size; i++)
+		{
+			incompressible[i] = static_cast<std::uint8_t>(bytes(random));
+			text[i] = static_cast<std::uint8_t>(letters(random));
+
+			// A period shorter than the matches, they overlap the bytes they copy
+			pattern[i] = static_cast<std::uint8_t>("abc"[i % 3]);
+		}
+
+		const bool same = RoundTrips(incompressible) && RoundTrips(text) && RoundTrips(repeated) && RoundTrips(pattern);
+		if (!same)
+			std::cerr << "LZ4 does not round trip " << size << " bytes\n";
+		CHECK(same);
+	}
+}
+
+TEST_CASE(Lz4CompressesRepetitiveData)
+{
+	const std::vector<std::uint8_t> repeated(100000, 'x');
+	std::vector<std::uint8_t> compressed(Lz4::CompressBound(repeated.size()));
+	const std::size_t compressed_size = Lz4::Compress(repeated.data(), repeated.size(), compressed.data(), compressed.size());
+	CHECK(compressed_size > 0 && compressed_size < repeated.size() / 100);
+
+	// Too small an output is refused rather than overrun
+	CHECK(Lz4::Compress(repeated.data(), repeated.size(), compressed.data(), Lz4::CompressBound(repeated.size()) - 1) == 0);
+}
+
+TEST_CASE(Lz4DecodesOverlappingMatches)
+{
+	// "ab", then 8 bytes copied from 2 bytes back: each copied byte is one just written
+	const std::vector<std::uint8_t> block = {0x24, 'a', 'b', 0x02, 0x00};
+	std::vector<std::uint8_t> output(10);
+	CHECK(Lz4::Decompress(block.data(), block.size(), output.data(), output.size()));
+	CHECK(std::memcmp(output.data(), "ababababab", output.size()) == 0);
+}
+
+TEST_CASE(Lz4RejectsInvalidBlocks)
+{
+	std::mt19937 random(7);
+	std::uniform_int_distribution<int> letters('a', 'd');
+	std::vector<std::uint8_t> source(2000);
+	for (std::uint8_t& byte : source)
+		byte = static_cast<std::uint8_t>(letters(random));
+
+	std::vector<std::uint8_t> block(Lz4::CompressBound(source.size()));
+	block.resize(Lz4::Compress(source.data(), source.size(), block.data(), block.size()));
+	CHECK(Decompresses(block, source.size()));
+
+	// Every truncation falls short of the output or cuts a sequence
+	bool truncations_rejected = true;
+	for (std::size_t size = 0; size < block.size(); size++)
+		truncations_rejected = truncations_rejected && !Decompresses(std::vector<std::uint8_t>(block.begin(), block.begin() + static_cast<std::ptrdiff_t>(size)), source.size());
+	CHECK(truncations_rejected);
+
+	// The output size is exact
+	CHECK(!Decompresses(block, source.size() - 1));
+	CHECK(!Decompresses(block, source.size() + 1));
+
+	// Offsets of 0 or before the start of the output
+	CHECK(!Decompresses({0x24, 'a', 'b', 0x00, 0x00}, 10));
+	CHECK(!Decompresses({0x24, 'a', 'b', 0x03, 0x00}, 10));
+
+	// A match or literals longer than the output
+	CHECK(!Decompresses({0x2F, 'a', 'b', 0x01, 0x00, 0xFF, 0xFF}, 100));
+	CHECK(!Decompresses({0xF0, 0xFF, 'a'}, 10));
+
+	// A length continued past the end of the block, and an offset cut in half
+	CHECK(!Decompresses({0xF0, 0xFF}, 300));
+	CHECK(!Decompresses({0x14, 'a', 0x01}, 9));
+}
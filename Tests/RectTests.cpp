@@ -0,0 +1,127 @@
+#include <algorithm>
+#include <iostream>
+#include <random>
+#include <vector>
+
+#include "Maths/Rect.h"
+#include "Maths/RectBatch.h"
+#include "Maths/Vector2Batch.h"
+
+#include "Test.h"
+
+namespace
+{
+	using namespace Maths;
+
+	/// Rectangle counts around the widths of the kernels, to go through their scalar tails.
+	constexpr std::size_t Counts[] = {0, 1, 3, 4, 5, 7, 8, 9, 15, 16, 17, 31, 33, 2000};
+
+	/**
+	 * \brief Makes rectangles with whole coordinates, so that many share edges with each other and with the queries.
+	 * \param _random The generator.
+	 * \param _max_size The largest width and height, 0 for empty rectangles.
+	 * \return A rectangle.
+	 */
+	Rectf RandomRect(std::mt19937& _random, const int _max_size)
+	{
+		std::uniform_int_distribution<int> position_distribution(0, 200);
+		std::uniform_int_distribution<int> size_distribution(0, _max_size);
+		const Vector2f position(static_cast<float>(position_distribution(_random)), static_cast<float>(position_distribution(_random)));
+		const Vector2f size(static_cast<float>(size_distribution(_random)), static_cast<float>(size_distribution(_random)));
+		return Rectf::FromPositionSize(position, size);
+	}
+}
+
+TEST_CASE(RectOperations)
+{
+	const Rectf unit(Vector2f(0.0f, 0.0f), Vector2f(1.0f, 1.0f));
+
+	// Shared edges do not overlap, as SquareCollider always did
+	CHECK(!unit.Overlaps(Rectf(Vector2f(1.0f, 0.0f), Vector2f(2.0f, 1.0f))));
+	CHECK(unit.Overlaps(Rectf(Vector2f(0.5f, 0.5f), Vector2f(2.0f, 2.0f))));
+
+	CHECK(Rectf(Vector2f(0.0f, 0.0f), Vector2f(2.0f, 2.0f)).Intersection(Rectf(Vector2f(1.0f, 1.0f), Vector2f(3.0f, 3.0f))) == Rectf(Vector2f(1.0f, 1.0f), Vector2f(2.0f, 2.0f)));
+	CHECK(unit.Intersection(Rectf(Vector2f(2.0f, 2.0f), Vector2f(3.0f, 3.0f))).IsEmpty());
+	CHECK(unit.Union(Rectf(Vector2f(2.0f, -1.0f), Vector2f(3.0f, 0.0f))) == Rectf(Vector2f(0.0f, -1.0f), Vector2f(3.0f, 1.0f)));
+
+	// Min included, max excluded
+	CHECK(unit.Contains(Vector2f(0.0f, 0.0f)));
+	CHECK(!unit.Contains(Vector2f(1.0f, 0.5f)));
+	CHECK(!unit.Contains(Vector2f(0.5f, 1.0f)));
+	CHECK(Rectf(Vector2f(0.0f, 0.0f), Vector2f(4.0f, 4.0f)).Contains(Rectf(Vector2f(0.0f, 1.0f), Vector2f(4.0f, 2.0f))));
+	CHECK(!unit.Contains(Rectf(Vector2f(0.5f, 0.5f), Vector2f(1.5f, 1.0f))));
+
+	CHECK(Recti::FromPositionSize(Vector2i(1, 2), Vector2i(3, 4)).Expand(1) == Recti(Vector2i(0, 1), Vector2i(5, 7)));
+	CHECK(unit.Expand(Vector2f(-1.0f, 3.0f)) == Rectf(Vector2f(-1.0f, 0.0f), Vector2f(1.0f, 3.0f)));
+	CHECK(unit.Translate(Vector2f(2.0f, -1.0f)) == Rectf(Vector2f(2.0f, -1.0f), Vector2f(3.0f, 0.0f)));
+
+	CHECK(Rectf(Vector2f(1.0f, 2.0f), Vector2f(4.0f, 8.0f)).GetCenter() == Vector2f(2.5f, 5.0f));
+	CHECK(Rectf(Vector2f(1.0f, 2.0f), Vector2f(4.0f, 8.0f)).GetPerimeter() == 18.0f);
+	CHECK(Rectf().IsEmpty());
+
+	CHECK(unit.DistanceSquared(Vector2f(0.5f, 0.5f)) == 0.0f);
+	CHECK(unit.DistanceSquared(Vector2f(4.0f, 5.0f)) == 25.0f);
+}
+
+TEST_CASE(RectBatchMatchesRectf)
+{
+	const Vector2Batch::SimdLevel supported = Vector2Batch::GetSupportedSimdLevel();
+
+	std::mt19937 random(42);
+
+	for (const std::size_t count : Counts)
+	{
+		std::vector<Rectf> rects(count);
+		RectArray rect_array;
+		for (Rectf& rect : rects)
+		{
+			// Some empty rectangles, which overlap nothing and contain no point
+			rect = RandomRect(random, rect_array.Size() % 7 == 0 ? 0 : 40);
+			rect_array.Add(rect);
+		}
+
+		std::vector<Rectf> queries;
+		std::vector<Vector2f> points;
+		for (int i = 0; i < 20; i++)
+		{
+			queries.push_back(RandomRect(random, 40));
+			points.push_back(RandomRect(random, 0).min);
+		}
+
+		for (int level = 0; level <= static_cast<int>(supported); level++)
+		{
+			Vector2Batch::SetSimdLevel(static_cast<Vector2Batch::SimdLevel>(level));
+
+			std::vector<std::uint32_t> expected;
+			std::vector<std::uint32_t> result(count);
+			bool same = true;
+
+			for (std::size_t i = 0; i < queries.size(); i++)
+			{
+				expected.clear();
+				for (std::size_t j = 0; j < count; j++)
+				{
+					if (rects[j].Overlaps(queries[i]))
+						expected.push_back(static_cast<std::uint32_t>(j));
+				}
+				const std::size_t overlapping = RectBatch::Overlapping(queries[i], rect_array, result.data());
+				same = same && overlapping == expected.size() && std::equal(expected.begin(), expected.end(), result.begin());
+
+				expected.clear();
+				for (std::size_t j = 0; j < count; j++)
+				{
+					if (rects[j].Contains(points[i]))
+						expected.push_back(static_cast<std::uint32_t>(j));
+				}
+				const std::size_t containing = RectBatch::Containing(points[i], rect_array, result.data());
+				same = same && containing == expected.size() && std::equal(expected.begin(), expected.end(), result.begin());
+			}
+
+			if (!same)
+				std::cerr << "RectBatch differs at " << Vector2Batch::GetSimdLevelName(static_cast<Vector2Batch::SimdLevel>(level)) << " for " << count << " rectangles\n";
+			CHECK(same);
+		}
+	}
+
+	Vector2Batch::SetSimdLevel(supported);
+}
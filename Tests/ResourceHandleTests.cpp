@@ -0,0 +1,153 @@
+#include <atomic>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "Modules/ResourcesModule.h"
+
+#include "Test.h"
+
+namespace
+{
+	constexpr int Rounds = 40;
+	constexpr int ThreadCount = 4;
+	constexpr int ResourceCount = 8;
+
+	/**
+	 * \class StressResource
+	 * \brief A resource counting its instances, its payload is cleared when it is unloaded.
+	 */
+	class StressResource final : public AResource
+	{
+	public:
+		static constexpr int LoadedPayload = 42;
+
+		static std::atomic<int> alive;
+
+		StressResource() { ++alive; }
+		~StressResource() override { --alive; }
+
+		bool Load(const std::string& _path) override { return true; }
+		void Unload() override { payload = 0; }
+		std::size_t GetMemorySize() const override { return 1024; }
+
+		int GetPayload() const { return payload; }
+
+	private:
+		int payload = LoadedPayload;
+	};
+
+	std::atomic<int> StressResource::alive = 0;
+
+	bool IsLoaded(const ResourceHandle<StressResource>& _handle)
+	{
+		return _handle && _handle->GetPayload() == StressResource::LoadedPayload;
+	}
+}
+
+TEST_CASE(ResourceHandleStress)
+{
+	// Modules are destroyed by their ModuleManager, this one lives as long as the process
+	static ResourcesModule* resources = new ResourcesModule();
+
+	// Nothing unreferenced stays cached: every last release evicts, racing with the workers
+	resources->SetMemoryBudget(0);
+
+	for (int round = 0; round < Rounds; round++)
+	{
+		std::vector<ResourceHandle<StressResource>> handles;
+		for (int i = 0; i < ResourceCount; i++)
+			handles.push_back(resources->Acquire<StressResource>("Stress/" + std::to_string(i)));
+		const std::vector<WeakResourceHandle<StressResource>> weak_handles(handles.begin(), handles.end());
+
+		std::atomic<bool> started = false;
+		std::atomic<int> finished = 0;
+		std::vector<std::thread> threads;
+		for (int thread = 0; thread < ThreadCount; thread++)
+		{
+			threads.emplace_back([&, thread, owned = handles]() mutable
+			{
+				while (!started)
+					std::this_thread::yield();
+
+				// Copies and locks of resources this thread still references never fail
+				for (int i = 0; i < 2000; i++)
+				{
+					const ResourceHandle<StressResource> copy = owned[i % ResourceCount];
+					const WeakResourceHandle<StressResource> weak_copy(copy);
+					CHECK(IsLoaded(weak_copy.Lock()));
+				}
+
+				// Dropped here, the last reference of a resource is released by this thread, another worker or the main thread
+				owned.clear();
+
+				// Evicted meanwhile by the main thread, a lock either fails or gets a loaded resource
+				for (int i = 0; i < 1000; i++)
+				{
+					const ResourceHandle<StressResource> locked = weak_handles[(i + thread) % ResourceCount].Lock();
+					CHECK(!locked || IsLoaded(locked));
+				}
+				++finished;
+			});
+		}
+
+		started = true;
+		for (int frame = 0; frame < 20; frame++)
+			resources->Update();
+
+		// Released while the workers copy and lock them, the frames go on evicting until the workers are done
+		handles.clear();
+		while (finished < ThreadCount)
+			resources->Update();
+		for (std::thread& thread : threads)
+			thread.join();
+
+		resources->Update();
+		for (const WeakResourceHandle<StressResource>& weak_handle : weak_handles)
+			CHECK(weak_handle.Expired());
+	}
+
+	CHECK(resources->GetStats().residentCount == 0);
+	CHECK(resources->GetStats().evictions == static_cast<std::uint64_t>(Rounds * ResourceCount));
+	CHECK(StressResource::alive == 0);
+}
+
+TEST_CASE(ResourceHandleOutlivesFinalize)
+{
+	static ResourcesModule* resources = new ResourcesModule();
+	const int alive_before = StressResource::alive;
+
+	std::vector<ResourceHandle<StressResource>> handles;
+	for (int i = 0; i < ResourceCount; i++)
+		handles.push_back(resources->Acquire<StressResource>("Finalized/" + std::to_string(i)));
+
+	// An unreferenced resource is evicted by Finalize(), the others stay loaded for their handles
+	WeakResourceHandle<StressResource> unreferenced(resources->Acquire<StressResource>("Finalized/Unreferenced"));
+	resources->Finalize();
+
+	CHECK(unreferenced.Expired());
+	for (const ResourceHandle<StressResource>& handle : handles)
+		CHECK(IsLoaded(handle));
+
+	// The last releases happen on other threads, as scene teardown or workers would do after the module is finalized
+	std::vector<WeakResourceHandle<StressResource>> weak_handles(handles.begin(), handles.end());
+	std::vector<std::thread> threads;
+	for (int thread = 0; thread < ThreadCount; thread++)
+	{
+		threads.emplace_back([owned = handles]() mutable
+		{
+			owned.clear();
+		});
+	}
+	handles.clear();
+	for (std::thread& thread : threads)
+		thread.join();
+
+	for (const WeakResourceHandle<StressResource>& weak_handle : weak_handles)
+		CHECK(weak_handle.Expired());
+
+	// The weak references were the last ones keeping the objects
+	weak_handles.clear();
+	unreferenced = WeakResourceHandle<StressResource>();
+	CHECK(StressResource::alive == alive_before);
+}
@@ -0,0 +1,54 @@
+#pragma once
+
+#include <vector>
+
+/**
+ * \namespace Test
+ * \brief A minimal test runner: cases register themselves with TEST_CASE and report failures with CHECK.
+ */
+namespace Test
+{
+	/**
+	 * \struct Case
+	 * \brief A registered test case.
+	 */
+	struct Case
+	{
+		const char* name;
+		void (*function)();
+	};
+
+	/**
+	 * \brief Gets the registered cases, in the order their files were initialized.
+	 * \return The cases.
+	 */
+	std::vector<Case>& GetCases();
+
+	/**
+	 * \brief Reports a failed check, from any thread.
+	 * \param _expression The expression that was false.
+	 * \param _file The file of the check.
+	 * \param _line The line of the check.
+	 */
+	void Fail(const char* _expression, const char* _file, int _line);
+
+	/**
+	 * \struct Registrar
+	 * \brief Registers a case when its file is initialized.
+	 */
+	struct Registrar
+	{
+		Registrar(const char* _name, void (*_function)())
+		{
+			GetCases().push_back({_name, _function});
+		}
+	};
+}
+
+#define TEST_CASE(_name) \
+	static void _name(); \
+	static const Test::Registrar _name##Registrar(#_name, &_name); \
+	static void _name()
+
+#define CHECK(_expression) \
+	((_expression) ? static_cast<void>(0) : Test::Fail(#_expression, __FILE__, __LINE__))
@@ -0,0 +1,153 @@
+#include <cmath>
+#include <cstring>
+#include <functional>
+#include <iostream>
+#include <random>
+#include <vector>
+
+#include "Maths/Transform2D.h"
+#include "Maths/Vector2Batch.h"
+
+#include "Test.h"
+
+namespace
+{
+	using namespace Maths;
+
+	constexpr float Scale = 0.016f;
+	constexpr float Alpha = 0.3f;
+	constexpr float Angle = 0.7f;
+
+	/// Sizes around the widths of the kernels, to go through their scalar tails.
+	constexpr std::size_t Sizes[] = {0, 1, 3, 4, 5, 7, 8, 9, 15, 16, 17, 31, 33, 1000};
+
+	/**
+	 * \struct Kernel
+	 * \brief A batch kernel and the Vector2f operation giving its expected result.
+	 */
+	struct Kernel
+	{
+		const char* name;
+		std::function<Vector2f(const Vector2f&, const Vector2f&)> reference;
+		std::function<void(ConstVector2Span, ConstVector2Span, Vector2Span)> batch;
+	};
+
+	std::vector<Kernel> MakeKernels()
+	{
+		static const Transform2D transform = Transform2D::FromPositionRotationScale(Vector2f(12.0f, -3.0f), std::cos(Angle), std::sin(Angle), Vector2f(2.0f, 0.5f));
+
+		// Kernels writing floats return them in the x of the expected vector, the y is left to 0
+		return {
+			{"Add", [](const Vector2f& _lhs, const Vector2f& _rhs) { return _lhs + _rhs; },
+				[](ConstVector2Span _lhs, ConstVector2Span _rhs, Vector2Span _out) { Vector2Batch::Add(_lhs, _rhs, _out); }},
+			{"AddScaled", [](const Vector2f& _lhs, const Vector2f& _rhs) { return _lhs + _rhs * Scale; },
+				[](ConstVector2Span _lhs, ConstVector2Span _rhs, Vector2Span _out) { Vector2Batch::AddScaled(_lhs, _rhs, Scale, _out); }},
+			{"Translate", [](const Vector2f& _lhs, const Vector2f&) { return _lhs + Vector2f(3.5f, -1.25f); },
+				[](ConstVector2Span _lhs, ConstVector2Span, Vector2Span _out) { Vector2Batch::Translate(_lhs, Vector2f(3.5f, -1.25f), _out); }},
+			{"Scale", [](const Vector2f& _lhs, const Vector2f&) { return _lhs * Scale; },
+				[](ConstVector2Span _lhs, ConstVector2Span, Vector2Span _out) { Vector2Batch::Scale(_lhs, Scale, _out); }},
+			{"Lerp", [](const Vector2f& _lhs, const Vector2f& _rhs) { return Vector2f::Lerp(_lhs, _rhs, Alpha); },
+				[](ConstVector2Span _lhs, ConstVector2Span _rhs, Vector2Span _out) { Vector2Batch::Lerp(_lhs, _rhs, Alpha, _out); }},
+			{"Normalize", [](const Vector2f& _lhs, const Vector2f&) { return _lhs.NormalizeSafe(); },
+				[](ConstVector2Span _lhs, ConstVector2Span, Vector2Span _out) { Vector2Batch::Normalize(_lhs, _out); }},
+			{"Rotate", [](const Vector2f& _lhs, const Vector2f&) { return _lhs.Rotate(Angle); },
+				[](ConstVector2Span _lhs, ConstVector2Span, Vector2Span _out) { Vector2Batch::Rotate(_lhs, Angle, _out); }},
+			{"Length", [](const Vector2f& _lhs, const Vector2f&) { return Vector2f(_lhs.Magnitude(), 0.0f); },
+				[](ConstVector2Span _lhs, ConstVector2Span, Vector2Span _out) { Vector2Batch::Length(_lhs, _out.x); }},
+			{"Distance", [](const Vector2f& _lhs, const Vector2f& _rhs) { return Vector2f(_lhs.Distance(_rhs), 0.0f); },
+				[](ConstVector2Span _lhs, ConstVector2Span _rhs, Vector2Span _out) { Vector2Batch::Distance(_lhs, _rhs, _out.x); }},
+			{"Transform", [](const Vector2f& _lhs, const Vector2f&) { return transform.TransformPoint(_lhs); },
+				[](ConstVector2Span _lhs, ConstVector2Span, Vector2Span _out) { transform.TransformPoints(_lhs, _out); }}
+		};
+	}
+
+	/**
+	 * \brief Runs every kernel at every supported level and compares each result with Vector2f, bit for bit.
+	 * \param _offset Index the spans start at in their arrays, to test unaligned spans.
+	 * \param _in_place Whether the output is the left input, as the particles and bodies use the kernels.
+	 */
+	void CheckKernels(const std::size_t _offset, const bool _in_place)
+	{
+		const Vector2Batch::SimdLevel supported = Vector2Batch::GetSupportedSimdLevel();
+
+		std::mt19937 random(42);
+		std::uniform_real_distribution<float> distribution(-100.0f, 100.0f);
+
+		for (const Kernel& kernel : MakeKernels())
+		{
+			for (const std::size_t size : Sizes)
+			{
+				std::vector<Vector2f> lhs(size);
+				std::vector<Vector2f> rhs(size);
+				for (std::size_t i = 0; i < size; i++)
+				{
+					// Some zero vectors for the special case of Normalize
+					lhs[i] = i % 5 == 0 ? Vector2f::Zero : Vector2f(distribution(random), distribution(random));
+					rhs[i] = Vector2f(distribution(random), distribution(random));
+				}
+
+				for (int level = 0; level <= static_cast<int>(supported); level++)
+				{
+					Vector2Batch::SetSimdLevel(static_cast<Vector2Batch::SimdLevel>(level));
+
+					Vector2Array lhs_array(_offset + size);
+					Vector2Array rhs_array(_offset + size);
+					Vector2Array out_array(_offset + size);
+					for (std::size_t i = 0; i < size; i++)
+					{
+						lhs_array.Set(_offset + i, lhs[i]);
+						rhs_array.Set(_offset + i, rhs[i]);
+					}
+
+					const Vector2Span lhs_span = {lhs_array.GetSpan().x + _offset, lhs_array.GetSpan().y + _offset, size};
+					const Vector2Span rhs_span = {rhs_array.GetSpan().x + _offset, rhs_array.GetSpan().y + _offset, size};
+					const Vector2Span out_span = _in_place ? lhs_span : Vector2Span{out_array.GetSpan().x + _offset, out_array.GetSpan().y + _offset, size};
+					kernel.batch(lhs_span, rhs_span, out_span);
+
+					const bool writes_y = std::strcmp(kernel.name, "Length") != 0 && std::strcmp(kernel.name, "Distance") != 0;
+					bool same = true;
+					for (std::size_t i = 0; i < size; i++)
+					{
+						const Vector2f expected = kernel.reference(lhs[i], rhs[i]);
+						same = same && std::memcmp(&expected.x, out_span.x + i, sizeof(float)) == 0;
+						if (writes_y)
+							same = same && std::memcmp(&expected.y, out_span.y + i, sizeof(float)) == 0;
+					}
+					if (!same)
+						std::cerr << kernel.name << " differs at " << Vector2Batch::GetSimdLevelName(static_cast<Vector2Batch::SimdLevel>(level)) << " for " << size << " vectors\n";
+					CHECK(same);
+				}
+			}
+		}
+
+		Vector2Batch::SetSimdLevel(supported);
+	}
+}
+
+TEST_CASE(Vector2BatchMatchesVector2f)
+{
+	CheckKernels(0, false);
+}
+
+TEST_CASE(Vector2BatchMatchesVector2fUnaligned)
+{
+	CheckKernels(1, false);
+}
+
+TEST_CASE(Vector2BatchMatchesVector2fInPlace)
+{
+	CheckKernels(0, true);
+}
+
+TEST_CASE(Vector2BatchLowersUnsupportedLevels)
+{
+	const Vector2Batch::SimdLevel supported = Vector2Batch::GetSupportedSimdLevel();
+
+	Vector2Batch::SetSimdLevel(Vector2Batch::SimdLevel::Avx2);
+	CHECK(Vector2Batch::GetSimdLevel() == supported);
+
+	Vector2Batch::SetSimdLevel(Vector2Batch::SimdLevel::Scalar);
+	CHECK(Vector2Batch::GetSimdLevel() == Vector2Batch::SimdLevel::Scalar);
+
+	Vector2Batch::SetSimdLevel(supported);
+}
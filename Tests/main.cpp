@@ -0,0 +1,52 @@
+#include <atomic>
+#include <cstring>
+#include <iostream>
+#include <mutex>
+
+#include "Test.h"
+
+namespace
+{
+	std::atomic<int> failures = 0;
+	std::mutex outputMutex;
+}
+
+std::vector<Test::Case>& Test::GetCases()
+{
+	static std::vector<Case> cases;
+	return cases;
+}
+
+void Test::Fail(const char* _expression, const char* _file, const int _line)
+{
+	++failures;
+
+	const std::lock_guard<std::mutex> lock(outputMutex);
+	std::cerr << _file << "(" << _line << "): CHECK(" << _expression << ") failed\n";
+}
+
+int main(const int _argc, char* _argv[])
+{
+	// An argument runs the cases whose name contains it
+	const char* filter = _argc >= 2 ? _argv[1] : nullptr;
+
+	int failed_cases = 0;
+	int run_cases = 0;
+	for (const Test::Case& test_case : Test::GetCases())
+	{
+		if (filter && !std::strstr(test_case.name, filter))
+			continue;
+
+		const int failures_before = failures;
+		test_case.function();
+		++run_cases;
+
+		const bool passed = failures == failures_before;
+		if (!passed)
+			++failed_cases;
+		std::cout << (passed ? "[ ok ] " : "[FAIL] ") << test_case.name << "\n";
+	}
+
+	std::cout << run_cases - failed_cases << "/" << run_cases << " test cases passed\n";
+	return failed_cases == 0 ? 0 : 1;
+}